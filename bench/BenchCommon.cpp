@@ -0,0 +1,52 @@
+#include "BenchCommon.h"
+
+#include <opencv2/imgproc.hpp>
+#include <opencv2/aruco.hpp>
+
+#include "MarkerTracker.h"
+
+namespace Bench
+{
+	cv::Mat TexturedFrame(cv::Size size, int seed)
+	{
+		cv::RNG rng(seed);
+		cv::Mat noise(size / 4, CV_8UC3);
+		rng.fill(noise, cv::RNG::UNIFORM, 0, 256);
+
+		cv::Mat frame;
+		cv::resize(noise, frame, size, 0.0, 0.0, cv::INTER_LINEAR);
+		cv::GaussianBlur(frame, frame, cv::Size(5, 5), 0.0);
+		return frame;
+	}
+
+	cv::Mat MarkerFrame(cv::Size size)
+	{
+		return MarkerFrame(size, std::max(size.height / 10, 32));
+	}
+
+	cv::Mat MarkerFrame(cv::Size size, int side)
+	{
+		const cv::Ptr<cv::aruco::Dictionary> dictionary = cv::aruco::getPredefinedDictionary(MarkerTracker::DEFAULT_DICTIONARY);
+		cv::Mat frame(size, CV_8UC1, cv::Scalar(255));
+
+		// a marker-sized quiet zone around each marker
+		int id = 0;
+		for (int y = side; y + side <= size.height - side; y += 2 * side)
+		{
+			for (int x = side; x + side <= size.width - side; x += 2 * side)
+			{
+				cv::Mat marker;
+				cv::aruco::drawMarker(dictionary, id++ % dictionary->bytesList.rows, side, marker);
+				marker.copyTo(frame(cv::Rect(x, y, side, side)));
+			}
+		}
+		return frame;
+	}
+
+	CameraCalibration DistortedCalibration(cv::Size size)
+	{
+		CameraCalibration calibration = CameraCalibration::Guess(size);
+		calibration.distCoeffs = (cv::Mat_<double>(1, 5) << -0.25, 0.08, 0.0, 0.0, 0.0);
+		return calibration;
+	}
+}
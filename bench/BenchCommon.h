@@ -0,0 +1,33 @@
+/*
+ * Shared parameters and synthetic inputs of the stage benchmarks.
+ */
+
+#pragma once
+
+#include <opencv2/ts.hpp>
+#include <opencv2/ts/ts_perf.hpp>
+
+#include "CameraCalibration.h"
+
+// every image stage runs at these frame sizes and thread counts (cv::setNumThreads)
+#define BENCH_SIZES ::testing::Values(::perf::szVGA, ::perf::sz720p, ::perf::sz1080p)
+#define BENCH_THREADS ::testing::Values(1, 4)
+
+typedef ::testing::tuple<cv::Size, int> SizeThreads_t;
+typedef ::perf::TestBaseWithParam<SizeThreads_t> SizeThreads;
+
+// Inputs are generated, not read from disk, so the suite runs anywhere
+// without test data and every build measures the same pixels.
+namespace Bench
+{
+	// BGR frame with blurred noise, corners enough for feature detection
+	cv::Mat TexturedFrame(cv::Size size, int seed);
+
+	// gray frame with a grid of ArUco markers from MarkerTracker's dictionary,
+	// a tenth of the frame height or 'side' pixels wide
+	cv::Mat MarkerFrame(cv::Size size);
+	cv::Mat MarkerFrame(cv::Size size, int side);
+
+	// guessed intrinsics with a noticeable barrel distortion
+	CameraCalibration DistortedCalibration(cv::Size size);
+}
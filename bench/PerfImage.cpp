@@ -0,0 +1,39 @@
+#include "BenchCommon.h"
+
+#include <opencv2/imgproc.hpp>
+
+#include "Undistorter.h"
+
+using namespace perf;
+
+PERF_TEST_P(SizeThreads, Grayscale, ::testing::Combine(BENCH_SIZES, BENCH_THREADS))
+{
+	const cv::Size size = ::testing::get<0>(GetParam());
+	cv::setNumThreads(::testing::get<1>(GetParam()));
+
+	const cv::Mat frame = Bench::TexturedFrame(size, 1);
+	cv::Mat gray(size, CV_8UC1);
+	declare.in(frame).out(gray);
+
+	TEST_CYCLE() cv::cvtColor(frame, gray, cv::COLOR_BGR2GRAY);
+
+	SANITY_CHECK_NOTHING();
+}
+
+PERF_TEST_P(SizeThreads, Undistort, ::testing::Combine(BENCH_SIZES, BENCH_THREADS))
+{
+	const cv::Size size = ::testing::get<0>(GetParam());
+	cv::setNumThreads(::testing::get<1>(GetParam()));
+
+	// maps are built here, only applying them is measured
+	Undistorter undistorter;
+	ASSERT_TRUE(undistorter.Init(Bench::DistortedCalibration(size), ""));
+
+	const cv::Mat frame = Bench::TexturedFrame(size, 1);
+	cv::Mat corrected(size, CV_8UC3);
+	declare.in(frame).out(corrected);
+
+	TEST_CYCLE() undistorter.Apply(frame, corrected);
+
+	SANITY_CHECK_NOTHING();
+}
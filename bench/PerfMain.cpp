@@ -0,0 +1,5 @@
+#include "BenchCommon.h"
+
+// run with --gtest_output=xml:<file> for machine-readable results,
+// --gtest_filter=<pattern> to pick stages
+CV_PERF_TEST_MAIN(cv_hw1)
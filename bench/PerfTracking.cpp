@@ -0,0 +1,110 @@
+#include "BenchCommon.h"
+
+#include <opencv2/imgproc.hpp>
+
+#include "MarkerTracker.h"
+#include "FeatureTracker.h"
+
+using namespace perf;
+
+// MarkerMode::FullFrame / MarkerMode::Tracking
+enum { FullFrame, Roi };
+CV_ENUM(MarkerSearch, FullFrame, Roi)
+
+typedef ::testing::tuple<cv::Size, int, MarkerSearch> SizeThreadsSearch_t;
+typedef TestBaseWithParam<SizeThreadsSearch_t> SizeThreadsSearch;
+
+PERF_TEST_P(SizeThreadsSearch, Markers, ::testing::Combine(BENCH_SIZES, BENCH_THREADS, MarkerSearch::all()))
+{
+	const cv::Size size = ::testing::get<0>(GetParam());
+	cv::setNumThreads(::testing::get<1>(GetParam()));
+	const bool roi = (int)::testing::get<2>(GetParam()) == Roi;
+
+	const cv::Mat frame = Bench::MarkerFrame(size);
+	MarkerTracker tracker;
+	tracker.Init(CameraCalibration::Guess(size), 0.05f, roi);
+
+	// the first frame is always a full scan; ROI tracking is measured in steady state
+	tracker.Process(frame);
+	ASSERT_FALSE(tracker.Markers().empty());
+	declare.in(frame);
+
+	TEST_CYCLE() tracker.Process(frame);
+
+	SANITY_CHECK_NOTHING();
+}
+
+// not a measurement: tiled full-frame scans must find exactly what one serial
+// scan finds, for markers handled by the tiles (small), by the downscaled pass
+// (medium) and for markers that at 1080p are wider than twice the tile overlap (large)
+TEST(Markers, TiledScanMatchesSerial)
+{
+	const cv::Size sizes[] = { ::perf::sz720p, ::perf::sz1080p };
+	for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++)
+	{
+		const cv::Size size = sizes[s];
+		const int sides[] = { size.height / 20, size.height / 10, size.height / 3 };
+		for (size_t k = 0; k < sizeof(sides) / sizeof(sides[0]); k++)
+		{
+			for (int angle = 0; angle <= 20; angle += 20)
+			{
+				SCOPED_TRACE(cv::format("%dx%d, side %d, %d degrees", size.width, size.height, sides[k], angle));
+				cv::Mat frame;
+				const cv::Mat rotation = cv::getRotationMatrix2D(cv::Point2f(size.width * 0.5f, size.height * 0.5f), angle, 1.0);
+				cv::warpAffine(Bench::MarkerFrame(size, sides[k]), frame, rotation, size, cv::INTER_LINEAR, cv::BORDER_CONSTANT, cv::Scalar(255));
+
+				// the first frame of a tracker is a full scan; its markers are the detections
+				cv::setNumThreads(8);
+				MarkerTracker serial, tiled;
+				serial.Init(CameraCalibration::Guess(size), 0.05f, false);
+				serial.SetTiledScan(false);
+				tiled.Init(CameraCalibration::Guess(size), 0.05f, false);
+				serial.Process(frame);
+				tiled.Process(frame);
+				EXPECT_GT(tiled.TilesPerScan(), 1);
+
+				const std::vector<TrackedMarker>& expected = serial.Markers();
+				const std::vector<TrackedMarker>& actual = tiled.Markers();
+				ASSERT_FALSE(expected.empty());
+				ASSERT_EQ(expected.size(), actual.size());
+				for (size_t i = 0; i < expected.size(); i++)
+				{
+					// same markers, possibly in another order; tiles see the same pixels
+					// at an offset, corners may differ in the last float bits
+					bool found = false;
+					for (size_t j = 0; j < actual.size() && !found; j++)
+					{
+						found = actual[j].id == expected[i].id;
+						for (size_t c = 0; c < 4 && found; c++)
+							found = cv::norm(actual[j].corners[c] - expected[i].corners[c]) < 1e-2;
+					}
+					EXPECT_TRUE(found) << "marker " << expected[i].id << " at " << expected[i].corners[0];
+				}
+			}
+		}
+	}
+	cv::setNumThreads(-1);
+}
+
+PERF_TEST_P(SizeThreads, OpticalFlow, ::testing::Combine(BENCH_SIZES, BENCH_THREADS))
+{
+	const cv::Size size = ::testing::get<0>(GetParam());
+	cv::setNumThreads(::testing::get<1>(GetParam()));
+
+	// two frames a few pixels apart, tracked back and forth
+	cv::Mat frames[2];
+	cv::cvtColor(Bench::TexturedFrame(size, 1), frames[0], cv::COLOR_BGR2GRAY);
+	const cv::Mat shift = (cv::Mat_<double>(2, 3) << 1.0, 0.0, 3.0, 0.0, 1.0, 2.0);
+	cv::warpAffine(frames[0], frames[1], shift, size, cv::INTER_LINEAR, cv::BORDER_REFLECT);
+
+	FeatureTracker tracker;
+	tracker.Process(frames[0]);
+	tracker.Process(frames[1]);
+	ASSERT_GT(tracker.Count(), 0u);
+	declare.in(frames[0], frames[1]);
+
+	int cycle = 0;
+	TEST_CYCLE() tracker.Process(frames[cycle++ & 1]);
+
+	SANITY_CHECK_NOTHING();
+}
@@ -0,0 +1,69 @@
+#include "BenchCommon.h"
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <vector>
+
+#include "PointTransform.h"
+
+using namespace perf;
+
+// mirrors SimdLevel, which CV_ENUM cannot print
+enum { SCALAR, SSE2, AVX2, AVX512 };
+CV_ENUM(Simd, SCALAR, SSE2, AVX2, AVX512)
+
+typedef ::testing::tuple<int, Simd, int> CountSimdThreads_t;
+typedef TestBaseWithParam<CountSimdThreads_t> CountSimdThreads;
+
+// below and above PARALLEL_THRESHOLD
+#define BENCH_COUNTS ::testing::Values(1024, 65536, 1 << 20)
+
+static void SelectSimd(int level)
+{
+	if (level > (int)DetectSimdLevel())
+		throw ::cvtest::SkipTestException("SIMD level not supported by this CPU");
+	SetSimdLevel((SimdLevel)level);
+}
+
+static glm::mat4 Projection()
+{
+	return glm::perspective(glm::radians(60.0f), 4.0f / 3.0f, 0.1f, 100.0f)
+		* glm::lookAt(glm::vec3(0.0f, 1.0f, 5.0f), glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+}
+
+PERF_TEST_P(CountSimdThreads, TransformPoints, ::testing::Combine(BENCH_COUNTS, Simd::all(), BENCH_THREADS))
+{
+	const int count = ::testing::get<0>(GetParam());
+	SelectSimd(::testing::get<1>(GetParam()));
+	cv::setNumThreads(::testing::get<2>(GetParam()));
+
+	std::vector<glm::vec3> points(count);
+	cv::RNG rng(1);
+	for (int i = 0; i < count; i++)
+		points[i] = glm::vec3(rng.uniform(-1.0f, 1.0f), rng.uniform(-1.0f, 1.0f), rng.uniform(-1.0f, 1.0f));
+	std::vector<glm::vec4> projected(count);
+	const glm::mat4 m = Projection();
+
+	TEST_CYCLE() TransformPoints(m, points.data(), projected.data(), count);
+
+	SetSimdLevel(DetectSimdLevel());
+	SANITY_CHECK_NOTHING();
+}
+
+PERF_TEST_P(CountSimdThreads, MultiplyMatrices, ::testing::Combine(BENCH_COUNTS, Simd::all(), BENCH_THREADS))
+{
+	const int count = ::testing::get<0>(GetParam());
+	SelectSimd(::testing::get<1>(GetParam()));
+	cv::setNumThreads(::testing::get<2>(GetParam()));
+
+	std::vector<glm::mat4> models(count);
+	for (int i = 0; i < count; i++)
+		models[i] = glm::translate(glm::mat4(1.0f), glm::vec3((float)(i % 100), (float)(i / 100 % 100), 0.0f));
+	std::vector<glm::mat4> mvps(count);
+	const glm::mat4 m = Projection();
+
+	TEST_CYCLE() MultiplyMatrices(m, models.data(), mvps.data(), count);
+
+	SetSimdLevel(DetectSimdLevel());
+	SANITY_CHECK_NOTHING();
+}
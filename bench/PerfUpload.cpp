@@ -0,0 +1,34 @@
+#include "BenchCommon.h"
+
+#include "HeadlessContext.h"
+#include "FrameUploader.h"
+
+using namespace perf;
+
+typedef TestBaseWithParam<cv::Size> FrameSize;
+
+PERF_TEST_P(FrameSize, TextureUpload, BENCH_SIZES)
+{
+	const cv::Size size = GetParam();
+
+	HeadlessContext context;
+	if (!context.Create(false))
+		throw ::cvtest::SkipTestException("no OpenGL context");
+
+	const cv::Mat frame = Bench::TexturedFrame(size, 1);
+	FrameUploader uploader;
+	uploader.Init();
+	uploader.Upload(frame);
+	glFinish();
+	declare.in(frame);
+
+	// glFinish so the copy into the texture is measured, not only queued
+	TEST_CYCLE()
+	{
+		uploader.Upload(frame);
+		glFinish();
+	}
+
+	uploader.Release();
+	SANITY_CHECK_NOTHING();
+}
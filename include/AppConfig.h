@@ -0,0 +1,88 @@
+/*
+ * Command line options of the application.
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <opencv2/core.hpp>
+
+#include "FramePacer.h"
+#include "VideoRecorder.h"
+#include "InputSystem.h"
+
+enum class MarkerMode
+{
+	Off,
+	FullFrame,	// detect ArUco markers in every whole frame
+	Tracking	// detect only around Kalman-predicted marker positions
+};
+
+enum class UndistortMode
+{
+	Off,
+	CPU,	// cv::remap before upload; later CV stages see corrected frames
+	GPU		// lookup texture sampled by the background shader
+};
+
+struct AppConfig
+{
+	PacingMode pacing;
+	double targetFps;
+
+	// video file to read instead of the default camera
+	std::string inputPath;
+
+	// render offscreen, as fast as frames can be read, into 'outputPath'
+	bool headless;
+	std::string outputPath;
+	int maxFrames;	// 0 = until the input ends
+
+	// resolve GL entry points on first use instead of all at startup
+	bool lazyGL;
+
+	// ArUco marker stage. intrinsics come from 'calibrationPath', or are guessed without one
+	MarkerMode markers;
+	std::string calibrationPath;
+	float markerLength;	// printed marker side, in meters
+
+	// lens correction with the same intrinsics
+	UndistortMode undistort;
+
+	// sparse optical flow over GFTT corners
+	bool trackFeatures;
+
+	// windowed mode: record camera frames and/or the rendered window on an encoder thread
+	std::string recordCameraPath;
+	std::string recordOutputPath;
+	OverflowPolicy recordPolicy;
+
+	// added to (or overriding) the default key bindings
+	std::vector<KeyBinding> bindings;
+
+	// stage timings as Chrome trace JSON, written at exit and on demand
+	std::string tracePath;
+
+	// derived data kept between runs (undistortion maps, chessboard corners, ...)
+	std::string cacheDirectory;
+
+	// calibration tool: calibrate from the chessboard images matching 'calibrateImages',
+	// write the result to 'calibrationPath' and exit
+	std::string calibrateImages;
+	cv::Size boardSize;	// inner corners
+	float squareSize;
+	int solverFlags;	// cv::calibrateCamera flags
+
+	AppConfig()
+		: pacing(PacingMode::VSync), targetFps(60.0), headless(false), maxFrames(0), lazyGL(false),
+		markers(MarkerMode::Off), markerLength(0.05f), undistort(UndistortMode::Off), trackFeatures(false),
+		recordPolicy(OverflowPolicy::DropOldest), cacheDirectory("cache"),
+		boardSize(9, 6), squareSize(0.025f), solverFlags(0)
+	{
+	}
+};
+
+// fill 'config' from argv. returns false (after printing usage) on bad arguments.
+bool ParseArgs(int argc, char** argv, AppConfig& config);
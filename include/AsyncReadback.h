@@ -0,0 +1,77 @@
+/*
+ * Framebuffer readback through a ring of pixel-pack buffers.
+ */
+
+#pragma once
+
+#include <glad/glad.h>
+
+#include <opencv2/core.hpp>
+
+#include <chrono>
+
+// Issue() starts glReadPixels into the next pack buffer and fences it; the
+// call returns at once because the copy lands in GPU-side memory. A frame is
+// acquired some frames later, once its fence has signaled, by mapping the
+// buffer: by then the transfer is long done and nothing stalls.
+// Acquiring a frame the GPU has not finished yet, which only happens when
+// waiting is asked for, is counted as a stall.
+class AsyncReadback
+{
+public:
+	static const int RING_SIZE = 3;
+
+	AsyncReadback();
+	~AsyncReadback();
+
+	// requires a current GL context. (re)allocates the buffers for BGR frames of 'size'
+	void Init(cv::Size size);
+	void Release();
+
+	bool IsReady() const { return pbo[0] != 0; }
+	cv::Size Size() const { return size; }
+
+	// true if an Issue now would discard the oldest frame
+	bool IsFull() const { return pending == RING_SIZE; }
+
+	// read the whole of 'buffer' (GL_BACK, GL_COLOR_ATTACHMENT0, ...) of 'framebuffer'.
+	// the caller should Acquire/ReleaseAcquired first while IsFull(), otherwise
+	// the oldest frame is discarded to make room
+	void Issue(GLuint framebuffer, GLenum buffer);
+
+	// map the oldest issued frame. with 'wait' false this fails unless the GPU
+	// already finished it. 'frame' is a bottom-up BGR view of the mapped buffer,
+	// valid until ReleaseAcquired, which must come before the next Issue/Acquire.
+	bool Acquire(cv::Mat& frame, bool wait);
+	void ReleaseAcquired();
+
+	// statistics
+	int Issued() const { return issued; }
+	int Acquired() const { return acquired; }
+	int Discarded() const { return discarded; }
+	int Stalls() const { return stalls; }
+	// issue to acquire, in ms
+	double AverageLatency() const { return acquired > 0 ? totalLatency / acquired : 0.0; }
+	double WorstLatency() const { return worstLatency; }
+
+private:
+	void ReleaseFence(int slot);
+
+private:
+	GLuint pbo[RING_SIZE];
+	GLsync fences[RING_SIZE];
+	std::chrono::steady_clock::time_point issueTimes[RING_SIZE];
+	int oldest;		// slot of the oldest frame in flight
+	int pending;	// frames in flight
+	bool mapped;
+
+	cv::Size size;
+	size_t bytes;
+
+	int issued;
+	int acquired;
+	int discarded;
+	int stalls;
+	double totalLatency;
+	double worstLatency;
+};
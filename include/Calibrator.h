@@ -0,0 +1,73 @@
+/*
+ * Chessboard camera calibration over large image sets.
+ */
+
+#pragma once
+
+#include <opencv2/core.hpp>
+
+#include <string>
+#include <vector>
+
+#include "CameraCalibration.h"
+
+struct CalibratorOptions
+{
+	cv::Size boardSize;		// inner corners per row and column
+	float squareSize;		// side of one square, in the unit tvecs should use
+	int flags;				// cv::calibrateCamera flags
+	std::string cacheDirectory;	// may be empty to detect every image every time
+
+	CalibratorOptions()
+		: boardSize(9, 6), squareSize(0.025f), flags(0), cacheDirectory("cache")
+	{
+	}
+};
+
+// Corner detection runs on all cores, one image per task: every task reads,
+// decodes, detects and drops its image, so memory stays at one image per
+// thread however large the set is. Detected corners (or the fact that none
+// were found) are cached under a hash of the file content and board size,
+// so changing only the square size or solver flags re-runs just the solver.
+class Calibrator
+{
+public:
+	explicit Calibrator(const CalibratorOptions& options);
+
+	// 'pattern' is a glob such as "images/*.jpg" or a directory.
+	// returns false if too few usable images were found.
+	bool Run(const std::string& pattern, CameraCalibration& result);
+
+	// statistics of the last Run
+	int Images() const { return (int)views.size(); }
+	int UsableImages() const { return usable; }
+	int CachedImages() const { return cached; }
+	double ReprojectionError() const { return rms; }
+	double DetectSeconds() const { return detectSeconds; }
+	double SolveSeconds() const { return solveSeconds; }
+
+private:
+	struct View
+	{
+		std::string path;
+		cv::Size imageSize;
+		std::vector<cv::Point2f> corners;	// empty if the board was not found
+		bool cached;
+		bool readable;
+	};
+
+	void Detect(View& view) const;
+	bool LoadCorners(const std::string& path, View& view) const;
+	void SaveCorners(const std::string& path, const View& view) const;
+
+private:
+	static const int MIN_VIEWS = 3;
+
+	CalibratorOptions options;
+	std::vector<View> views;
+	int usable;
+	int cached;
+	double rms;
+	double detectSeconds;
+	double solveSeconds;
+};
@@ -0,0 +1,29 @@
+/*
+ * Camera intrinsics shared by the CV stages.
+ */
+
+#pragma once
+
+#include <opencv2/core.hpp>
+
+#include <string>
+
+struct CameraCalibration
+{
+	cv::Mat cameraMatrix;	// 3x3 CV_64F
+	cv::Mat distCoeffs;		// 1xN CV_64F
+	cv::Size imageSize;
+
+	// read a file written by OpenCV's calibration sample or by Save():
+	// "camera_matrix", "distortion_coefficients", "image_width", "image_height"
+	bool Load(const std::string& path);
+	bool Save(const std::string& path) const;
+
+	bool IsValid() const { return !cameraMatrix.empty(); }
+
+	// intrinsics are defined for 'imageSize'; scale them to frames of another size
+	CameraCalibration ScaledTo(cv::Size size) const;
+
+	// stand-in for an uncalibrated camera: ~60 degree horizontal field of view, no distortion
+	static CameraCalibration Guess(cv::Size size);
+};
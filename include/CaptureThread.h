@@ -0,0 +1,43 @@
+/*
+ * Background camera capture feeding a FrameRing.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <thread>
+
+#include "FrameRing.h"
+#include "FrameSource.h"
+
+// Runs grab()/retrieve() on its own thread so a blocking camera read
+// never eats into the render loop's frame budget.
+class CaptureThread
+{
+public:
+	CaptureThread(FrameSource& source, FrameRing& ring);
+	~CaptureThread();
+
+	// start capturing. returns false if the source is not opened.
+	bool Start();
+
+	// stop and join the capture thread
+	void Stop();
+
+	bool IsRunning() const { return running.load(); }
+
+	// called on the capture thread after every committed frame. set before Start.
+	void SetFrameCallback(const std::function<void()>& callback) { onFrame = callback; }
+
+private:
+	void Run();
+
+private:
+	FrameSource& source;
+	FrameRing& ring;
+	std::function<void()> onFrame;
+
+	std::thread worker;
+	std::atomic<bool> running;
+};
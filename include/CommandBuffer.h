@@ -0,0 +1,123 @@
+/*
+ * Render commands recorded without a GL context and replayed on the GL thread.
+ */
+
+#pragma once
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+// A linear buffer of compact, 16 byte aligned command packets. Recording only
+// appends bytes and never touches GL, so any thread can fill its own buffer;
+// Clear keeps the memory for the next frame. Buffer uploads carry their data
+// inline: BufferData returns the payload to write into, which stays valid
+// until the next command is recorded.
+class CommandBuffer
+{
+public:
+	CommandBuffer();
+	~CommandBuffer();
+
+	void Clear() { size = 0; commands = 0; }
+	bool IsEmpty() const { return commands == 0; }
+	size_t Commands() const { return commands; }
+	size_t Bytes() const { return size; }
+
+	void UseProgram(GLuint program);
+	void BindVertexArray(GLuint vao);
+	void BindTexture(int unit, GLuint texture);	// GL_TEXTURE_2D
+	void Enable(GLenum capability);
+	void Disable(GLenum capability);
+	void Uniform(GLint location, int value);
+	void Uniform(GLint location, const glm::vec2& value);
+	void Uniform(GLint location, const glm::mat4& value);
+
+	// glBufferData on 'buffer' (which orphans its old storage) with 'bytes' of data
+	void* BufferData(GLenum target, GLuint buffer, size_t bytes, GLenum usage);
+
+	void DrawArrays(GLenum mode, GLint first, GLsizei count);
+	void DrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, size_t offset, GLsizei instances);
+
+private:
+	friend class CommandReplayer;
+
+	enum Type : uint16_t
+	{
+		USE_PROGRAM,
+		BIND_VERTEX_ARRAY,
+		BIND_TEXTURE,
+		ENABLE,
+		DISABLE,
+		UNIFORM_INT,
+		UNIFORM_VEC2,
+		UNIFORM_MAT4,
+		BUFFER_DATA,
+		DRAW_ARRAYS,
+		DRAW_ELEMENTS_INSTANCED
+	};
+
+	struct Header
+	{
+		uint16_t type;
+		uint16_t reserved;
+		uint32_t size;		// of the whole packet, header and payload
+		uint32_t args[2];	// small operands, meaning depends on the type
+	};
+
+	static const size_t ALIGNMENT = 16;
+
+	// append a packet with 'payload' bytes after the header; returns the payload
+	void* Append(Type type, uint32_t arg0, uint32_t arg1, size_t payload);
+
+private:
+	uint8_t* data;
+	size_t size;
+	size_t capacity;
+	size_t commands;
+
+	CommandBuffer(const CommandBuffer&);
+	CommandBuffer& operator=(const CommandBuffer&);
+};
+
+// Replays command buffers on the thread owning the GL context in one loop,
+// skipping state changes that would not change anything: binding the program,
+// vertex array, texture or buffer already bound, or enabling what is already
+// enabled. What GL state looks like is only known for what was replayed, so
+// the cache starts out empty for every Begin.
+class CommandReplayer
+{
+public:
+	CommandReplayer();
+
+	// forget the cached state; GL may have been touched directly since
+	void Begin();
+	void Replay(const CommandBuffer& buffer);
+
+	// statistics
+	uint64_t Replayed() const { return replayed; }
+	uint64_t Filtered() const { return filtered; }
+
+private:
+	static const int MAX_UNITS = 16;
+	static const GLuint UNKNOWN = 0xFFFFFFFF;
+
+	bool SetCapability(GLenum capability, bool enable);
+
+private:
+	GLuint program;
+	GLuint vao;
+	GLuint arrayBuffer;
+	int activeUnit;
+	GLuint textures[MAX_UNITS];
+
+	// GL_DEPTH_TEST, GL_BLEND, GL_CULL_FACE: -1 unknown, 0 disabled, 1 enabled
+	int depthTest;
+	int blend;
+	int cullFace;
+
+	uint64_t replayed;
+	uint64_t filtered;
+};
@@ -0,0 +1,99 @@
+/*
+ * View frustum culling over a bounding volume hierarchy.
+ */
+
+#pragma once
+
+#include <glm/glm.hpp>
+
+#include <vector>
+
+struct BoundingBox
+{
+	glm::vec3 min;
+	glm::vec3 max;
+
+	BoundingBox() : min(0.0f), max(0.0f) {}
+	BoundingBox(const glm::vec3& min, const glm::vec3& max) : min(min), max(max) {}
+
+	glm::vec3 Center() const { return (min + max) * 0.5f; }
+	glm::vec3 Extents() const { return (max - min) * 0.5f; }
+	void Merge(const BoundingBox& other) { min = glm::min(min, other.min); max = glm::max(max, other.max); }
+};
+
+struct BoundingSphere
+{
+	glm::vec3 center;
+	float radius;
+};
+
+// world bounds of a box transformed by 'm' (J. Arvo, "Transforming Axis-Aligned
+// Bounding Boxes", Graphics Gems, 1990). 'm' must be affine.
+BoundingBox TransformBounds(const glm::mat4& m, const BoundingBox& local);
+
+enum class Visibility
+{
+	Outside,
+	Intersecting,
+	Inside
+};
+
+// The six planes of a clip matrix (G. Gribb, K. Hartmann, "Fast Extraction of
+// Viewing Frustum Planes from the World-View-Projection Matrix", 2001), so it
+// works for perspective and orthographic projections alike. Planes are stored
+// as structure-of-arrays and padded to eight, so a volume is tested against
+// four planes per SSE instruction.
+class Frustum
+{
+public:
+	Frustum();
+	// 'clip' maps world space to GL clip space, e.g. projection * view
+	explicit Frustum(const glm::mat4& clip);
+
+	Visibility Test(const BoundingBox& box) const;
+	Visibility Test(const BoundingSphere& sphere) const;
+
+	// plane i as (normal, distance), normal pointing inwards
+	glm::vec4 Plane(int i) const { return glm::vec4(nx[i], ny[i], nz[i], d[i]); }
+
+private:
+	static const int PLANES = 8;
+
+	float nx[PLANES], ny[PLANES], nz[PLANES], d[PLANES];
+	float ax[PLANES], ay[PLANES], az[PLANES];	// |normal|, for box extents
+};
+
+// Median-split hierarchy over the bounds of a frame's objects, laid out depth
+// first so a node's left child is the next node. Subtrees entirely inside the
+// frustum are accepted without testing their objects, subtrees outside are
+// skipped whole.
+class BoundingVolumeHierarchy
+{
+public:
+	static const int LEAF_SIZE = 8;
+
+	void Build(const std::vector<BoundingBox>& bounds);
+
+	// append the indices of all objects not outside 'frustum', in no particular order
+	void Query(const Frustum& frustum, std::vector<int>& visible) const;
+
+	size_t NodeCount() const { return nodes.size(); }
+
+private:
+	struct Node
+	{
+		BoundingBox bounds;
+		int first;	// into 'order'
+		int count;
+		int right;	// 0 for leaves
+	};
+
+	int BuildNode(int first, int count);
+	void QueryNode(int node, const Frustum& frustum, std::vector<int>& visible) const;
+
+private:
+	std::vector<Node> nodes;
+	std::vector<int> order;
+	std::vector<BoundingBox> objects;
+	std::vector<glm::vec3> centers;
+};
@@ -0,0 +1,77 @@
+/*
+ * Frame-to-frame sparse optical flow over persistent image pyramids.
+ */
+
+#pragma once
+
+#include <opencv2/core.hpp>
+
+#include <vector>
+
+#include "SoaVector.h"
+
+// calcOpticalFlowPyrLK on plain images builds both pyramids on every call,
+// although the previous one was already built a frame ago. This tracker keeps
+// two pyramids (with derivatives) and ping-pongs between them, so each frame
+// builds exactly one, into buffers that are reused once sizes settle.
+// Tracks live in SoA streams; each track starts its search where its last
+// displacement predicts it. New GFTT corners are only detected once fewer
+// than MIN_TRACKS survive, away from the tracks still alive.
+class FeatureTracker
+{
+public:
+	static const int MAX_TRACKS = 500;
+	static const int MIN_TRACKS = 250;
+	static const int MAX_LEVEL = 3;
+	static const int WINDOW_SIZE = 21;
+	static const int MIN_DISTANCE = 10;		// pixels between detected corners
+
+	FeatureTracker();
+
+	void Reset();
+
+	// track into a new gray frame. the frame is copied into the pyramid,
+	// so it does not have to outlive the call
+	void Process(const cv::Mat& gray);
+
+	size_t Count() const { return positions.size(); }
+	const soa_vec2<float>& Positions() const { return positions; }
+	const soa_vec2<float>& Velocities() const { return velocities; }	// pixels per frame
+	const soa_scalar<int>& Ids() const { return ids; }
+	const soa_scalar<int>& Ages() const { return ages; }	// frames tracked
+
+	// statistics
+	int Frames() const { return frames; }
+	int Detections() const { return detections; }
+	double AverageMs() const { return frames > 0 ? totalMs / frames : 0.0; }
+
+private:
+	void Flow(int levels);
+	void Detect(const cv::Mat& gray);
+
+private:
+	// pyramids[current] is built from the newest frame, the other one holds the previous
+	std::vector<cv::Mat> pyramids[2];
+	int current;
+	int previousLevels;
+
+	// tracks
+	soa_vec2<float> positions;
+	soa_vec2<float> velocities;
+	soa_scalar<int> ids;
+	soa_scalar<int> ages;
+	int nextId;
+
+	// scratch kept between frames so steady-state tracking does not allocate
+	soa_vec2<float> predicted;
+	std::vector<cv::Point2f> previousPoints;
+	std::vector<cv::Point2f> nextPoints;
+	std::vector<uchar> status;
+	std::vector<float> errors;
+	std::vector<cv::Point2f> corners;
+	cv::Mat mask;
+
+	int frames;
+	int detections;
+	double totalMs;
+};
@@ -0,0 +1,30 @@
+/*
+ * Content-addressed files for data derived once and reused between runs.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Cache entries are named after a 64-bit FNV-1a hash of everything they were
+// derived from, so a changed input simply misses and a stale file is never read.
+// Writes go to a temporary file renamed into place, so a crash mid-write never
+// leaves a truncated entry behind.
+namespace FileCache
+{
+	const uint64_t HASH_SEED = 14695981039346656037ULL;
+
+	// chain calls to hash several inputs: Hash(b, n, Hash(a, m))
+	uint64_t Hash(const void* data, size_t size, uint64_t seed = HASH_SEED);
+
+	// "<directory>/<prefix>_<16 hex digits><extension>"
+	std::string EntryPath(const std::string& directory, const std::string& prefix, uint64_t key, const std::string& extension);
+
+	// create 'directory' and its parents if missing
+	bool EnsureDirectory(const std::string& directory);
+
+	bool Read(const std::string& path, std::vector<unsigned char>& data);
+	bool Write(const std::string& path, const void* data, size_t size);
+}
@@ -0,0 +1,89 @@
+/*
+ * Frame-scoped arena allocator for cv::Mat temporaries.
+ */
+
+#pragma once
+
+#include <opencv2/core.hpp>
+#include <opencv2/core/bufferpool.hpp>
+
+#include <mutex>
+#include <vector>
+
+// Mats whose 'allocator' points at the arena take their buffers from one
+// preallocated bump region and their UMatData headers from a fixed pool, so
+// creating them never touches the heap. Reset() rewinds the region once per
+// frame. Every arena Mat must be released before that; Mats that live longer
+// than a frame belong on the default allocator.
+//
+// A frame that does not fit falls back to cv::fastMalloc and the region grows
+// to that frame's demand at the next Reset(), so after the first frames of a
+// stable pipeline the heap is not used at all.
+//
+// The region is exposed through cv::BufferPoolController, the same interface
+// OpenCV uses for its own buffer pools.
+class FrameArena : public cv::MatAllocator, public cv::BufferPoolController
+{
+public:
+	static const size_t DEFAULT_CAPACITY = 16 << 20;
+	static const int DEFAULT_MAX_MATS = 64;
+	static const size_t ALIGNMENT = 64;
+
+	FrameArena(size_t capacity = DEFAULT_CAPACITY, int maxMats = DEFAULT_MAX_MATS);
+	~FrameArena();
+
+	// begin a new frame. does nothing (and counts a deferred reset) while arena Mats are still alive.
+	void Reset();
+
+	// an empty Mat that will allocate from the arena
+	cv::Mat NewMat();
+
+	// heap allocations (buffers + headers) made during the last completed frame
+	size_t LastFrameHeapAllocations() const;
+	size_t TotalHeapAllocations() const;
+	size_t PeakFrameBytes() const;
+	int DeferredResets() const;
+
+	// cv::MatAllocator
+	virtual cv::UMatData* allocate(int dims, const int* sizes, int type,
+		void* data, size_t* step, int flags, cv::UMatUsageFlags usageFlags) const;
+	virtual bool allocate(cv::UMatData* data, int accessFlags, cv::UMatUsageFlags usageFlags) const;
+	virtual void deallocate(cv::UMatData* data) const;
+	virtual cv::BufferPoolController* getBufferPoolController(const char* id = NULL) const;
+
+	// cv::BufferPoolController
+	virtual size_t getReservedSize() const;
+	virtual size_t getMaxReservedSize() const;
+	virtual void setMaxReservedSize(size_t size);
+	virtual void freeAllReservedBuffers();
+
+private:
+	FrameArena(const FrameArena&);
+	FrameArena& operator=(const FrameArena&);
+
+	void AllocateRegion(size_t size);
+	void AllocatePool(int count);
+	bool InPool(const cv::UMatData* u) const;
+
+private:
+	// the MatAllocator interface is const, all bookkeeping is mutable
+	mutable std::mutex mutex;
+
+	uchar* region;
+	size_t capacity;
+	size_t maxCapacity;
+	mutable size_t offset;
+	mutable size_t frameBytes;	// demand of the current frame, including what overflowed
+
+	uchar* pool;
+	int poolSize;
+	mutable std::vector<cv::UMatData*> freeHeaders;
+
+	mutable int live;
+	mutable int frameLive;		// most arena Mats alive at once in the current frame
+	mutable size_t frameHeap;
+	size_t lastFrameHeap;
+	mutable size_t totalHeap;
+	size_t peakBytes;
+	int deferredResets;
+};
@@ -0,0 +1,94 @@
+/*
+ * Render loop pacing and frame-time measurement.
+ */
+
+#pragma once
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+#include <atomic>
+#include <chrono>
+
+enum class PacingMode
+{
+	VSync,			// swap interval 1
+	AdaptiveVSync,	// swap interval -1 (tear instead of stalling on a missed vblank), vsync if unsupported
+	FixedRate,		// no vsync, sleep until the next deadline of a fixed frame rate
+	OnDemand		// sleep in glfwWaitEvents until something marks the frame dirty
+};
+
+// rolling statistics of one timing series in milliseconds
+struct FrameTimeStat
+{
+	double last;
+	double average;
+	double worst;
+};
+
+struct FrameStats
+{
+	FrameTimeStat cpu;		// BeginFrame until just before the swap
+	FrameTimeStat gpu;		// GL_TIME_ELAPSED between BeginFrame and EndFrame, a few frames late
+	FrameTimeStat present;	// BeginFrame until glfwSwapBuffers returned
+	unsigned long long frames;
+	unsigned long long skipped;	// OnDemand wake-ups that had nothing to draw
+};
+
+// Decides when the next frame is drawn and measures what it cost.
+// The render loop is expected to look like
+//   while (running) { if (!pacer.WaitForFrame()) continue; pacer.BeginFrame(); draw; pacer.EndFrame(); }
+class FramePacer
+{
+public:
+	FramePacer();
+	~FramePacer();
+
+	// requires the window's context to be current
+	void Init(GLFWwindow* window, PacingMode mode, double targetFps);
+	void Release();
+
+	void SetMode(PacingMode mode);
+	PacingMode Mode() const { return mode.load(); }
+
+	// process window events and block as the mode requires.
+	// returns false if no frame needs to be drawn this time around.
+	bool WaitForFrame();
+
+	void BeginFrame();
+
+	// ends the GPU timer and swaps buffers
+	void EndFrame();
+
+	// request a redraw; safe to call from any thread
+	void MarkDirty();
+
+	const FrameStats& Stats() const { return stats; }
+
+private:
+	typedef std::chrono::steady_clock Clock;
+
+	void CollectGpuQueries();
+	static void Accumulate(FrameTimeStat& stat, double ms, unsigned long long count);
+
+private:
+	static const int QUERY_COUNT = 4;
+	// OnDemand never sleeps longer than this, which bounds the reaction time to anything
+	// that did not post an event
+	static constexpr double MAX_IDLE_SECONDS = 0.25;
+
+	GLFWwindow* window;
+	std::atomic<PacingMode> mode;
+	double framePeriod;
+	bool tearControl;
+
+	std::atomic<bool> dirty;
+	Clock::time_point deadline;
+	Clock::time_point frameStart;
+
+	GLuint queries[QUERY_COUNT];
+	bool queryPending[QUERY_COUNT];
+	int queryIndex;
+
+	FrameStats stats;
+};
@@ -0,0 +1,66 @@
+/*
+ * Lock-free single-producer / single-consumer ring of camera frames.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+#include <opencv2/core.hpp>
+
+// The capture thread writes frames into preallocated slots, the render thread
+// only ever takes the newest one. One slot always belongs to the consumer, so
+// the frame it is looking at can never be overwritten under its feet.
+class FrameRing
+{
+public:
+	// allocate 'capacity' slots (at least 3) of the given size and type
+	FrameRing(int capacity, cv::Size size, int type);
+
+	// producer: returns the slot to fill, or NULL if the ring is full.
+	// a successful BeginWrite must be followed by CommitWrite or CancelWrite.
+	cv::Mat* BeginWrite();
+	void CommitWrite();
+	void CancelWrite();
+
+	// producer: count a frame that was grabbed but never stored
+	void DropWrite();
+
+	// consumer: point 'frame' at the newest committed frame without copying.
+	// older pending frames are skipped and counted as dropped.
+	// returns false (and counts a stale poll) if nothing new arrived.
+	// 'frame' stays valid until the next AcquireLatest call.
+	bool AcquireLatest(cv::Mat& frame);
+
+	int Capacity() const { return (int)slots.size(); }
+	// the size the slots were allocated with. never read from a slot: the
+	// producer may reallocate or replace the one it writes at any time
+	cv::Size FrameSize() const { return frameSize; }
+
+	// frames committed by the producer
+	uint64_t Produced() const { return head.load(std::memory_order_relaxed); }
+	// frames never shown: ring full on the producer side plus frames skipped by the consumer
+	uint64_t Dropped() const { return droppedFull.load(std::memory_order_relaxed) + droppedSkipped.load(std::memory_order_relaxed); }
+	// consumer polls that found no new frame
+	uint64_t Stale() const { return stale.load(std::memory_order_relaxed); }
+
+private:
+	std::vector<cv::Mat> slots;
+	cv::Size frameSize;
+
+	// producer and consumer indices are padded apart to avoid false sharing.
+	// (plain padding instead of alignas, which 'new' does not honor before C++17)
+	char padProducer[64];
+
+	// written by the producer only
+	std::atomic<uint64_t> head;
+	std::atomic<uint64_t> droppedFull;
+	char padConsumer[64];
+
+	// written by the consumer only
+	std::atomic<uint64_t> tail;
+	std::atomic<uint64_t> droppedSkipped;
+	std::atomic<uint64_t> stale;
+};
@@ -0,0 +1,45 @@
+/*
+ * Destination for rendered frames in headless mode.
+ */
+
+#pragma once
+
+#include <functional>
+#include <string>
+
+#include <opencv2/core.hpp>
+#include <opencv2/videoio.hpp>
+
+#include "RawFrameFile.h"
+
+// Frames go to a video file (.avi/.mp4/.mkv), to an uncompressed .rawf
+// recording, to a numbered PNG sequence in a directory, or to a callback for in-process consumers. With no destination
+// at all, frames are simply discarded, which is handy for benchmarking.
+class FrameSink
+{
+public:
+	typedef std::function<void(const cv::Mat& frame, int index)> Callback;
+
+	FrameSink();
+
+	// 'path' may be empty. returns false if the destination cannot be opened.
+	bool Open(const std::string& path, double fps, cv::Size size);
+	void Close();
+
+	void SetCallback(const Callback& callback) { this->callback = callback; }
+
+	void Write(const cv::Mat& frame);
+
+	int Count() const { return count; }
+
+private:
+	static bool IsVideoPath(const std::string& path);
+
+private:
+	std::string directory;
+	cv::VideoWriter writer;
+	RawFrameWriter rawWriter;
+	double fps;
+	Callback callback;
+	int count;
+};
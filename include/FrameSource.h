@@ -0,0 +1,75 @@
+/*
+ * Where camera frames come from.
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include <opencv2/core.hpp>
+#include <opencv2/videoio.hpp>
+
+#include "RawFrameFile.h"
+
+// Grab/Retrieve mirror cv::VideoCapture so the capture thread can skip
+// decoding frames it would drop anyway.
+class FrameSource
+{
+public:
+	virtual ~FrameSource() {}
+
+	virtual bool IsOpened() const = 0;
+
+	// advance to the next frame. false at the end of the source
+	virtual bool Grab() = 0;
+	// the grabbed frame. may point into memory owned by the source
+	virtual bool Retrieve(cv::Mat& frame) = 0;
+
+	bool Read(cv::Mat& frame) { return Grab() && Retrieve(frame); }
+
+	// (0, 0) / 0 if unknown
+	virtual cv::Size FrameSize() const = 0;
+	virtual double Fps() const = 0;
+
+	// a .rawf recording, any other video file, or the default camera if 'path' is empty.
+	// returns NULL (after printing why) if nothing could be opened.
+	static std::unique_ptr<FrameSource> Open(const std::string& path, cv::Size cameraSize, double cameraFps);
+};
+
+// video files and cameras through cv::VideoCapture
+class VideoCaptureSource : public FrameSource
+{
+public:
+	bool OpenFile(const std::string& path);
+	bool OpenCamera(int index, cv::Size size, double fps);
+
+	virtual bool IsOpened() const { return capture.isOpened(); }
+	virtual bool Grab() { return capture.grab(); }
+	virtual bool Retrieve(cv::Mat& frame) { return capture.retrieve(frame); }
+	virtual cv::Size FrameSize() const;
+	virtual double Fps() const;
+
+private:
+	cv::VideoCapture capture;
+};
+
+// replay of a RawFrameWriter recording: frames are Mat headers over the
+// mapped file, so retrieving one copies nothing
+class RawFileSource : public FrameSource
+{
+public:
+	RawFileSource();
+
+	bool Open(const std::string& path);
+
+	virtual bool IsOpened() const { return reader.IsOpen(); }
+	virtual bool Grab();
+	virtual bool Retrieve(cv::Mat& frame);
+	virtual cv::Size FrameSize() const { return reader.Size(); }
+	virtual double Fps() const { return reader.Fps(); }
+
+private:
+	RawFrameReader reader;
+	int current;
+};
@@ -0,0 +1,54 @@
+/*
+ * Camera frame upload into an OpenGL texture through a persistent-mapped PBO ring.
+ */
+
+#pragma once
+
+#include <glad/glad.h>
+
+#include <opencv2/core.hpp>
+
+// With GL_ARB_buffer_storage, each frame costs one memcpy into a persistently
+// mapped pixel-unpack buffer; glTexSubImage2D then sources from the buffer and
+// the copy to the texture happens asynchronously on the GPU. Fences keep the
+// CPU from overwriting a buffer the GPU is still reading.
+// Without the extension, frames go through plain glTexSubImage2D.
+class FrameUploader
+{
+public:
+	FrameUploader();
+	~FrameUploader();
+
+	// requires a current GL context. the texture itself is created on the first Upload.
+	void Init();
+	void Release();
+
+	// copy an 8-bit frame (1, 3 or 4 channels, BGR order) into the texture.
+	// the texture is (re)allocated whenever the frame size or format changes.
+	void Upload(const cv::Mat& frame);
+
+	GLuint Texture() const { return texture; }
+	cv::Size Size() const { return size; }
+	bool IsPersistent() const { return persistent; }
+
+private:
+	bool Allocate(cv::Size frameSize, int frameType);
+	void ReleaseBuffers();
+	void UploadPersistent(const cv::Mat& frame);
+	void UploadDirect(const cv::Mat& frame);
+
+private:
+	static const int RING_SIZE = 3;
+
+	bool persistent;
+	GLuint texture;
+	GLuint pbo[RING_SIZE];
+	void* mapped[RING_SIZE];
+	GLsync fences[RING_SIZE];
+	int next;
+
+	cv::Size size;
+	int type;
+	GLenum format;
+	size_t rowBytes;
+};
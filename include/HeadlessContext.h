@@ -0,0 +1,41 @@
+/*
+ * OpenGL context without a visible window, for batch processing.
+ */
+
+#pragma once
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+// On Linux a surfaceless EGL context is tried first (EGL_MESA_platform_surfaceless),
+// which needs neither a display server nor a GPU: Mesa's llvmpipe is enough.
+// Everywhere else, or if EGL is unavailable, an invisible GLFW window provides the context.
+// Either way nothing is ever presented; rendering goes to an FBO.
+class HeadlessContext
+{
+public:
+	HeadlessContext();
+	~HeadlessContext();
+
+	// create a 3.3 core context, make it current and load GL through glad
+	// (lazily bound entry points if 'lazyGL' is set)
+	bool Create(bool lazyGL);
+	void Destroy();
+
+	bool IsEGL() const { return eglContext != NULL; }
+
+	// the hidden GLFW window, or NULL when running on EGL
+	GLFWwindow* Window() const { return window; }
+
+private:
+	bool CreateEGL();
+	bool CreateGLFW();
+	bool LoadGL(GLADloadproc load);
+
+private:
+	void* eglLibrary;
+	void* eglDisplay;
+	void* eglContext;
+	GLFWwindow* window;
+	bool lazyGL;
+};
@@ -0,0 +1,143 @@
+/*
+ * Window input delivered as queued events and mapped to actions.
+ */
+
+#pragma once
+
+#include <GLFW/glfw3.h>
+#include <glm/glm.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+enum class InputAction
+{
+	None,
+	Quit,
+	WriteTrace,		// write the Chrome trace recorded so far
+	CyclePacing,	// vsync -> adaptive -> fixed -> on demand
+	ToggleOverlays	// marker cubes and feature squares
+};
+
+struct KeyBinding
+{
+	int code;		// GLFW_KEY_* or GLFW_MOUSE_BUTTON_*
+	int mods;		// GLFW_MOD_SHIFT | CONTROL | ALT | SUPER, matched exactly
+	bool mouse;
+	InputAction action;
+};
+
+struct InputEvent
+{
+	enum Type
+	{
+		Key,
+		MouseButton,
+		Resize,		// framebuffer size in x, y
+		Refresh		// window contents damaged
+	};
+
+	Type type;
+	int code;
+	int action;		// GLFW_PRESS, GLFW_RELEASE or GLFW_REPEAT
+	int mods;
+	double x, y;
+};
+
+// everything that happened since the previous Drain
+struct InputFrame
+{
+	std::vector<InputAction> actions;	// in the order their presses arrived
+	glm::dvec2 cursor;					// latest position in window coordinates
+	glm::dvec2 cursorDelta;
+	glm::dvec2 scroll;
+	bool resized;
+	int width, height;					// framebuffer size, when resized
+	bool damaged;						// resized or needing a redraw
+};
+
+// GLFW callbacks only push events into a lock-free single-producer ring; the
+// render loop drains it once per frame and looks bound presses up in the
+// action table, so no key is polled and presses shorter than a frame are not
+// lost. Events that change what is on screen (bound presses, resizes, damage)
+// also call the wake callback, which lets an on-demand loop sleep in
+// glfwWaitEventsTimeout through everything else, e.g. plain cursor motion.
+// Cursor motion and scrolling never enter the ring: the callbacks keep the
+// latest position and add up the deltas, so they cannot crowd out presses.
+// The last RESERVED_SLOTS of the ring only take bound presses, resizes and
+// damage; when even those are full, the loop is woken to drain it.
+// GLFW runs callbacks only inside glfwPollEvents / glfwWaitEventsTimeout on
+// the main thread, which is also the one calling Drain: producer and consumer
+// are the same thread. The ring's atomics only keep it correct should events
+// ever be pushed from elsewhere; the coalesced motion state has no such guard.
+class InputSystem
+{
+public:
+	static const int QUEUE_SIZE = 256;	// power of two
+	static const int RESERVED_SLOTS = 64;
+
+	InputSystem();
+	~InputSystem();
+
+	// install the callbacks. takes over the window's user pointer.
+	void Attach(GLFWwindow* window);
+	void Detach();
+
+	// Escape quits, F12 writes the trace, P cycles pacing, O toggles overlays
+	void BindDefaults();
+	void Bind(const KeyBinding& binding);
+
+	// "KEY=ACTION", e.g. "ctrl+F5=pacing" or "mouse2=overlays". key names are
+	// letters, digits, F1-F25, escape, space, enter, tab, backspace, left,
+	// right, up, down and mouse1-mouse8; actions quit, trace, pacing, overlays, none.
+	static bool ParseBinding(const std::string& spec, KeyBinding& binding);
+
+	// called from inside event processing; must be cheap
+	void SetWakeCallback(const std::function<void()>& callback) { wake = callback; }
+
+	// move queued events into 'frame'
+	void Drain(InputFrame& frame);
+
+	// statistics
+	uint64_t Events() const { return events; }
+	uint64_t Overflows() const { return overflows.load(std::memory_order_relaxed); }
+
+private:
+	void Push(const InputEvent& event);
+	void Move(double x, double y);
+	void Scroll(double x, double y);
+	InputAction Lookup(int code, int mods, bool mouse) const;
+
+	static int BindingKey(int code, int mods, bool mouse);
+
+	static void KeyCallback(GLFWwindow* window, int key, int scancode, int action, int mods);
+	static void MouseButtonCallback(GLFWwindow* window, int button, int action, int mods);
+	static void CursorCallback(GLFWwindow* window, double x, double y);
+	static void ScrollCallback(GLFWwindow* window, double x, double y);
+	static void FramebufferSizeCallback(GLFWwindow* window, int width, int height);
+	static void RefreshCallback(GLFWwindow* window);
+
+private:
+	GLFWwindow* window;
+	std::unordered_map<int, InputAction> table;
+	std::function<void()> wake;
+
+	InputEvent queue[QUEUE_SIZE];
+	std::atomic<uint32_t> head;		// written by the producer only
+	std::atomic<uint32_t> tail;		// written by the consumer only
+	std::atomic<uint64_t> overflows;
+
+	// coalesced cursor and scroll input, reset by every Drain
+	glm::dvec2 cursor;
+	bool cursorKnown;
+	glm::dvec2 cursorDelta;
+	glm::dvec2 scroll;
+	uint64_t motionEvents;
+
+	// consumer state
+	uint64_t events;
+};
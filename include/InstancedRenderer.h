@@ -0,0 +1,81 @@
+/*
+ * One draw call for every overlay object sharing a mesh.
+ */
+
+#pragma once
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+
+#include <vector>
+
+#include "CommandBuffer.h"
+#include "Culling.h"
+#include "Shader.h"
+#include "ShaderManager.h"
+
+enum class InstanceMesh
+{
+	Cube,	// unit cube standing on the z = 0 plane, x/y in [-0.5, 0.5], z in [0, 1]
+	Quad	// unit square in the z = 0 plane, x/y in [-0.5, 0.5]
+};
+
+// Objects are collected between Begin and Record as model matrices plus colors.
+// Record first drops objects outside the view frustum, using a hierarchy built
+// over their world bounds, then multiplies the remaining models by the
+// view-projection matrix in one batched SIMD pass (MultiplyMatrices) straight
+// into the upload of a command buffer, followed by the colors and a single
+// instanced draw, instead of one uniform upload and draw call per object.
+// Recording makes no GL calls, so it may run on a render worker; only Init and
+// Release need the context.
+class InstancedRenderer
+{
+public:
+	InstancedRenderer();
+	~InstancedRenderer();
+
+	// requires a current GL context. the program may finish compiling later;
+	// Record does nothing until it has
+	bool Init(InstanceMesh mesh, ShaderManager& shaders);
+	void Release();
+
+	void Begin(const glm::mat4& viewProjection);
+	void Add(const glm::mat4& model, const glm::vec4& color);
+	void Record(CommandBuffer& commands);
+
+	size_t Count() const { return models.size(); }
+
+	// statistics
+	int DrawCalls() const { return drawCalls; }
+	size_t Instances() const { return instances; }
+	size_t Culled() const { return culled; }
+
+private:
+	void CreateMesh(InstanceMesh mesh);
+	size_t CullInstances();
+
+private:
+	Shader shader;
+	GLuint vao;
+	GLuint vertexBuffer;
+	GLuint indexBuffer;
+	GLuint mvpBuffer;
+	GLuint colorBuffer;
+	GLsizei indexCount;
+	BoundingBox meshBounds;
+
+	glm::mat4 viewProjection;
+	std::vector<glm::mat4> models;
+	std::vector<glm::vec4> colors;
+
+	// visible instances, compacted before the upload
+	std::vector<BoundingBox> worldBounds;
+	BoundingVolumeHierarchy hierarchy;
+	std::vector<int> visible;
+	std::vector<glm::mat4> visibleModels;
+	std::vector<glm::vec4> visibleColors;
+
+	int drawCalls;
+	size_t instances;
+	size_t culled;
+};
@@ -0,0 +1,104 @@
+/*
+ * ArUco marker detection with Kalman-predicted regions of interest.
+ */
+
+#pragma once
+
+#include <opencv2/core.hpp>
+#include <opencv2/aruco.hpp>
+#include <opencv2/video/tracking.hpp>
+
+#include <vector>
+
+#include "CameraCalibration.h"
+
+struct TrackedMarker
+{
+	int id;
+	std::vector<cv::Point2f> corners;	// image corners, predicted when not detected
+	cv::Vec3d rvec, tvec;				// filtered marker pose in camera space
+	bool detected;						// measured this frame, otherwise a prediction
+};
+
+// Every known marker carries a constant-velocity Kalman filter over its pose.
+// In ROI mode the predicted pose is projected into the frame and detection only
+// runs inside padded rectangles around those projections. A full-frame scan
+// still happens every FULL_SCAN_INTERVAL frames to pick up new markers, and
+// right after a tracked marker was not found in its ROI.
+// Full-frame scans are split into overlapping tiles detected on all cores. A
+// marker is kept only by the tile whose core (the tile without its overlap)
+// contains its center, so every marker is reported once. Tiles only accept
+// markers small enough to fit in their overlap; larger ones are found in a
+// downscaled frame and confirmed at full resolution. Perimeter limits are
+// passed in frame pixels everywhere, so the result is that of one serial scan.
+class MarkerTracker
+{
+public:
+	static const int FULL_SCAN_INTERVAL = 15;
+	static const int MAX_MISSED_FRAMES = 5;		// predictions kept alive without a measurement
+	static const int MIN_ROI_PADDING = 16;		// pixels
+	static const int MIN_TILE_SIZE = 320;		// pixels of tile core, smaller frames are scanned whole
+	static const int MIN_COARSE_PERIMETER = 80;	// contour points a marker keeps in the downscaled pass
+	static const cv::aruco::PREDEFINED_DICTIONARY_NAME DEFAULT_DICTIONARY = cv::aruco::DICT_6X6_250;
+
+	MarkerTracker();
+
+	// 'markerLength' is the printed side length in the unit tvec should use.
+	// 'roiTracking' off runs a full-frame scan every frame.
+	void Init(const CameraCalibration& calibration, float markerLength, bool roiTracking);
+	bool IsInitialized() const { return !dictionary.empty(); }
+
+	// off scans whole frames serially, the reference tiled scans must match
+	void SetTiledScan(bool tiled) { tiledScan = tiled; }
+
+	// detect and track on a gray frame
+	void Process(const cv::Mat& gray);
+
+	const std::vector<TrackedMarker>& Markers() const { return markers; }
+
+	// statistics
+	int Frames() const { return frames; }
+	int FullScans() const { return fullScans; }
+	int TilesPerScan() const { return tilesPerScan; }
+	double AverageDetectMs() const { return frames > 0 ? detectMs / frames : 0.0; }
+	double AverageScannedFraction() const { return frames > 0 ? scannedFraction / frames : 0.0; }
+
+private:
+	struct Track
+	{
+		int id;
+		cv::KalmanFilter filter;
+		int missed;
+		TrackedMarker marker;
+	};
+
+	void InitFilter(cv::KalmanFilter& filter, const cv::Vec3d& rvec, const cv::Vec3d& tvec) const;
+	bool PredictRois(cv::Size frameSize, std::vector<cv::Rect>& rois);
+	void FramePerimeters(cv::Size frameSize, int& minPerimeter, int& maxPerimeter) const;
+	cv::Ptr<cv::aruco::DetectorParameters> ParametersFor(cv::Size regionSize, int minPerimeter, int maxPerimeter) const;
+	void Detect(const cv::Mat& gray, const cv::Rect& roi, int minPerimeter, int maxPerimeter,
+		std::vector<std::vector<cv::Point2f> >& corners, std::vector<int>& ids) const;
+	void DetectTiled(const cv::Mat& gray, std::vector<std::vector<cv::Point2f> >& corners, std::vector<int>& ids);
+	int TileOverlap(cv::Size frameSize) const;
+	void Update(const std::vector<std::vector<cv::Point2f> >& corners, const std::vector<int>& ids);
+
+private:
+	CameraCalibration calibration;
+	float markerLength;
+	bool roiTracking;
+	bool tiledScan;
+	cv::Ptr<cv::aruco::Dictionary> dictionary;
+	cv::Ptr<cv::aruco::DetectorParameters> parameters;
+	std::vector<cv::Point3f> objectCorners;
+
+	std::vector<Track> tracks;
+	std::vector<TrackedMarker> markers;
+	bool lostTrack;
+	int framesSinceScan;
+
+	int frames;
+	int fullScans;
+	int tilesPerScan;
+	double detectMs;
+	double scannedFraction;
+};
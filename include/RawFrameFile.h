@@ -0,0 +1,100 @@
+/*
+ * Uncompressed frame container for bit-exact replay.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include <opencv2/core.hpp>
+
+// Layout of a .rawf file: a fixed header, then every frame as continuous rows
+// starting on a 4 KB boundary, then an index of (offset, timestamp) pairs the
+// header points to. All frames share size and type.
+// The reader maps the whole file and hands out Mat headers over the mapped
+// pages, so replay costs no decode and no copy; the mapping is copy-on-write,
+// writing to a replayed frame never touches the file.
+// There is no compression: frames are read at memory (or page cache) speed.
+struct RawFrameHeader
+{
+	char magic[4];			// "RAWF"
+	uint32_t version;
+	int32_t width;
+	int32_t height;
+	int32_t type;			// OpenCV type, e.g. CV_8UC3
+	int32_t reserved;
+	double fps;
+	uint64_t frameCount;
+	uint64_t indexOffset;	// 0 while the file is still being written
+};
+
+struct RawFrameIndexEntry
+{
+	uint64_t offset;
+	double timestamp;		// seconds since the first frame
+};
+
+class RawFrameWriter
+{
+public:
+	static const size_t FRAME_ALIGNMENT = 4096;
+
+	RawFrameWriter();
+	~RawFrameWriter();
+
+	bool Open(const std::string& path, cv::Size size, int type, double fps);
+
+	// write the index, patch the header and close. a file that was never
+	// closed has no index and is rejected by the reader
+	bool Close();
+
+	bool IsOpen() const { return file != NULL; }
+
+	// 'frame' must match the size and type given to Open
+	bool Write(const cv::Mat& frame, double timestamp);
+
+	static bool IsRawPath(const std::string& path);
+
+private:
+	bool Pad(uint64_t to);
+
+private:
+	FILE* file;
+	RawFrameHeader header;
+	std::vector<RawFrameIndexEntry> index;
+	uint64_t offset;
+};
+
+class RawFrameReader
+{
+public:
+	RawFrameReader();
+	~RawFrameReader();
+
+	bool Open(const std::string& path);
+	void Close();
+
+	bool IsOpen() const { return mapped != NULL; }
+	int Count() const { return (int)header.frameCount; }
+	cv::Size Size() const { return cv::Size(header.width, header.height); }
+	int Type() const { return header.type; }
+	double Fps() const { return header.fps; }
+
+	// header over the mapped frame, valid until Close
+	cv::Mat Frame(int i) const;
+	double Timestamp(int i) const { return index[i].timestamp; }
+
+private:
+	bool Map(const std::string& path);
+	void Unmap();
+
+private:
+	unsigned char* mapped;
+	uint64_t mappedSize;
+	void* mapping;			// Windows file mapping handle
+	RawFrameHeader header;
+	const RawFrameIndexEntry* index;
+};
@@ -0,0 +1,57 @@
+/*
+ * Render work recorded on worker threads, submitted by the GL thread.
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "CommandBuffer.h"
+
+// Record hands a job to the workers, which run it into a command buffer of its
+// own while the GL thread goes on issuing other calls. Submit waits for the
+// jobs and replays their buffers in the order they were recorded, so results
+// are the same as drawing directly, whichever worker finished first.
+// Jobs must not call GL. Without workers they run inside Record.
+class RenderQueue
+{
+public:
+	RenderQueue();
+	~RenderQueue();
+
+	void Start(int workers);
+	void Stop();
+
+	// GL thread only
+	void Record(const std::function<void(CommandBuffer&)>& job);
+	void Submit();
+
+	// statistics
+	uint64_t Replayed() const { return replayer.Replayed(); }
+	uint64_t Filtered() const { return replayer.Filtered(); }
+	size_t PeakBytes() const { return peakBytes; }
+
+private:
+	void Run();
+
+private:
+	std::vector<std::thread> workers;
+
+	// per frame: jobs[i] records into buffers[i]. buffers are kept across frames
+	mutable std::mutex mutex;
+	std::condition_variable wake;
+	std::condition_variable done;
+	std::vector<std::function<void(CommandBuffer&)> > jobs;
+	std::vector<std::unique_ptr<CommandBuffer> > buffers;
+	size_t nextJob;
+	size_t finishedJobs;
+	bool stopping;
+
+	CommandReplayer replayer;
+	size_t peakBytes;
+};
@@ -0,0 +1,33 @@
+/*
+ * Offscreen framebuffer with color and depth attachments.
+ */
+
+#pragma once
+
+#include <glad/glad.h>
+
+class RenderTarget
+{
+public:
+	RenderTarget();
+	~RenderTarget();
+
+	// allocate an RGBA8 color + 24 bit depth framebuffer. returns false if incomplete.
+	bool Create(int width, int height);
+	void Release();
+
+	// bind for drawing and set the viewport to cover the whole target
+	void Bind() const;
+	static void BindDefault();
+
+	GLuint Framebuffer() const { return fbo; }
+	int Width() const { return width; }
+	int Height() const { return height; }
+
+private:
+	GLuint fbo;
+	GLuint color;
+	GLuint depth;
+	int width;
+	int height;
+};
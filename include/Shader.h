@@ -0,0 +1,44 @@
+/*
+ * Minimal GLSL program wrapper.
+ */
+
+#pragma once
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+
+#include <string>
+
+class Shader
+{
+public:
+	Shader();
+	~Shader();
+
+	// compile and link a program from vertex and fragment sources.
+	// returns false (and prints the info log) on failure.
+	bool Build(const char* vertexSource, const char* fragmentSource);
+	void Release();
+
+	// take ownership of an already linked program
+	void Adopt(GLuint program);
+
+	void Use() const { glUseProgram(ID); }
+	bool IsValid() const { return ID != 0; }
+
+	void SetInt(const std::string& name, int value) const;
+	void SetFloat(const std::string& name, float value) const;
+	void SetVec2(const std::string& name, const glm::vec2& value) const;
+	void SetMat4(const std::string& name, const glm::mat4& value) const;
+
+public:
+	GLuint ID;
+
+	// compile and link without a Shader object, e.g. on another context.
+	// 'retrievable' asks the driver to keep the binary for glGetProgramBinary.
+	// returns 0 (and prints the info log) on failure.
+	static GLuint Link(const char* vertexSource, const char* fragmentSource, bool retrievable);
+
+private:
+	static GLuint CompileStage(GLenum type, const char* source);
+};
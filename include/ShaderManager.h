@@ -0,0 +1,96 @@
+/*
+ * Shader programs served from a binary cache or compiled in the background.
+ */
+
+#pragma once
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Shader.h"
+
+// A program linked once is saved with glGetProgramBinary under a key made of
+// its sources, the driver's vendor/renderer/version strings and the GL version
+// glad reported, so any driver or source change misses the cache instead of
+// loading a stale binary. A cache hit costs one glProgramBinary call.
+// Misses are compiled on a hidden window whose context shares objects with
+// the main one, on its own thread: the render loop keeps drawing (without
+// the pending programs) and Update() hands finished programs over once their
+// fence has signaled. Without a window to share with, misses compile in place.
+class ShaderManager
+{
+public:
+	ShaderManager();
+	~ShaderManager();
+
+	// requires the main context to be current. 'shareWindow' may be NULL to
+	// compile synchronously, 'cacheDirectory' empty to disable the cache
+	void Init(GLFWwindow* shareWindow, const std::string& cacheDirectory);
+
+	// stop the compile thread. requires the main context to be current
+	void Release();
+
+	// fill 'shader' from the cache, or compile it: in place, or in the
+	// background when there is a shared context. 'shader' must outlive the
+	// manager or its Release. returns false if a synchronous build failed.
+	bool Build(Shader& shader, const char* vertexSource, const char* fragmentSource);
+
+	// main thread, once per frame: publish programs finished in the background
+	void Update();
+
+	bool IsPending() const;
+
+	// statistics
+	int CacheHits() const { return cacheHits; }
+	int CacheMisses() const { return cacheMisses; }
+	int BackgroundBuilds() const { return backgroundBuilds; }
+	double LoadMs() const { return loadMs; }	// time spent restoring binaries
+
+private:
+	struct Job
+	{
+		Shader* target;
+		std::string vertexSource;
+		std::string fragmentSource;
+		uint64_t key;
+	};
+
+	struct Result
+	{
+		Shader* target;
+		GLuint program;
+		GLsync fence;
+	};
+
+	uint64_t Key(const char* vertexSource, const char* fragmentSource) const;
+	GLuint LoadBinary(uint64_t key);
+	void SaveBinary(uint64_t key, GLuint program);
+	void Run();
+
+private:
+	std::string cacheDirectory;
+	bool binarySupported;
+	uint64_t driverKey;
+
+	GLFWwindow* compileWindow;
+	std::thread worker;
+	mutable std::mutex mutex;
+	std::condition_variable wake;
+	std::deque<Job> jobs;
+	std::vector<Result> results;
+	int inFlight;
+	bool stopping;
+
+	int cacheHits;
+	int cacheMisses;
+	int backgroundBuilds;
+	double loadMs;
+};
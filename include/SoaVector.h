@@ -0,0 +1,557 @@
+/*
+ * Structure-of-arrays containers for glm vectors.
+ */
+
+#pragma once
+
+#include <glm/glm.hpp>
+#include <glm/simd/geometric.h>
+
+#include <opencv2/core/cvstd.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+// soa_vec2<T> / soa_vec3<T> keep one contiguous stream per component instead of
+// an array of glm::vec. The streams are 64 byte aligned and padded to a whole
+// number of cache lines, so the float kernels below always run full width over
+// aligned loads without a remainder loop. Padding lanes hold garbage after an
+// operation and are never exposed through size().
+namespace soa_detail
+{
+	// elements per padded block, 64 bytes worth of T
+	template <typename T>
+	inline size_t PaddedSize(size_t n)
+	{
+		const size_t block = std::max<size_t>(1, 64 / sizeof(T));
+		return (n + block - 1) / block * block;
+	}
+
+	// ---------------------------------------------------------------- generic
+
+	template <typename T>
+	inline void Add(const T* a, const T* b, T* out, size_t n)
+	{
+		for (size_t i = 0; i < n; i++)
+			out[i] = a[i] + b[i];
+	}
+
+	template <typename T>
+	inline void Sub(const T* a, const T* b, T* out, size_t n)
+	{
+		for (size_t i = 0; i < n; i++)
+			out[i] = a[i] - b[i];
+	}
+
+	template <typename T>
+	inline void Mul(const T* a, const T* b, T* out, size_t n)
+	{
+		for (size_t i = 0; i < n; i++)
+			out[i] = a[i] * b[i];
+	}
+
+	template <typename T>
+	inline void Scale(const T* a, T s, T* out, size_t n)
+	{
+		for (size_t i = 0; i < n; i++)
+			out[i] = a[i] * s;
+	}
+
+	// out = a.x * b.x + a.y * b.y (+ a.z * b.z when az is not NULL)
+	template <typename T>
+	inline void Dot(const T* ax, const T* ay, const T* az, const T* bx, const T* by, const T* bz, T* out, size_t n)
+	{
+		for (size_t i = 0; i < n; i++)
+			out[i] = ax[i] * bx[i] + ay[i] * by[i] + (az ? az[i] * bz[i] : T(0));
+	}
+
+	template <typename T>
+	inline void Cross(const T* ax, const T* ay, const T* az, const T* bx, const T* by, const T* bz,
+		T* ox, T* oy, T* oz, size_t n)
+	{
+		for (size_t i = 0; i < n; i++)
+		{
+			const T x = ay[i] * bz[i] - az[i] * by[i];
+			const T y = az[i] * bx[i] - ax[i] * bz[i];
+			const T z = ax[i] * by[i] - ay[i] * bx[i];
+			ox[i] = x; oy[i] = y; oz[i] = z;
+		}
+	}
+
+	template <typename T>
+	inline void Length(const T* x, const T* y, const T* z, T* out, size_t n)
+	{
+		for (size_t i = 0; i < n; i++)
+			out[i] = std::sqrt(x[i] * x[i] + y[i] * y[i] + (z ? z[i] * z[i] : T(0)));
+	}
+
+	template <typename T>
+	inline void Normalize(const T* x, const T* y, const T* z, T* ox, T* oy, T* oz, size_t n)
+	{
+		for (size_t i = 0; i < n; i++)
+		{
+			const T inv = T(1) / std::sqrt(x[i] * x[i] + y[i] * y[i] + (z ? z[i] * z[i] : T(0)));
+			ox[i] = x[i] * inv;
+			oy[i] = y[i] * inv;
+			if (z)
+				oz[i] = z[i] * inv;
+		}
+	}
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	// ---------------------------------------------------------------- float, 4 lanes
+	// n is always padded here, see PaddedSize
+
+	inline void Add(const float* a, const float* b, float* out, size_t n)
+	{
+		for (size_t i = 0; i < n; i += 4)
+			_mm_store_ps(out + i, glm_vec4_add(_mm_load_ps(a + i), _mm_load_ps(b + i)));
+	}
+
+	inline void Sub(const float* a, const float* b, float* out, size_t n)
+	{
+		for (size_t i = 0; i < n; i += 4)
+			_mm_store_ps(out + i, glm_vec4_sub(_mm_load_ps(a + i), _mm_load_ps(b + i)));
+	}
+
+	inline void Mul(const float* a, const float* b, float* out, size_t n)
+	{
+		for (size_t i = 0; i < n; i += 4)
+			_mm_store_ps(out + i, glm_vec4_mul(_mm_load_ps(a + i), _mm_load_ps(b + i)));
+	}
+
+	inline void Scale(const float* a, float s, float* out, size_t n)
+	{
+		const glm_vec4 vs = _mm_set1_ps(s);
+		for (size_t i = 0; i < n; i += 4)
+			_mm_store_ps(out + i, glm_vec4_mul(_mm_load_ps(a + i), vs));
+	}
+
+	inline glm_vec4 Dot4(glm_vec4 ax, glm_vec4 ay, glm_vec4 bx, glm_vec4 by)
+	{
+		return glm_vec4_fma(ax, bx, glm_vec4_mul(ay, by));
+	}
+
+	inline void Dot(const float* ax, const float* ay, const float* az, const float* bx, const float* by, const float* bz, float* out, size_t n)
+	{
+		for (size_t i = 0; i < n; i += 4)
+		{
+			glm_vec4 d = Dot4(_mm_load_ps(ax + i), _mm_load_ps(ay + i), _mm_load_ps(bx + i), _mm_load_ps(by + i));
+			if (az)
+				d = glm_vec4_fma(_mm_load_ps(az + i), _mm_load_ps(bz + i), d);
+			_mm_store_ps(out + i, d);
+		}
+	}
+
+	inline void Cross(const float* ax, const float* ay, const float* az, const float* bx, const float* by, const float* bz,
+		float* ox, float* oy, float* oz, size_t n)
+	{
+		for (size_t i = 0; i < n; i += 4)
+		{
+			const glm_vec4 x1 = _mm_load_ps(ax + i), y1 = _mm_load_ps(ay + i), z1 = _mm_load_ps(az + i);
+			const glm_vec4 x2 = _mm_load_ps(bx + i), y2 = _mm_load_ps(by + i), z2 = _mm_load_ps(bz + i);
+			const glm_vec4 x = glm_vec4_sub(glm_vec4_mul(y1, z2), glm_vec4_mul(z1, y2));
+			const glm_vec4 y = glm_vec4_sub(glm_vec4_mul(z1, x2), glm_vec4_mul(x1, z2));
+			const glm_vec4 z = glm_vec4_sub(glm_vec4_mul(x1, y2), glm_vec4_mul(y1, x2));
+			_mm_store_ps(ox + i, x);
+			_mm_store_ps(oy + i, y);
+			_mm_store_ps(oz + i, z);
+		}
+	}
+
+	inline void Length(const float* x, const float* y, const float* z, float* out, size_t n)
+	{
+		for (size_t i = 0; i < n; i += 4)
+		{
+			const glm_vec4 vx = _mm_load_ps(x + i), vy = _mm_load_ps(y + i);
+			glm_vec4 d = Dot4(vx, vy, vx, vy);
+			if (z)
+			{
+				const glm_vec4 vz = _mm_load_ps(z + i);
+				d = glm_vec4_fma(vz, vz, d);
+			}
+			_mm_store_ps(out + i, _mm_sqrt_ps(d));
+		}
+	}
+
+	inline void Normalize(const float* x, const float* y, const float* z, float* ox, float* oy, float* oz, size_t n)
+	{
+		const glm_vec4 one = _mm_set1_ps(1.0f);
+		for (size_t i = 0; i < n; i += 4)
+		{
+			const glm_vec4 vx = _mm_load_ps(x + i), vy = _mm_load_ps(y + i);
+			const glm_vec4 vz = z ? _mm_load_ps(z + i) : _mm_setzero_ps();
+			const glm_vec4 d = glm_vec4_fma(vz, vz, Dot4(vx, vy, vx, vy));
+			// full precision like glm::normalize, not _mm_rsqrt_ps
+			const glm_vec4 inv = glm_vec4_div(one, _mm_sqrt_ps(d));
+			_mm_store_ps(ox + i, glm_vec4_mul(vx, inv));
+			_mm_store_ps(oy + i, glm_vec4_mul(vy, inv));
+			if (z)
+				_mm_store_ps(oz + i, glm_vec4_mul(vz, inv));
+		}
+	}
+#endif
+
+	// one aligned block holding N streams of 'stride' elements each
+	template <typename T, int N>
+	class Streams
+	{
+	public:
+		Streams() : data(NULL), count(0), stride(0) {}
+		~Streams() { cv::fastFree(data); }
+
+		Streams(const Streams& other) : data(NULL), count(0), stride(0)
+		{
+			*this = other;
+		}
+
+		Streams& operator=(const Streams& other)
+		{
+			if (this != &other)
+			{
+				Reserve(other.count, false);
+				count = other.count;
+				for (int c = 0; c < N; c++)
+					memcpy(Stream(c), other.Stream(c), count * sizeof(T));
+			}
+			return *this;
+		}
+
+		Streams(Streams&& other) : data(other.data), count(other.count), stride(other.stride)
+		{
+			other.data = NULL;
+			other.count = other.stride = 0;
+		}
+
+		Streams& operator=(Streams&& other)
+		{
+			std::swap(data, other.data);
+			std::swap(count, other.count);
+			std::swap(stride, other.stride);
+			return *this;
+		}
+
+		void Reserve(size_t n, bool keep)
+		{
+			if (n <= stride)
+				return;
+			const size_t newStride = PaddedSize<T>(std::max(n, stride * 2));
+			T* newData = (T*)cv::fastMalloc(newStride * N * sizeof(T));
+			// padding is never read back, but keep it free of NaN/denormal garbage
+			memset(newData, 0, newStride * N * sizeof(T));
+			if (keep && data != NULL)
+			{
+				for (int c = 0; c < N; c++)
+					memcpy(newData + c * newStride, data + c * stride, count * sizeof(T));
+			}
+			cv::fastFree(data);
+			data = newData;
+			stride = newStride;
+		}
+
+		// grown elements start at zero, like std::vector
+		void Resize(size_t n)
+		{
+			Reserve(n, true);
+			if (n > count)
+			{
+				for (int c = 0; c < N; c++)
+					memset(Stream(c) + count, 0, (n - count) * sizeof(T));
+			}
+			count = n;
+		}
+
+		T* Stream(int c) { return data + c * stride; }
+		const T* Stream(int c) const { return data + c * stride; }
+
+		size_t Size() const { return count; }
+		size_t Capacity() const { return stride; }
+
+		// element count the kernels run over
+		size_t Padded() const { return PaddedSize<T>(count); }
+
+	private:
+		T* data;
+		size_t count;
+		size_t stride;
+	};
+}
+
+template <typename T>
+class soa_vec2
+{
+public:
+	typedef glm::vec<2, T> value_type;
+
+	soa_vec2() {}
+	explicit soa_vec2(size_t n) { streams.Resize(n); }
+	explicit soa_vec2(const std::vector<value_type>& v) { assign(v); }
+
+	size_t size() const { return streams.Size(); }
+	bool empty() const { return streams.Size() == 0; }
+	void resize(size_t n) { streams.Resize(n); }
+	void reserve(size_t n) { streams.Reserve(n, true); }
+	void clear() { streams.Resize(0); }
+
+	T* x() { return streams.Stream(0); }
+	T* y() { return streams.Stream(1); }
+	const T* x() const { return streams.Stream(0); }
+	const T* y() const { return streams.Stream(1); }
+
+	value_type get(size_t i) const { return value_type(x()[i], y()[i]); }
+	void set(size_t i, const value_type& v) { x()[i] = v.x; y()[i] = v.y; }
+
+	void push_back(const value_type& v)
+	{
+		const size_t n = size();
+		streams.Resize(n + 1);
+		set(n, v);
+	}
+
+	void assign(const value_type* v, size_t n)
+	{
+		streams.Reserve(n, false);
+		streams.Resize(n);
+		T* px = x();
+		T* py = y();
+		for (size_t i = 0; i < n; i++)
+		{
+			px[i] = v[i].x;
+			py[i] = v[i].y;
+		}
+	}
+
+	void assign(const std::vector<value_type>& v) { assign(v.data(), v.size()); }
+
+	// write back as AoS, 'out' holds size() elements
+	void store(value_type* out) const
+	{
+		const T* px = x();
+		const T* py = y();
+		for (size_t i = 0; i < size(); i++)
+			out[i] = value_type(px[i], py[i]);
+	}
+
+	std::vector<value_type> to_vector() const
+	{
+		std::vector<value_type> v(size());
+		store(v.data());
+		return v;
+	}
+
+	soa_vec2& operator+=(const soa_vec2& b)
+	{
+		soa_detail::Add(x(), b.x(), x(), padded());
+		soa_detail::Add(y(), b.y(), y(), padded());
+		return *this;
+	}
+
+	soa_vec2& operator-=(const soa_vec2& b)
+	{
+		soa_detail::Sub(x(), b.x(), x(), padded());
+		soa_detail::Sub(y(), b.y(), y(), padded());
+		return *this;
+	}
+
+	// component-wise
+	soa_vec2& operator*=(const soa_vec2& b)
+	{
+		soa_detail::Mul(x(), b.x(), x(), padded());
+		soa_detail::Mul(y(), b.y(), y(), padded());
+		return *this;
+	}
+
+	soa_vec2& operator*=(T s)
+	{
+		soa_detail::Scale(x(), s, x(), padded());
+		soa_detail::Scale(y(), s, y(), padded());
+		return *this;
+	}
+
+	// element count including the padding the kernels run over
+	size_t padded() const { return streams.Padded(); }
+
+private:
+	soa_detail::Streams<T, 2> streams;
+};
+
+template <typename T>
+class soa_vec3
+{
+public:
+	typedef glm::vec<3, T> value_type;
+
+	soa_vec3() {}
+	explicit soa_vec3(size_t n) { streams.Resize(n); }
+	explicit soa_vec3(const std::vector<value_type>& v) { assign(v); }
+
+	size_t size() const { return streams.Size(); }
+	bool empty() const { return streams.Size() == 0; }
+	void resize(size_t n) { streams.Resize(n); }
+	void reserve(size_t n) { streams.Reserve(n, true); }
+	void clear() { streams.Resize(0); }
+
+	T* x() { return streams.Stream(0); }
+	T* y() { return streams.Stream(1); }
+	T* z() { return streams.Stream(2); }
+	const T* x() const { return streams.Stream(0); }
+	const T* y() const { return streams.Stream(1); }
+	const T* z() const { return streams.Stream(2); }
+
+	value_type get(size_t i) const { return value_type(x()[i], y()[i], z()[i]); }
+	void set(size_t i, const value_type& v) { x()[i] = v.x; y()[i] = v.y; z()[i] = v.z; }
+
+	void push_back(const value_type& v)
+	{
+		const size_t n = size();
+		streams.Resize(n + 1);
+		set(n, v);
+	}
+
+	void assign(const value_type* v, size_t n)
+	{
+		streams.Reserve(n, false);
+		streams.Resize(n);
+		T* px = x();
+		T* py = y();
+		T* pz = z();
+		for (size_t i = 0; i < n; i++)
+		{
+			px[i] = v[i].x;
+			py[i] = v[i].y;
+			pz[i] = v[i].z;
+		}
+	}
+
+	void assign(const std::vector<value_type>& v) { assign(v.data(), v.size()); }
+
+	// write back as AoS, 'out' holds size() elements
+	void store(value_type* out) const
+	{
+		const T* px = x();
+		const T* py = y();
+		const T* pz = z();
+		for (size_t i = 0; i < size(); i++)
+			out[i] = value_type(px[i], py[i], pz[i]);
+	}
+
+	std::vector<value_type> to_vector() const
+	{
+		std::vector<value_type> v(size());
+		store(v.data());
+		return v;
+	}
+
+	soa_vec3& operator+=(const soa_vec3& b)
+	{
+		soa_detail::Add(x(), b.x(), x(), padded());
+		soa_detail::Add(y(), b.y(), y(), padded());
+		soa_detail::Add(z(), b.z(), z(), padded());
+		return *this;
+	}
+
+	soa_vec3& operator-=(const soa_vec3& b)
+	{
+		soa_detail::Sub(x(), b.x(), x(), padded());
+		soa_detail::Sub(y(), b.y(), y(), padded());
+		soa_detail::Sub(z(), b.z(), z(), padded());
+		return *this;
+	}
+
+	// component-wise
+	soa_vec3& operator*=(const soa_vec3& b)
+	{
+		soa_detail::Mul(x(), b.x(), x(), padded());
+		soa_detail::Mul(y(), b.y(), y(), padded());
+		soa_detail::Mul(z(), b.z(), z(), padded());
+		return *this;
+	}
+
+	soa_vec3& operator*=(T s)
+	{
+		soa_detail::Scale(x(), s, x(), padded());
+		soa_detail::Scale(y(), s, y(), padded());
+		soa_detail::Scale(z(), s, z(), padded());
+		return *this;
+	}
+
+	// element count including the padding the kernels run over
+	size_t padded() const { return streams.Padded(); }
+
+private:
+	soa_detail::Streams<T, 3> streams;
+};
+
+// Free functions below mirror glm's geometric functions. Operands must have
+// the same size; results are resized to match and may alias an operand.
+// Scalar results go to a soa_scalar, a padded single stream.
+template <typename T>
+class soa_scalar
+{
+public:
+	soa_scalar() {}
+	explicit soa_scalar(size_t n) { streams.Resize(n); }
+
+	size_t size() const { return streams.Size(); }
+	void resize(size_t n) { streams.Resize(n); }
+	void reserve(size_t n) { streams.Reserve(n, true); }
+
+	T* data() { return streams.Stream(0); }
+	const T* data() const { return streams.Stream(0); }
+	T& operator[](size_t i) { return data()[i]; }
+	const T& operator[](size_t i) const { return data()[i]; }
+
+private:
+	soa_detail::Streams<T, 1> streams;
+};
+
+template <typename T>
+inline void dot(const soa_vec2<T>& a, const soa_vec2<T>& b, soa_scalar<T>& out)
+{
+	out.resize(a.size());
+	soa_detail::Dot(a.x(), a.y(), (const T*)NULL, b.x(), b.y(), (const T*)NULL, out.data(), a.padded());
+}
+
+template <typename T>
+inline void dot(const soa_vec3<T>& a, const soa_vec3<T>& b, soa_scalar<T>& out)
+{
+	out.resize(a.size());
+	soa_detail::Dot(a.x(), a.y(), a.z(), b.x(), b.y(), b.z(), out.data(), a.padded());
+}
+
+template <typename T>
+inline void cross(const soa_vec3<T>& a, const soa_vec3<T>& b, soa_vec3<T>& out)
+{
+	out.resize(a.size());
+	soa_detail::Cross(a.x(), a.y(), a.z(), b.x(), b.y(), b.z(), out.x(), out.y(), out.z(), a.padded());
+}
+
+template <typename T>
+inline void length(const soa_vec2<T>& v, soa_scalar<T>& out)
+{
+	out.resize(v.size());
+	soa_detail::Length(v.x(), v.y(), (const T*)NULL, out.data(), v.padded());
+}
+
+template <typename T>
+inline void length(const soa_vec3<T>& v, soa_scalar<T>& out)
+{
+	out.resize(v.size());
+	soa_detail::Length(v.x(), v.y(), v.z(), out.data(), v.padded());
+}
+
+template <typename T>
+inline void normalize(const soa_vec2<T>& v, soa_vec2<T>& out)
+{
+	out.resize(v.size());
+	soa_detail::Normalize(v.x(), v.y(), (const T*)NULL, out.x(), out.y(), (T*)NULL, v.padded());
+}
+
+template <typename T>
+inline void normalize(const soa_vec3<T>& v, soa_vec3<T>& out)
+{
+	out.resize(v.size());
+	soa_detail::Normalize(v.x(), v.y(), v.z(), out.x(), out.y(), out.z(), v.padded());
+}
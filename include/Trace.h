@@ -0,0 +1,96 @@
+/*
+ * Scoped timing zones written as Chrome trace JSON.
+ */
+
+#pragma once
+
+// define TRACE_OPENCV=1 to nest OpenCV's trace regions in the zones
+#ifndef TRACE_OPENCV
+#define TRACE_OPENCV 0
+#endif
+
+#if TRACE_OPENCV
+#include <opencv2/core.hpp>
+#include <opencv2/core/utils/trace.hpp>
+#endif
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+// Every thread appends finished zones to its own buffer; only the thread that
+// owns a buffer writes to it, so recording takes no lock. Buffers grow in
+// chunks published with a release store and can be read while threads keep
+// recording. While tracing is disabled a zone costs one relaxed load.
+//
+// Built with TRACE_OPENCV=1, TRACE_ZONE also opens an OpenCV trace region of
+// the same name, so with OPENCV_TRACE=1 set in the environment OpenCV's own
+// trace shows its internal regions nested inside the application's stages.
+// That region is constructed through calls into OpenCV whether or not either
+// trace is enabled, so it is off by default.
+namespace Trace
+{
+	// events kept per thread, later zones are counted as dropped
+	const size_t MAX_THREAD_EVENTS = 1 << 22;
+
+	void Enable(bool enable);
+	inline bool IsEnabled();
+
+	// shown as the thread's name in the trace viewer. 'name' must outlive the program's traces.
+	void SetThreadName(const char* name);
+
+	// write every event recorded so far, for chrome://tracing or ui.perfetto.dev
+	bool Write(const std::string& path);
+
+	size_t EventCount();
+	size_t DroppedCount();
+
+	namespace detail
+	{
+		extern std::atomic<bool> enabled;
+
+		int64_t Now();
+		void Record(const char* name, int64_t start, int64_t end);
+	}
+
+	inline bool IsEnabled()
+	{
+		return detail::enabled.load(std::memory_order_relaxed);
+	}
+
+	// 'name' must be a string literal
+	class Zone
+	{
+	public:
+		explicit Zone(const char* name)
+			: name(name), start(IsEnabled() ? detail::Now() : -1)
+		{
+		}
+
+		~Zone()
+		{
+			if (start >= 0)
+				detail::Record(name, start, detail::Now());
+		}
+
+	private:
+		Zone(const Zone&);
+		Zone& operator=(const Zone&);
+
+		const char* name;
+		int64_t start;
+	};
+}
+
+#define TRACE_CONCAT_(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_(a, b)
+
+// times the rest of the enclosing scope. at most one per line.
+#if TRACE_OPENCV
+#define TRACE_ZONE(name) \
+	const Trace::Zone TRACE_CONCAT(traceZone_, __LINE__)(name); \
+	CV_TRACE_REGION(name)
+#else
+#define TRACE_ZONE(name) \
+	const Trace::Zone TRACE_CONCAT(traceZone_, __LINE__)(name)
+#endif
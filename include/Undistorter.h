@@ -0,0 +1,59 @@
+/*
+ * Lens undistortion through precomputed lookup tables.
+ */
+
+#pragma once
+
+#include <glad/glad.h>
+
+#include <opencv2/core.hpp>
+
+#include <string>
+
+#include "CameraCalibration.h"
+
+// The initUndistortRectifyMap tables are built once per calibration in OpenCV's
+// fixed-point form (CV_16SC2 integer coordinates + CV_16UC1 interpolation
+// index) and cached on disk under a hash of the calibration. They are applied
+// either on the CPU with cv::remap, which is SIMD and multi-threaded, or on
+// the GPU as an RG16 texture of source coordinates the background shader
+// samples the camera texture through.
+class Undistorter
+{
+public:
+	Undistorter();
+	~Undistorter();
+
+	// build or load the maps for frames of calibration.imageSize.
+	// 'cacheDirectory' may be empty to always build them.
+	bool Init(const CameraCalibration& calibration, const std::string& cacheDirectory);
+	bool IsReady() const { return !map1.empty(); }
+
+	// CPU path. 'dst' keeps its allocator, so it may come from a FrameArena
+	void Apply(const cv::Mat& src, cv::Mat& dst) const;
+
+	// GPU path. requires a current GL context; the texture is made on first use.
+	// texel (x, y) holds the normalized source coordinate of output pixel (x, y),
+	// stored as (coord - LOOKUP_OFFSET) / LOOKUP_SCALE so slightly out-of-frame
+	// sources remain representable and can be blacked out.
+	GLuint LookupTexture();
+	void Release();
+
+	cv::Size Size() const { return size; }
+	bool FromCache() const { return fromCache; }
+
+	static const float LOOKUP_OFFSET;
+	static const float LOOKUP_SCALE;
+
+private:
+	static uint64_t Key(const CameraCalibration& calibration);
+	bool LoadMaps(const std::string& path);
+	void SaveMaps(const std::string& path) const;
+
+private:
+	cv::Mat map1;	// CV_16SC2
+	cv::Mat map2;	// CV_16UC1
+	cv::Size size;
+	bool fromCache;
+	GLuint lookupTexture;
+};
@@ -0,0 +1,94 @@
+/*
+ * Video recording on its own encoder thread.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <opencv2/core.hpp>
+
+#include "FrameSink.h"
+
+// what Write does when every pooled frame is queued or being encoded
+enum class OverflowPolicy
+{
+	Block,		// wait for the encoder; nothing is lost but the caller stalls
+	DropOldest,	// reuse the oldest queued frame; the recording skips ahead
+	DropNewest	// discard the frame being written
+};
+
+// Frames are copied into a fixed pool of preallocated BGR images and queued
+// for an encoder thread that writes them through a FrameSink, so the caller
+// pays one copy per frame and nothing else. BeginWrite/CommitWrite let the
+// caller fill a pooled frame directly, e.g. from glReadPixels, which saves
+// even that copy. Frames with rows bottom-up (as GL reads them) are flipped on
+// the encoder thread.
+class VideoRecorder
+{
+public:
+	static const int DEFAULT_QUEUE_SIZE = 8;
+
+	VideoRecorder();
+	~VideoRecorder();
+
+	// 'path' as for FrameSink::Open. the pool holds 'queueSize' queued frames
+	// plus the one being encoded.
+	bool Open(const std::string& path, double fps, cv::Size size, OverflowPolicy policy,
+		bool bottomUp = false, int queueSize = DEFAULT_QUEUE_SIZE);
+
+	// encode everything still queued, then stop the encoder thread
+	void Close();
+
+	bool IsOpen() const { return worker.joinable(); }
+	cv::Size Size() const { return size; }
+
+	// copy 'frame' (CV_8UC3 of Size()) into the queue. returns false if it was dropped
+	bool Write(const cv::Mat& frame);
+
+	// single producer: get a pooled CV_8UC3 frame of Size() to fill, or NULL if
+	// it was dropped. must be followed by CommitWrite or CancelWrite.
+	cv::Mat* BeginWrite();
+	void CommitWrite();
+	void CancelWrite();
+
+	// count a frame that could not be recorded at all (e.g. wrong size)
+	void DropWrite() { dropped.fetch_add(1, std::memory_order_relaxed); }
+
+	// counters
+	uint64_t Written() const { return written.load(std::memory_order_relaxed); }
+	uint64_t Dropped() const { return dropped.load(std::memory_order_relaxed); }
+	int QueueDepth() const;
+	int MaxQueueDepth() const;
+
+private:
+	void Run();
+
+private:
+	FrameSink sink;
+	cv::Size size;
+	OverflowPolicy policy;
+	bool bottomUp;
+
+	std::vector<cv::Mat> pool;
+	std::vector<int> freeSlots;
+	std::vector<int> queue;		// ring of slot indices, oldest at queueHead
+	int queueHead;
+	int queueCount;
+	int maxQueueCount;
+	int writing;				// slot between BeginWrite and CommitWrite, -1 if none
+
+	mutable std::mutex mutex;
+	std::condition_variable queued;		// encoder waits for frames
+	std::condition_variable released;	// blocked writers wait for free slots
+	bool stopping;
+	std::thread worker;
+
+	std::atomic<uint64_t> written;
+	std::atomic<uint64_t> dropped;
+};
@@ -92,6 +92,23 @@ GLAPI int gladLoadGL(void);
 
 GLAPI int gladLoadGLLoader(GLADloadproc);
 
+/* query an extension of the current context; only valid after a successful load */
+GLAPI int gladHasExtension(const char *ext);
+
+/* like gladLoadGLLoader, but every function pointer starts as a trampoline that
+ * resolves itself through 'load' on its first call. the loader must stay usable
+ * (and the context current) for as long as new entry points may be called, and
+ * availability must be checked with the GLAD_GL_VERSION_* flags, not NULL pointers. */
+GLAPI int gladLoadGLLoaderLazy(GLADloadproc);
+
+/* resolve a lazily bound entry point now instead of on its first call. lets a
+ * thread bind what other threads will call before starting them; trampolines
+ * must not resolve concurrently. does nothing after gladLoadGLLoader */
+GLAPI void gladResolveLazy(const char *name);
+
+/* print the entry points resolved so far by the lazy loader */
+GLAPI void gladPrintLazyStats(void);
+
 #include <KHR/khrplatform.h>
 typedef unsigned int GLenum;
 typedef unsigned char GLboolean;
@@ -1,6 +1,110 @@
 /// @ref core
 
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT && GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+
+#include "../simd/matrix.h"
+
 namespace glm
 {
+	// Only the aligned qualifiers store columns as native SIMD registers.
+	// The packed types keep using the generic code in type_mat4x4.inl.
+	template<>
+	GLM_FUNC_QUALIFIER mat<4, 4, float, aligned_lowp> operator*(mat<4, 4, float, aligned_lowp> const& m1, mat<4, 4, float, aligned_lowp> const& m2)
+	{
+		mat<4, 4, float, aligned_lowp> Result;
+		glm_mat4_mul(&m1[0].data, &m2[0].data, &Result[0].data);
+		return Result;
+	}
+
+	template<>
+	GLM_FUNC_QUALIFIER mat<4, 4, float, aligned_mediump> operator*(mat<4, 4, float, aligned_mediump> const& m1, mat<4, 4, float, aligned_mediump> const& m2)
+	{
+		mat<4, 4, float, aligned_mediump> Result;
+		glm_mat4_mul(&m1[0].data, &m2[0].data, &Result[0].data);
+		return Result;
+	}
+
+	template<>
+	GLM_FUNC_QUALIFIER mat<4, 4, float, aligned_highp> operator*(mat<4, 4, float, aligned_highp> const& m1, mat<4, 4, float, aligned_highp> const& m2)
+	{
+		mat<4, 4, float, aligned_highp> Result;
+		glm_mat4_mul(&m1[0].data, &m2[0].data, &Result[0].data);
+		return Result;
+	}
+
+	template<>
+	GLM_FUNC_QUALIFIER vec<4, float, aligned_lowp> operator*(mat<4, 4, float, aligned_lowp> const& m, vec<4, float, aligned_lowp> const& v)
+	{
+		vec<4, float, aligned_lowp> Result;
+		Result.data = glm_mat4_mul_vec4(&m[0].data, v.data);
+		return Result;
+	}
+
+	template<>
+	GLM_FUNC_QUALIFIER vec<4, float, aligned_mediump> operator*(mat<4, 4, float, aligned_mediump> const& m, vec<4, float, aligned_mediump> const& v)
+	{
+		vec<4, float, aligned_mediump> Result;
+		Result.data = glm_mat4_mul_vec4(&m[0].data, v.data);
+		return Result;
+	}
+
+	template<>
+	GLM_FUNC_QUALIFIER vec<4, float, aligned_highp> operator*(mat<4, 4, float, aligned_highp> const& m, vec<4, float, aligned_highp> const& v)
+	{
+		vec<4, float, aligned_highp> Result;
+		Result.data = glm_mat4_mul_vec4(&m[0].data, v.data);
+		return Result;
+	}
 
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+	template<>
+	GLM_FUNC_QUALIFIER mat<4, 4, double, aligned_lowp> operator*(mat<4, 4, double, aligned_lowp> const& m1, mat<4, 4, double, aligned_lowp> const& m2)
+	{
+		mat<4, 4, double, aligned_lowp> Result;
+		glm_dmat4_mul(&m1[0].data, &m2[0].data, &Result[0].data);
+		return Result;
+	}
+
+	template<>
+	GLM_FUNC_QUALIFIER mat<4, 4, double, aligned_mediump> operator*(mat<4, 4, double, aligned_mediump> const& m1, mat<4, 4, double, aligned_mediump> const& m2)
+	{
+		mat<4, 4, double, aligned_mediump> Result;
+		glm_dmat4_mul(&m1[0].data, &m2[0].data, &Result[0].data);
+		return Result;
+	}
+
+	template<>
+	GLM_FUNC_QUALIFIER mat<4, 4, double, aligned_highp> operator*(mat<4, 4, double, aligned_highp> const& m1, mat<4, 4, double, aligned_highp> const& m2)
+	{
+		mat<4, 4, double, aligned_highp> Result;
+		glm_dmat4_mul(&m1[0].data, &m2[0].data, &Result[0].data);
+		return Result;
+	}
+
+	template<>
+	GLM_FUNC_QUALIFIER vec<4, double, aligned_lowp> operator*(mat<4, 4, double, aligned_lowp> const& m, vec<4, double, aligned_lowp> const& v)
+	{
+		vec<4, double, aligned_lowp> Result;
+		Result.data = glm_dmat4_mul_dvec4(&m[0].data, v.data);
+		return Result;
+	}
+
+	template<>
+	GLM_FUNC_QUALIFIER vec<4, double, aligned_mediump> operator*(mat<4, 4, double, aligned_mediump> const& m, vec<4, double, aligned_mediump> const& v)
+	{
+		vec<4, double, aligned_mediump> Result;
+		Result.data = glm_dmat4_mul_dvec4(&m[0].data, v.data);
+		return Result;
+	}
+
+	template<>
+	GLM_FUNC_QUALIFIER vec<4, double, aligned_highp> operator*(mat<4, 4, double, aligned_highp> const& m, vec<4, double, aligned_highp> const& v)
+	{
+		vec<4, double, aligned_highp> Result;
+		Result.data = glm_dmat4_mul_dvec4(&m[0].data, v.data);
+		return Result;
+	}
+#	endif
 }//namespace glm
+
+#endif
@@ -38,6 +38,14 @@ GLM_FUNC_QUALIFIER glm_vec4 glm_mat4_mul_vec4(glm_vec4 const m[4], glm_vec4 v)
 	__m128 v2 = _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2));
 	__m128 v3 = _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3));
 
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+	__m128 a0 = _mm_mul_ps(m[0], v0);
+	__m128 a1 = _mm_mul_ps(m[1], v1);
+	a0 = _mm_fmadd_ps(m[2], v2, a0);
+	a1 = _mm_fmadd_ps(m[3], v3, a1);
+
+	return _mm_add_ps(a0, a1);
+#	else
 	__m128 m0 = _mm_mul_ps(m[0], v0);
 	__m128 m1 = _mm_mul_ps(m[1], v1);
 	__m128 m2 = _mm_mul_ps(m[2], v2);
@@ -48,6 +56,7 @@ GLM_FUNC_QUALIFIER glm_vec4 glm_mat4_mul_vec4(glm_vec4 const m[4], glm_vec4 v)
 	__m128 a2 = _mm_add_ps(a0, a1);
 
 	return a2;
+#	endif
 }
 
 GLM_FUNC_QUALIFIER __m128 glm_vec4_mul_mat4(glm_vec4 v, glm_vec4 const m[4])
@@ -79,6 +88,40 @@ GLM_FUNC_QUALIFIER __m128 glm_vec4_mul_mat4(glm_vec4 v, glm_vec4 const m[4])
 
 GLM_FUNC_QUALIFIER void glm_mat4_mul(glm_vec4 const in1[4], glm_vec4 const in2[4], glm_vec4 out[4])
 {
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+	// two result columns per 256 bit register: each column of in1 is repeated
+	// in both lanes and multiplied by the matching element of two in2 columns
+	__m256 const a0 = _mm256_insertf128_ps(_mm256_castps128_ps256(in1[0]), in1[0], 1);
+	__m256 const a1 = _mm256_insertf128_ps(_mm256_castps128_ps256(in1[1]), in1[1], 1);
+	__m256 const a2 = _mm256_insertf128_ps(_mm256_castps128_ps256(in1[2]), in1[2], 1);
+	__m256 const a3 = _mm256_insertf128_ps(_mm256_castps128_ps256(in1[3]), in1[3], 1);
+
+	__m256 const b01 = _mm256_insertf128_ps(_mm256_castps128_ps256(in2[0]), in2[1], 1);
+	__m256 const b23 = _mm256_insertf128_ps(_mm256_castps128_ps256(in2[2]), in2[3], 1);
+
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+	__m256 r01 = _mm256_mul_ps(a0, _mm256_permute_ps(b01, 0x00));
+	__m256 r23 = _mm256_mul_ps(a0, _mm256_permute_ps(b23, 0x00));
+	r01 = _mm256_fmadd_ps(a1, _mm256_permute_ps(b01, 0x55), r01);
+	r23 = _mm256_fmadd_ps(a1, _mm256_permute_ps(b23, 0x55), r23);
+	r01 = _mm256_fmadd_ps(a2, _mm256_permute_ps(b01, 0xAA), r01);
+	r23 = _mm256_fmadd_ps(a2, _mm256_permute_ps(b23, 0xAA), r23);
+	r01 = _mm256_fmadd_ps(a3, _mm256_permute_ps(b01, 0xFF), r01);
+	r23 = _mm256_fmadd_ps(a3, _mm256_permute_ps(b23, 0xFF), r23);
+#	else
+	__m256 const r01 = _mm256_add_ps(
+		_mm256_add_ps(_mm256_mul_ps(a0, _mm256_permute_ps(b01, 0x00)), _mm256_mul_ps(a1, _mm256_permute_ps(b01, 0x55))),
+		_mm256_add_ps(_mm256_mul_ps(a2, _mm256_permute_ps(b01, 0xAA)), _mm256_mul_ps(a3, _mm256_permute_ps(b01, 0xFF))));
+	__m256 const r23 = _mm256_add_ps(
+		_mm256_add_ps(_mm256_mul_ps(a0, _mm256_permute_ps(b23, 0x00)), _mm256_mul_ps(a1, _mm256_permute_ps(b23, 0x55))),
+		_mm256_add_ps(_mm256_mul_ps(a2, _mm256_permute_ps(b23, 0xAA)), _mm256_mul_ps(a3, _mm256_permute_ps(b23, 0xFF))));
+#	endif
+
+	out[0] = _mm256_castps256_ps128(r01);
+	out[1] = _mm256_extractf128_ps(r01, 1);
+	out[2] = _mm256_castps256_ps128(r23);
+	out[3] = _mm256_extractf128_ps(r23, 1);
+#	else
 	{
 		__m128 e0 = _mm_shuffle_ps(in2[0], in2[0], _MM_SHUFFLE(0, 0, 0, 0));
 		__m128 e1 = _mm_shuffle_ps(in2[0], in2[0], _MM_SHUFFLE(1, 1, 1, 1));
@@ -151,6 +194,7 @@ GLM_FUNC_QUALIFIER void glm_mat4_mul(glm_vec4 const in1[4], glm_vec4 const in2[4
 
 		out[3] = a2;
 	}
+#	endif
 }
 
 GLM_FUNC_QUALIFIER void glm_mat4_transpose(glm_vec4 const in[4], glm_vec4 out[4])
@@ -506,6 +550,16 @@ GLM_FUNC_QUALIFIER glm_vec4 glm_mat4_determinant(glm_vec4 const m[4])
 	return glm_vec4_dot(m[0], DetCof);
 }
 
+// a * b - c * d, fused where FMA is available
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_mul_sub(glm_vec4 a, glm_vec4 b, glm_vec4 c, glm_vec4 d)
+{
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+	return _mm_fmsub_ps(a, b, _mm_mul_ps(c, d));
+#	else
+	return _mm_sub_ps(_mm_mul_ps(a, b), _mm_mul_ps(c, d));
+#	endif
+}
+
 GLM_FUNC_QUALIFIER void glm_mat4_inverse(glm_vec4 const in[4], glm_vec4 out[4])
 {
 	__m128 Fac0;
@@ -523,9 +577,7 @@ GLM_FUNC_QUALIFIER void glm_mat4_inverse(glm_vec4 const in[4], glm_vec4 out[4])
 		__m128 Swp02 = _mm_shuffle_ps(Swp0b, Swp0b, _MM_SHUFFLE(2, 0, 0, 0));
 		__m128 Swp03 = _mm_shuffle_ps(in[2], in[1], _MM_SHUFFLE(3, 3, 3, 3));
 
-		__m128 Mul00 = _mm_mul_ps(Swp00, Swp01);
-		__m128 Mul01 = _mm_mul_ps(Swp02, Swp03);
-		Fac0 = _mm_sub_ps(Mul00, Mul01);
+		Fac0 = glm_vec4_mul_sub(Swp00, Swp01, Swp02, Swp03);
 	}
 
 	__m128 Fac1;
@@ -543,9 +595,7 @@ GLM_FUNC_QUALIFIER void glm_mat4_inverse(glm_vec4 const in[4], glm_vec4 out[4])
 		__m128 Swp02 = _mm_shuffle_ps(Swp0b, Swp0b, _MM_SHUFFLE(2, 0, 0, 0));
 		__m128 Swp03 = _mm_shuffle_ps(in[2], in[1], _MM_SHUFFLE(3, 3, 3, 3));
 
-		__m128 Mul00 = _mm_mul_ps(Swp00, Swp01);
-		__m128 Mul01 = _mm_mul_ps(Swp02, Swp03);
-		Fac1 = _mm_sub_ps(Mul00, Mul01);
+		Fac1 = glm_vec4_mul_sub(Swp00, Swp01, Swp02, Swp03);
 	}
 
 
@@ -564,9 +614,7 @@ GLM_FUNC_QUALIFIER void glm_mat4_inverse(glm_vec4 const in[4], glm_vec4 out[4])
 		__m128 Swp02 = _mm_shuffle_ps(Swp0b, Swp0b, _MM_SHUFFLE(2, 0, 0, 0));
 		__m128 Swp03 = _mm_shuffle_ps(in[2], in[1], _MM_SHUFFLE(2, 2, 2, 2));
 
-		__m128 Mul00 = _mm_mul_ps(Swp00, Swp01);
-		__m128 Mul01 = _mm_mul_ps(Swp02, Swp03);
-		Fac2 = _mm_sub_ps(Mul00, Mul01);
+		Fac2 = glm_vec4_mul_sub(Swp00, Swp01, Swp02, Swp03);
 	}
 
 	__m128 Fac3;
@@ -584,9 +632,7 @@ GLM_FUNC_QUALIFIER void glm_mat4_inverse(glm_vec4 const in[4], glm_vec4 out[4])
 		__m128 Swp02 = _mm_shuffle_ps(Swp0b, Swp0b, _MM_SHUFFLE(2, 0, 0, 0));
 		__m128 Swp03 = _mm_shuffle_ps(in[2], in[1], _MM_SHUFFLE(3, 3, 3, 3));
 
-		__m128 Mul00 = _mm_mul_ps(Swp00, Swp01);
-		__m128 Mul01 = _mm_mul_ps(Swp02, Swp03);
-		Fac3 = _mm_sub_ps(Mul00, Mul01);
+		Fac3 = glm_vec4_mul_sub(Swp00, Swp01, Swp02, Swp03);
 	}
 
 	__m128 Fac4;
@@ -604,9 +650,7 @@ GLM_FUNC_QUALIFIER void glm_mat4_inverse(glm_vec4 const in[4], glm_vec4 out[4])
 		__m128 Swp02 = _mm_shuffle_ps(Swp0b, Swp0b, _MM_SHUFFLE(2, 0, 0, 0));
 		__m128 Swp03 = _mm_shuffle_ps(in[2], in[1], _MM_SHUFFLE(2, 2, 2, 2));
 
-		__m128 Mul00 = _mm_mul_ps(Swp00, Swp01);
-		__m128 Mul01 = _mm_mul_ps(Swp02, Swp03);
-		Fac4 = _mm_sub_ps(Mul00, Mul01);
+		Fac4 = glm_vec4_mul_sub(Swp00, Swp01, Swp02, Swp03);
 	}
 
 	__m128 Fac5;
@@ -624,9 +668,7 @@ GLM_FUNC_QUALIFIER void glm_mat4_inverse(glm_vec4 const in[4], glm_vec4 out[4])
 		__m128 Swp02 = _mm_shuffle_ps(Swp0b, Swp0b, _MM_SHUFFLE(2, 0, 0, 0));
 		__m128 Swp03 = _mm_shuffle_ps(in[2], in[1], _MM_SHUFFLE(1, 1, 1, 1));
 
-		__m128 Mul00 = _mm_mul_ps(Swp00, Swp01);
-		__m128 Mul01 = _mm_mul_ps(Swp02, Swp03);
-		Fac5 = _mm_sub_ps(Mul00, Mul01);
+		Fac5 = glm_vec4_mul_sub(Swp00, Swp01, Swp02, Swp03);
 	}
 
 	__m128 SignA = _mm_set_ps( 1.0f,-1.0f, 1.0f,-1.0f);
@@ -1026,3 +1068,152 @@ GLM_FUNC_QUALIFIER void glm_mat4_outerProduct(__m128 const& c, __m128 const& r,
 }
 
 #endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#if GLM_ARCH & GLM_ARCH_AVX_BIT
+
+// Double precision 4x4 matrices, one column per 256 bit register.
+
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dvec4_fma(glm_dvec4 a, glm_dvec4 b, glm_dvec4 c)
+{
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+	return _mm256_fmadd_pd(a, b, c);
+#	else
+	return _mm256_add_pd(_mm256_mul_pd(a, b), c);
+#	endif
+}
+
+// a * b - c * d
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dvec4_mul_sub(glm_dvec4 a, glm_dvec4 b, glm_dvec4 c, glm_dvec4 d)
+{
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+	return _mm256_fmsub_pd(a, b, _mm256_mul_pd(c, d));
+#	else
+	return _mm256_sub_pd(_mm256_mul_pd(a, b), _mm256_mul_pd(c, d));
+#	endif
+}
+
+// broadcast one component; AVX has no cross lane permute for doubles, so
+// swap the 128 bit halves first and then pick inside each lane
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dvec4_splat_x(glm_dvec4 v)
+{
+	return _mm256_permute_pd(_mm256_permute2f128_pd(v, v, 0x00), 0x0);
+}
+
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dvec4_splat_y(glm_dvec4 v)
+{
+	return _mm256_permute_pd(_mm256_permute2f128_pd(v, v, 0x00), 0xF);
+}
+
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dvec4_splat_z(glm_dvec4 v)
+{
+	return _mm256_permute_pd(_mm256_permute2f128_pd(v, v, 0x11), 0x0);
+}
+
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dvec4_splat_w(glm_dvec4 v)
+{
+	return _mm256_permute_pd(_mm256_permute2f128_pd(v, v, 0x11), 0xF);
+}
+
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dvec4_splat(glm_dvec4 v, int i)
+{
+	switch(i)
+	{
+	default:
+	case 0: return glm_dvec4_splat_x(v);
+	case 1: return glm_dvec4_splat_y(v);
+	case 2: return glm_dvec4_splat_z(v);
+	case 3: return glm_dvec4_splat_w(v);
+	}
+}
+
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dmat4_mul_dvec4(glm_dvec4 const m[4], glm_dvec4 v)
+{
+	glm_dvec4 a0 = _mm256_mul_pd(m[0], glm_dvec4_splat_x(v));
+	glm_dvec4 a1 = _mm256_mul_pd(m[1], glm_dvec4_splat_y(v));
+	a0 = glm_dvec4_fma(m[2], glm_dvec4_splat_z(v), a0);
+	a1 = glm_dvec4_fma(m[3], glm_dvec4_splat_w(v), a1);
+	return _mm256_add_pd(a0, a1);
+}
+
+GLM_FUNC_QUALIFIER void glm_dmat4_mul(glm_dvec4 const in1[4], glm_dvec4 const in2[4], glm_dvec4 out[4])
+{
+	out[0] = glm_dmat4_mul_dvec4(in1, in2[0]);
+	out[1] = glm_dmat4_mul_dvec4(in1, in2[1]);
+	out[2] = glm_dmat4_mul_dvec4(in1, in2[2]);
+	out[3] = glm_dmat4_mul_dvec4(in1, in2[3]);
+}
+
+GLM_FUNC_QUALIFIER void glm_dmat4_transpose(glm_dvec4 const in[4], glm_dvec4 out[4])
+{
+	glm_dvec4 const tmp0 = _mm256_unpacklo_pd(in[0], in[1]); // 00 10 02 12
+	glm_dvec4 const tmp1 = _mm256_unpackhi_pd(in[0], in[1]); // 01 11 03 13
+	glm_dvec4 const tmp2 = _mm256_unpacklo_pd(in[2], in[3]); // 20 30 22 32
+	glm_dvec4 const tmp3 = _mm256_unpackhi_pd(in[2], in[3]); // 21 31 23 33
+
+	out[0] = _mm256_permute2f128_pd(tmp0, tmp2, 0x20);
+	out[1] = _mm256_permute2f128_pd(tmp1, tmp3, 0x20);
+	out[2] = _mm256_permute2f128_pd(tmp0, tmp2, 0x31);
+	out[3] = _mm256_permute2f128_pd(tmp1, tmp3, 0x31);
+}
+
+// (a[k], a[k], b[k], b[k])
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dvec4_pair(glm_dvec4 a, glm_dvec4 b, int k)
+{
+	return _mm256_blend_pd(glm_dvec4_splat(a, k), glm_dvec4_splat(b, k), 0xC);
+}
+
+// (a[k], a[k], a[k], b[k])
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dvec4_triple(glm_dvec4 a, glm_dvec4 b, int k)
+{
+	return _mm256_blend_pd(glm_dvec4_splat(a, k), glm_dvec4_splat(b, k), 0x8);
+}
+
+// sub factors of the cofactor expansion, same layout as glm_mat4_inverse:
+// (m2[b] * m3[a] - m3[b] * m2[a], <same>, m1[b] * m3[a] - m3[b] * m1[a], m1[b] * m2[a] - m2[b] * m1[a])
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dmat4_inverse_factor(glm_dvec4 const in[4], int a, int b)
+{
+	return glm_dvec4_mul_sub(
+		glm_dvec4_pair(in[2], in[1], b), glm_dvec4_triple(in[3], in[2], a),
+		glm_dvec4_triple(in[3], in[2], b), glm_dvec4_pair(in[2], in[1], a));
+}
+
+GLM_FUNC_QUALIFIER void glm_dmat4_inverse(glm_dvec4 const in[4], glm_dvec4 out[4])
+{
+	glm_dvec4 const Fac0 = glm_dmat4_inverse_factor(in, 3, 2);
+	glm_dvec4 const Fac1 = glm_dmat4_inverse_factor(in, 3, 1);
+	glm_dvec4 const Fac2 = glm_dmat4_inverse_factor(in, 2, 1);
+	glm_dvec4 const Fac3 = glm_dmat4_inverse_factor(in, 3, 0);
+	glm_dvec4 const Fac4 = glm_dmat4_inverse_factor(in, 2, 0);
+	glm_dvec4 const Fac5 = glm_dmat4_inverse_factor(in, 1, 0);
+
+	// (m[1][k], m[0][k], m[0][k], m[0][k])
+	glm_dvec4 const Vec0 = _mm256_blend_pd(glm_dvec4_splat_x(in[0]), glm_dvec4_splat_x(in[1]), 0x1);
+	glm_dvec4 const Vec1 = _mm256_blend_pd(glm_dvec4_splat_y(in[0]), glm_dvec4_splat_y(in[1]), 0x1);
+	glm_dvec4 const Vec2 = _mm256_blend_pd(glm_dvec4_splat_z(in[0]), glm_dvec4_splat_z(in[1]), 0x1);
+	glm_dvec4 const Vec3 = _mm256_blend_pd(glm_dvec4_splat_w(in[0]), glm_dvec4_splat_w(in[1]), 0x1);
+
+	glm_dvec4 const SignA = _mm256_set_pd(1.0,-1.0, 1.0,-1.0);
+	glm_dvec4 const SignB = _mm256_set_pd(-1.0, 1.0,-1.0, 1.0);
+
+	glm_dvec4 const Inv0 = _mm256_mul_pd(SignB, glm_dvec4_fma(Vec3, Fac2, glm_dvec4_mul_sub(Vec1, Fac0, Vec2, Fac1)));
+	glm_dvec4 const Inv1 = _mm256_mul_pd(SignA, glm_dvec4_fma(Vec3, Fac4, glm_dvec4_mul_sub(Vec0, Fac0, Vec2, Fac3)));
+	glm_dvec4 const Inv2 = _mm256_mul_pd(SignB, glm_dvec4_fma(Vec3, Fac5, glm_dvec4_mul_sub(Vec0, Fac1, Vec1, Fac3)));
+	glm_dvec4 const Inv3 = _mm256_mul_pd(SignA, glm_dvec4_fma(Vec2, Fac5, glm_dvec4_mul_sub(Vec0, Fac2, Vec1, Fac4)));
+
+	// (Inv0[0], Inv1[0], Inv2[0], Inv3[0])
+	glm_dvec4 const Row0 = _mm256_permute2f128_pd(
+		_mm256_unpacklo_pd(Inv0, Inv1), _mm256_unpacklo_pd(Inv2, Inv3), 0x20);
+
+	// determinant: dot(in[0], Row0)
+	glm_dvec4 const Dot0 = _mm256_mul_pd(in[0], Row0);
+	glm_dvec4 const Dot1 = _mm256_hadd_pd(Dot0, Dot0);
+	glm_dvec4 const Det0 = _mm256_add_pd(Dot1, _mm256_permute2f128_pd(Dot1, Dot1, 0x01));
+	glm_dvec4 const Rcp0 = _mm256_div_pd(_mm256_set1_pd(1.0), Det0);
+
+	out[0] = _mm256_mul_pd(Inv0, Rcp0);
+	out[1] = _mm256_mul_pd(Inv1, Rcp0);
+	out[2] = _mm256_mul_pd(Inv2, Rcp0);
+	out[3] = _mm256_mul_pd(Inv3, Rcp0);
+}
+
+#endif//GLM_ARCH & GLM_ARCH_AVX_BIT
@@ -0,0 +1,235 @@
+#include "AppConfig.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+#include <opencv2/calib3d.hpp>
+
+static void PrintUsage(const char* program)
+{
+	std::cout << "usage: " << program << " [options]\n"
+		<< "  --pacing vsync|adaptive|fixed|ondemand   frame pacing mode (default vsync)\n"
+		<< "  --fps N                                  frame rate for fixed pacing (default 60)\n"
+		<< "  --input FILE                             read frames from a video or .rawf file instead of the camera\n"
+		<< "  --headless                               render offscreen without a window\n"
+		<< "  --output PATH                            headless output: .avi/.mp4/.mkv file or PNG directory\n"
+		<< "  --frames N                               headless: stop after N frames\n"
+		<< "  --lazy-gl                                bind GL functions on first call, print the used ones at exit\n"
+		<< "  --markers full|roi                       detect ArUco markers in whole frames or tracked ROIs\n"
+		<< "  --calibration FILE                       camera intrinsics for marker poses (OpenCV YAML/XML)\n"
+		<< "  --marker-length M                        marker side length in meters (default 0.05)\n"
+		<< "  --undistort cpu|gpu                      correct lens distortion with cv::remap or in the shader\n"
+		<< "  --features                               track corners with pyramidal Lucas-Kanade optical flow\n"
+		<< "  --record-camera PATH                     record camera frames (video, .rawf file or PNG directory)\n"
+		<< "  --record-output PATH                     record the rendered window\n"
+		<< "  --record-policy block|oldest|newest      when the encoder falls behind: wait, or drop the oldest\n"
+		<< "                                           or newest queued frame (default oldest)\n"
+		<< "  --bind KEY=ACTION                        bind a key (e.g. ctrl+F5, mouse2) to quit|trace|pacing|overlays|none;\n"
+		<< "                                           defaults: escape=quit F12=trace P=pacing O=overlays\n"
+		<< "  --trace FILE                             record stage timings as Chrome trace JSON, written at exit\n"
+		<< "                                           (and on F12); with TRACE_OPENCV builds, OPENCV_TRACE=1\n"
+		<< "                                           adds OpenCV's own trace\n"
+		<< "  --cache DIR                              directory for cached derived data (default cache)\n"
+		<< "  --calibrate PATTERN                      calibrate from chessboard images (glob or directory),\n"
+		<< "                                           write --calibration FILE (default calibration.yml) and exit\n"
+		<< "  --board WxH                              inner chessboard corners (default 9x6)\n"
+		<< "  --square M                               chessboard square side in meters (default 0.025)\n"
+		<< "  --solver FLAG[,FLAG...]                  calibrateCamera flags: fix-principal, fix-aspect,\n"
+		<< "                                           zero-tangent, fix-k3, rational (default none)\n"
+		<< std::endl;
+}
+
+static bool ParsePacing(const char* value, PacingMode& mode)
+{
+	if (strcmp(value, "vsync") == 0)
+		mode = PacingMode::VSync;
+	else if (strcmp(value, "adaptive") == 0)
+		mode = PacingMode::AdaptiveVSync;
+	else if (strcmp(value, "fixed") == 0)
+		mode = PacingMode::FixedRate;
+	else if (strcmp(value, "ondemand") == 0)
+		mode = PacingMode::OnDemand;
+	else
+		return false;
+	return true;
+}
+
+static bool ParseMarkers(const char* value, MarkerMode& mode)
+{
+	if (strcmp(value, "full") == 0)
+		mode = MarkerMode::FullFrame;
+	else if (strcmp(value, "roi") == 0)
+		mode = MarkerMode::Tracking;
+	else
+		return false;
+	return true;
+}
+
+static bool ParseUndistort(const char* value, UndistortMode& mode)
+{
+	if (strcmp(value, "cpu") == 0)
+		mode = UndistortMode::CPU;
+	else if (strcmp(value, "gpu") == 0)
+		mode = UndistortMode::GPU;
+	else
+		return false;
+	return true;
+}
+
+static bool ParseSize(const char* value, cv::Size& size)
+{
+	int width = 0, height = 0;
+	if (sscanf(value, "%dx%d", &width, &height) != 2 || width < 2 || height < 2)
+		return false;
+	size = cv::Size(width, height);
+	return true;
+}
+
+static bool ParsePolicy(const char* value, OverflowPolicy& policy)
+{
+	if (strcmp(value, "block") == 0)
+		policy = OverflowPolicy::Block;
+	else if (strcmp(value, "oldest") == 0)
+		policy = OverflowPolicy::DropOldest;
+	else if (strcmp(value, "newest") == 0)
+		policy = OverflowPolicy::DropNewest;
+	else
+		return false;
+	return true;
+}
+
+static bool ParseSolverFlags(const char* value, int& flags)
+{
+	static const struct { const char* name; int flag; } names[] =
+	{
+		{ "fix-principal", cv::CALIB_FIX_PRINCIPAL_POINT },
+		{ "fix-aspect", cv::CALIB_FIX_ASPECT_RATIO },
+		{ "zero-tangent", cv::CALIB_ZERO_TANGENT_DIST },
+		{ "fix-k3", cv::CALIB_FIX_K3 },
+		{ "rational", cv::CALIB_RATIONAL_MODEL }
+	};
+
+	int parsed = 0;
+	const std::string list = value;
+	for (size_t start = 0; start <= list.size(); )
+	{
+		size_t end = list.find(',', start);
+		if (end == std::string::npos)
+			end = list.size();
+		const std::string name = list.substr(start, end - start);
+
+		size_t i = 0;
+		while (i < sizeof(names) / sizeof(names[0]) && name != names[i].name)
+			i++;
+		if (i == sizeof(names) / sizeof(names[0]))
+			return false;
+		parsed |= names[i].flag;
+		start = end + 1;
+	}
+	flags = parsed;
+	return true;
+}
+
+bool ParseArgs(int argc, char** argv, AppConfig& config)
+{
+	for (int i = 1; i < argc; i++)
+	{
+		const char* arg = argv[i];
+		const char* value = (i + 1 < argc) ? argv[i + 1] : NULL;
+		KeyBinding binding;
+
+		if (strcmp(arg, "--pacing") == 0 && value != NULL && ParsePacing(value, config.pacing))
+			i++;
+		else if (strcmp(arg, "--fps") == 0 && value != NULL && atof(value) > 0.0)
+		{
+			config.targetFps = atof(value);
+			i++;
+		}
+		else if (strcmp(arg, "--input") == 0 && value != NULL)
+		{
+			config.inputPath = value;
+			i++;
+		}
+		else if (strcmp(arg, "--headless") == 0)
+			config.headless = true;
+		else if (strcmp(arg, "--lazy-gl") == 0)
+			config.lazyGL = true;
+		else if (strcmp(arg, "--output") == 0 && value != NULL)
+		{
+			config.outputPath = value;
+			i++;
+		}
+		else if (strcmp(arg, "--frames") == 0 && value != NULL && atoi(value) > 0)
+		{
+			config.maxFrames = atoi(value);
+			i++;
+		}
+		else if (strcmp(arg, "--markers") == 0 && value != NULL && ParseMarkers(value, config.markers))
+			i++;
+		else if (strcmp(arg, "--calibration") == 0 && value != NULL)
+		{
+			config.calibrationPath = value;
+			i++;
+		}
+		else if (strcmp(arg, "--marker-length") == 0 && value != NULL && atof(value) > 0.0)
+		{
+			config.markerLength = (float)atof(value);
+			i++;
+		}
+		else if (strcmp(arg, "--undistort") == 0 && value != NULL && ParseUndistort(value, config.undistort))
+			i++;
+		else if (strcmp(arg, "--features") == 0)
+			config.trackFeatures = true;
+		else if (strcmp(arg, "--record-camera") == 0 && value != NULL)
+		{
+			config.recordCameraPath = value;
+			i++;
+		}
+		else if (strcmp(arg, "--record-output") == 0 && value != NULL)
+		{
+			config.recordOutputPath = value;
+			i++;
+		}
+		else if (strcmp(arg, "--record-policy") == 0 && value != NULL && ParsePolicy(value, config.recordPolicy))
+			i++;
+		else if (strcmp(arg, "--bind") == 0 && value != NULL && InputSystem::ParseBinding(value, binding))
+		{
+			config.bindings.push_back(binding);
+			i++;
+		}
+		else if (strcmp(arg, "--trace") == 0 && value != NULL)
+		{
+			config.tracePath = value;
+			i++;
+		}
+		else if (strcmp(arg, "--cache") == 0 && value != NULL)
+		{
+			config.cacheDirectory = value;
+			i++;
+		}
+		else if (strcmp(arg, "--calibrate") == 0 && value != NULL)
+		{
+			config.calibrateImages = value;
+			i++;
+		}
+		else if (strcmp(arg, "--board") == 0 && value != NULL && ParseSize(value, config.boardSize))
+			i++;
+		else if (strcmp(arg, "--square") == 0 && value != NULL && atof(value) > 0.0)
+		{
+			config.squareSize = (float)atof(value);
+			i++;
+		}
+		else if (strcmp(arg, "--solver") == 0 && value != NULL && ParseSolverFlags(value, config.solverFlags))
+			i++;
+		else
+		{
+			std::cout << "Unknown or incomplete option: " << arg << std::endl;
+			PrintUsage(argv[0]);
+			return false;
+		}
+	}
+	return true;
+}
@@ -0,0 +1,137 @@
+#include "AsyncReadback.h"
+
+#include <algorithm>
+
+AsyncReadback::AsyncReadback()
+	: oldest(0), pending(0), mapped(false), bytes(0),
+	issued(0), acquired(0), discarded(0), stalls(0), totalLatency(0.0), worstLatency(0.0)
+{
+	for (int i = 0; i < RING_SIZE; i++)
+	{
+		pbo[i] = 0;
+		fences[i] = NULL;
+	}
+}
+
+AsyncReadback::~AsyncReadback()
+{
+	// GL objects are released by Release() while the context is still current
+}
+
+void AsyncReadback::Init(cv::Size size)
+{
+	Release();
+	this->size = size;
+	bytes = (size_t)size.width * size.height * 3;
+
+	// GL_STREAM_READ: written by the GPU once, read by the CPU once
+	glGenBuffers(RING_SIZE, pbo);
+	for (int i = 0; i < RING_SIZE; i++)
+	{
+		glBindBuffer(GL_PIXEL_PACK_BUFFER, pbo[i]);
+		glBufferData(GL_PIXEL_PACK_BUFFER, (GLsizeiptr)bytes, NULL, GL_STREAM_READ);
+	}
+	glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+	oldest = pending = 0;
+}
+
+void AsyncReadback::Release()
+{
+	if (mapped)
+		ReleaseAcquired();
+	for (int i = 0; i < RING_SIZE; i++)
+		ReleaseFence(i);
+	if (pbo[0] != 0)
+		glDeleteBuffers(RING_SIZE, pbo);
+	for (int i = 0; i < RING_SIZE; i++)
+		pbo[i] = 0;
+	oldest = pending = 0;
+}
+
+void AsyncReadback::ReleaseFence(int slot)
+{
+	if (fences[slot] != NULL)
+	{
+		glDeleteSync(fences[slot]);
+		fences[slot] = NULL;
+	}
+}
+
+void AsyncReadback::Issue(GLuint framebuffer, GLenum buffer)
+{
+	if (!IsReady() || mapped)
+		return;
+
+	// no free buffer: the oldest frame is overwritten unread. GL orders the two
+	// reads into the same buffer, so there is nothing to wait for
+	if (pending == RING_SIZE)
+	{
+		discarded++;
+		ReleaseFence(oldest);
+		oldest = (oldest + 1) % RING_SIZE;
+		pending--;
+	}
+
+	const int slot = (oldest + pending) % RING_SIZE;
+	glBindFramebuffer(GL_READ_FRAMEBUFFER, framebuffer);
+	glReadBuffer(buffer);
+	glBindBuffer(GL_PIXEL_PACK_BUFFER, pbo[slot]);
+	glPixelStorei(GL_PACK_ALIGNMENT, 1);
+	glReadPixels(0, 0, size.width, size.height, GL_BGR, GL_UNSIGNED_BYTE, (void*)0);
+	glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+	fences[slot] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	issueTimes[slot] = std::chrono::steady_clock::now();
+	pending++;
+	issued++;
+}
+
+bool AsyncReadback::Acquire(cv::Mat& frame, bool wait)
+{
+	if (pending == 0 || mapped)
+		return false;
+
+	GLenum result = glClientWaitSync(fences[oldest], GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+	if (result == GL_TIMEOUT_EXPIRED && wait)
+	{
+		stalls++;
+		result = glClientWaitSync(fences[oldest], GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);
+	}
+	if (result == GL_TIMEOUT_EXPIRED || result == GL_WAIT_FAILED)
+		return false;
+	ReleaseFence(oldest);
+
+	glBindBuffer(GL_PIXEL_PACK_BUFFER, pbo[oldest]);
+	void* data = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, (GLsizeiptr)bytes, GL_MAP_READ_BIT);
+	glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+	if (data == NULL)
+	{
+		// drop the frame rather than getting stuck on it
+		oldest = (oldest + 1) % RING_SIZE;
+		pending--;
+		discarded++;
+		return false;
+	}
+
+	const double latency = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - issueTimes[oldest]).count();
+	totalLatency += latency;
+	worstLatency = std::max(worstLatency, latency);
+	acquired++;
+
+	mapped = true;
+	frame = cv::Mat(size, CV_8UC3, data);
+	return true;
+}
+
+void AsyncReadback::ReleaseAcquired()
+{
+	if (!mapped)
+		return;
+
+	glBindBuffer(GL_PIXEL_PACK_BUFFER, pbo[oldest]);
+	glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+	glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+	mapped = false;
+	oldest = (oldest + 1) % RING_SIZE;
+	pending--;
+}
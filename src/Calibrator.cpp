@@ -0,0 +1,194 @@
+#include "Calibrator.h"
+
+#include <opencv2/calib3d.hpp>
+#include <opencv2/core/utility.hpp>
+#include <opencv2/imgcodecs.hpp>
+#include <opencv2/imgproc.hpp>
+
+#include <cstring>
+#include <iostream>
+
+#include "FileCache.h"
+
+// bump when detection parameters or the file layout change
+static const uint32_t CORNERS_VERSION = 1;
+static const char CORNERS_MAGIC[4] = { 'C', 'R', 'N', 'R' };
+
+struct CornersHeader
+{
+	char magic[4];
+	uint32_t version;
+	int32_t width;
+	int32_t height;
+	int32_t count;	// 0 if the board was not found
+};
+
+Calibrator::Calibrator(const CalibratorOptions& options)
+	: options(options), usable(0), cached(0), rms(0.0), detectSeconds(0.0), solveSeconds(0.0)
+{
+}
+
+bool Calibrator::LoadCorners(const std::string& path, View& view) const
+{
+	std::vector<unsigned char> data;
+	CornersHeader header;
+	if (!FileCache::Read(path, data) || data.size() < sizeof(header))
+		return false;
+	memcpy(&header, data.data(), sizeof(header));
+	if (memcmp(header.magic, CORNERS_MAGIC, sizeof(CORNERS_MAGIC)) != 0 || header.version != CORNERS_VERSION ||
+		header.count < 0 || data.size() != sizeof(header) + header.count * sizeof(cv::Point2f))
+		return false;
+
+	view.imageSize = cv::Size(header.width, header.height);
+	view.corners.resize(header.count);
+	if (header.count > 0)
+		memcpy((void*)view.corners.data(), data.data() + sizeof(header), header.count * sizeof(cv::Point2f));
+	return true;
+}
+
+void Calibrator::SaveCorners(const std::string& path, const View& view) const
+{
+	CornersHeader header;
+	memcpy(header.magic, CORNERS_MAGIC, sizeof(CORNERS_MAGIC));
+	header.version = CORNERS_VERSION;
+	header.width = view.imageSize.width;
+	header.height = view.imageSize.height;
+	header.count = (int32_t)view.corners.size();
+
+	std::vector<unsigned char> data(sizeof(header) + view.corners.size() * sizeof(cv::Point2f));
+	memcpy(data.data(), &header, sizeof(header));
+	if (!view.corners.empty())
+		memcpy(data.data() + sizeof(header), view.corners.data(), view.corners.size() * sizeof(cv::Point2f));
+	if (!FileCache::Write(path, data.data(), data.size()))
+		std::cout << "Failed to write " << path << std::endl;
+}
+
+void Calibrator::Detect(View& view) const
+{
+	// the encoded file is read once: for the hash and, on a miss, for decoding
+	std::vector<unsigned char> file;
+	if (!FileCache::Read(view.path, file) || file.empty())
+		return;
+	view.readable = true;
+
+	std::string entry;
+	if (!options.cacheDirectory.empty())
+	{
+		uint64_t key = FileCache::Hash(&CORNERS_VERSION, sizeof(CORNERS_VERSION));
+		key = FileCache::Hash(&options.boardSize, sizeof(options.boardSize), key);
+		key = FileCache::Hash(file.data(), file.size(), key);
+		entry = FileCache::EntryPath(options.cacheDirectory, "corners", key, ".bin");
+		if (LoadCorners(entry, view))
+		{
+			view.cached = true;
+			return;
+		}
+	}
+
+	cv::Mat gray = cv::imdecode(file, cv::IMREAD_GRAYSCALE);
+	std::vector<unsigned char>().swap(file);
+	if (gray.empty())
+	{
+		view.readable = false;
+		return;
+	}
+	view.imageSize = gray.size();
+
+	const int flags = cv::CALIB_CB_ADAPTIVE_THRESH | cv::CALIB_CB_NORMALIZE_IMAGE | cv::CALIB_CB_FAST_CHECK;
+	if (cv::findChessboardCorners(gray, options.boardSize, view.corners, flags))
+	{
+		cv::cornerSubPix(gray, view.corners, cv::Size(11, 11), cv::Size(-1, -1),
+			cv::TermCriteria(cv::TermCriteria::EPS + cv::TermCriteria::COUNT, 30, 0.01));
+	}
+	else
+		view.corners.clear();
+
+	if (!entry.empty())
+		SaveCorners(entry, view);
+}
+
+bool Calibrator::Run(const std::string& pattern, CameraCalibration& result)
+{
+	// glob throws for a directory that does not exist
+	std::vector<cv::String> paths;
+	try
+	{
+		cv::glob(pattern, paths, false);
+	}
+	catch (const cv::Exception& e)
+	{
+		std::cout << "Failed to list calibration images " << pattern << ": " << e.what() << std::endl;
+		views.clear();
+		usable = 0;
+		cached = 0;
+		return false;
+	}
+
+	views.assign(paths.size(), View());
+	for (size_t i = 0; i < paths.size(); i++)
+	{
+		views[i].path = paths[i];
+		views[i].cached = false;
+		views[i].readable = false;
+	}
+	usable = 0;
+	cached = 0;
+	rms = 0.0;
+
+	if (!options.cacheDirectory.empty() && !FileCache::EnsureDirectory(options.cacheDirectory))
+	{
+		std::cout << "Failed to create cache directory " << options.cacheDirectory << ", detecting without cache" << std::endl;
+		options.cacheDirectory.clear();
+	}
+
+	// one image per stripe: images take long enough that finer scheduling pays off
+	int64 start = cv::getTickCount();
+	cv::parallel_for_(cv::Range(0, (int)views.size()), [&](const cv::Range& range)
+	{
+		for (int i = range.start; i < range.end; i++)
+			Detect(views[i]);
+	}, (double)views.size());
+	detectSeconds = (cv::getTickCount() - start) / cv::getTickFrequency();
+
+	// all views of one calibration must share a size; the first usable one decides
+	cv::Size imageSize;
+	std::vector<std::vector<cv::Point2f> > imagePoints;
+	for (size_t i = 0; i < views.size(); i++)
+	{
+		const View& view = views[i];
+		if (!view.readable)
+			std::cout << "Failed to read " << view.path << std::endl;
+		if (view.cached)
+			cached++;
+		if (view.corners.empty())
+			continue;
+		if (imageSize.area() == 0)
+			imageSize = view.imageSize;
+		if (view.imageSize != imageSize)
+		{
+			std::cout << "Skipping " << view.path << ": " << view.imageSize << " differs from " << imageSize << std::endl;
+			continue;
+		}
+		imagePoints.push_back(view.corners);
+	}
+	usable = (int)imagePoints.size();
+	if (usable < MIN_VIEWS)
+	{
+		std::cout << "Calibration needs at least " << MIN_VIEWS << " views with a visible board, found " << usable << std::endl;
+		return false;
+	}
+
+	std::vector<cv::Point3f> board;
+	for (int y = 0; y < options.boardSize.height; y++)
+		for (int x = 0; x < options.boardSize.width; x++)
+			board.push_back(cv::Point3f(x * options.squareSize, y * options.squareSize, 0.0f));
+	std::vector<std::vector<cv::Point3f> > objectPoints(imagePoints.size(), board);
+
+	start = cv::getTickCount();
+	std::vector<cv::Mat> rvecs, tvecs;
+	result.imageSize = imageSize;
+	rms = cv::calibrateCamera(objectPoints, imagePoints, imageSize, result.cameraMatrix, result.distCoeffs,
+		rvecs, tvecs, options.flags);
+	solveSeconds = (cv::getTickCount() - start) / cv::getTickFrequency();
+	return true;
+}
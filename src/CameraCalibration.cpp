@@ -0,0 +1,94 @@
+#include "CameraCalibration.h"
+
+#include <iostream>
+
+bool CameraCalibration::Load(const std::string& path)
+{
+	cv::FileStorage fs;
+	try
+	{
+		if (!fs.open(path, cv::FileStorage::READ))
+		{
+			std::cout << "Failed to open calibration " << path << std::endl;
+			return false;
+		}
+		fs["camera_matrix"] >> cameraMatrix;
+		fs["distortion_coefficients"] >> distCoeffs;
+		int width = 0, height = 0;
+		fs["image_width"] >> width;
+		fs["image_height"] >> height;
+		imageSize = cv::Size(width, height);
+	}
+	catch (const cv::Exception& e)
+	{
+		std::cout << "Failed to read calibration " << path << ": " << e.what() << std::endl;
+		cameraMatrix.release();
+		return false;
+	}
+
+	if (cameraMatrix.size() != cv::Size(3, 3))
+	{
+		std::cout << "Calibration " << path << " has no 3x3 camera_matrix" << std::endl;
+		cameraMatrix.release();
+		return false;
+	}
+	cameraMatrix.convertTo(cameraMatrix, CV_64F);
+	if (distCoeffs.empty())
+		distCoeffs = cv::Mat::zeros(1, 5, CV_64F);
+	else
+		distCoeffs.reshape(1, 1).convertTo(distCoeffs, CV_64F);
+	return true;
+}
+
+bool CameraCalibration::Save(const std::string& path) const
+{
+	try
+	{
+		cv::FileStorage fs(path, cv::FileStorage::WRITE);
+		if (!fs.isOpened())
+		{
+			std::cout << "Failed to create calibration " << path << std::endl;
+			return false;
+		}
+		fs << "image_width" << imageSize.width;
+		fs << "image_height" << imageSize.height;
+		fs << "camera_matrix" << cameraMatrix;
+		fs << "distortion_coefficients" << distCoeffs;
+	}
+	catch (const cv::Exception& e)
+	{
+		std::cout << "Failed to write calibration " << path << ": " << e.what() << std::endl;
+		return false;
+	}
+	return true;
+}
+
+CameraCalibration CameraCalibration::ScaledTo(cv::Size size) const
+{
+	CameraCalibration scaled;
+	scaled.cameraMatrix = cameraMatrix.clone();
+	scaled.distCoeffs = distCoeffs.clone();
+	scaled.imageSize = size;
+	if (imageSize.area() > 0 && size != imageSize)
+	{
+		const double sx = (double)size.width / imageSize.width;
+		const double sy = (double)size.height / imageSize.height;
+		scaled.cameraMatrix.row(0) *= sx;
+		scaled.cameraMatrix.row(1) *= sy;
+	}
+	return scaled;
+}
+
+CameraCalibration CameraCalibration::Guess(cv::Size size)
+{
+	// f = w / (2 tan(30 deg)) ~ 0.87 w
+	const double f = 0.866 * size.width;
+	CameraCalibration guess;
+	guess.cameraMatrix = (cv::Mat_<double>(3, 3) <<
+		f, 0.0, size.width * 0.5,
+		0.0, f, size.height * 0.5,
+		0.0, 0.0, 1.0);
+	guess.distCoeffs = cv::Mat::zeros(1, 5, CV_64F);
+	guess.imageSize = size;
+	return guess;
+}
@@ -0,0 +1,71 @@
+#include "CaptureThread.h"
+
+#include <iostream>
+
+#include "Trace.h"
+
+CaptureThread::CaptureThread(FrameSource& source, FrameRing& ring)
+	: source(source), ring(ring), running(false)
+{
+}
+
+CaptureThread::~CaptureThread()
+{
+	Stop();
+}
+
+bool CaptureThread::Start()
+{
+	if (running.load() || !source.IsOpened())
+		return false;
+
+	running.store(true);
+	worker = std::thread(&CaptureThread::Run, this);
+	return true;
+}
+
+void CaptureThread::Stop()
+{
+	running.store(false);
+	if (worker.joinable())
+		worker.join();
+}
+
+void CaptureThread::Run()
+{
+	Trace::SetThreadName("Capture");
+	while (running.load(std::memory_order_relaxed))
+	{
+		// grab() blocks until the camera delivers, but only on this thread
+		bool grabbed;
+		{
+			TRACE_ZONE("Grab");
+			grabbed = source.Grab();
+		}
+		if (!grabbed)
+		{
+			std::cout << "Capture source ended or failed" << std::endl;
+			break;
+		}
+
+		// ring full: the render loop is behind, skip decoding this frame entirely
+		cv::Mat* slot = ring.BeginWrite();
+		if (slot == NULL)
+		{
+			ring.DropWrite();
+			continue;
+		}
+
+		TRACE_ZONE("Retrieve");
+		if (source.Retrieve(*slot))
+		{
+			ring.CommitWrite();
+			if (onFrame)
+				onFrame();
+		}
+		else
+			ring.CancelWrite();
+	}
+
+	running.store(false);
+}
@@ -0,0 +1,240 @@
+#include "CommandBuffer.h"
+
+#include <opencv2/core.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+static const size_t INITIAL_CAPACITY = 16 << 10;
+
+CommandBuffer::CommandBuffer()
+	: data(NULL), size(0), capacity(0), commands(0)
+{
+}
+
+CommandBuffer::~CommandBuffer()
+{
+	cv::fastFree(data);
+}
+
+void* CommandBuffer::Append(Type type, uint32_t arg0, uint32_t arg1, size_t payload)
+{
+	static_assert(sizeof(Header) == ALIGNMENT, "payloads must start aligned");
+
+	const size_t packet = cv::alignSize(sizeof(Header) + payload, (int)ALIGNMENT);
+	if (size + packet > capacity)
+	{
+		// grows geometrically and is kept across Clear, so steady frames never allocate
+		const size_t grown = std::max(std::max(capacity * 2, INITIAL_CAPACITY), size + packet);
+		uint8_t* bigger = (uint8_t*)cv::fastMalloc(grown);
+		if (size > 0)
+			memcpy(bigger, data, size);
+		cv::fastFree(data);
+		data = bigger;
+		capacity = grown;
+	}
+
+	Header* header = (Header*)(data + size);
+	header->type = (uint16_t)type;
+	header->reserved = 0;
+	header->size = (uint32_t)packet;
+	header->args[0] = arg0;
+	header->args[1] = arg1;
+	size += packet;
+	commands++;
+	return header + 1;
+}
+
+void CommandBuffer::UseProgram(GLuint program)
+{
+	Append(USE_PROGRAM, program, 0, 0);
+}
+
+void CommandBuffer::BindVertexArray(GLuint vao)
+{
+	Append(BIND_VERTEX_ARRAY, vao, 0, 0);
+}
+
+void CommandBuffer::BindTexture(int unit, GLuint texture)
+{
+	Append(BIND_TEXTURE, (uint32_t)unit, texture, 0);
+}
+
+void CommandBuffer::Enable(GLenum capability)
+{
+	Append(ENABLE, capability, 0, 0);
+}
+
+void CommandBuffer::Disable(GLenum capability)
+{
+	Append(DISABLE, capability, 0, 0);
+}
+
+void CommandBuffer::Uniform(GLint location, int value)
+{
+	Append(UNIFORM_INT, (uint32_t)location, (uint32_t)value, 0);
+}
+
+void CommandBuffer::Uniform(GLint location, const glm::vec2& value)
+{
+	memcpy(Append(UNIFORM_VEC2, (uint32_t)location, 0, sizeof(value)), &value[0], sizeof(value));
+}
+
+void CommandBuffer::Uniform(GLint location, const glm::mat4& value)
+{
+	memcpy(Append(UNIFORM_MAT4, (uint32_t)location, 0, sizeof(value)), &value[0][0], sizeof(value));
+}
+
+void* CommandBuffer::BufferData(GLenum target, GLuint buffer, size_t bytes, GLenum usage)
+{
+	// target and usage share one operand, both GLenums fit in 16 bits
+	CV_DbgAssert(target <= 0xFFFF && usage <= 0xFFFF);
+	// the exact size leads the data, which starts aligned again after it
+	uint64_t* payload = (uint64_t*)Append(BUFFER_DATA, (target << 16) | usage, buffer, ALIGNMENT + bytes);
+	payload[0] = bytes;
+	return (uint8_t*)payload + ALIGNMENT;
+}
+
+void CommandBuffer::DrawArrays(GLenum mode, GLint first, GLsizei count)
+{
+	GLint* args = (GLint*)Append(DRAW_ARRAYS, mode, 0, 2 * sizeof(GLint));
+	args[0] = first;
+	args[1] = count;
+}
+
+void CommandBuffer::DrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, size_t offset, GLsizei instances)
+{
+	uint64_t* args = (uint64_t*)Append(DRAW_ELEMENTS_INSTANCED, mode, type, 3 * sizeof(uint64_t));
+	args[0] = (uint64_t)count;
+	args[1] = (uint64_t)offset;
+	args[2] = (uint64_t)instances;
+}
+
+CommandReplayer::CommandReplayer()
+	: replayed(0), filtered(0)
+{
+	Begin();
+}
+
+void CommandReplayer::Begin()
+{
+	program = vao = arrayBuffer = UNKNOWN;
+	activeUnit = -1;
+	for (int i = 0; i < MAX_UNITS; i++)
+		textures[i] = UNKNOWN;
+	depthTest = blend = cullFace = -1;
+}
+
+// returns false if 'capability' is known to be in that state already
+bool CommandReplayer::SetCapability(GLenum capability, bool enable)
+{
+	int* state = capability == GL_DEPTH_TEST ? &depthTest : capability == GL_BLEND ? &blend : capability == GL_CULL_FACE ? &cullFace : NULL;
+	if (state != NULL)
+	{
+		if (*state == (int)enable)
+			return false;
+		*state = (int)enable;
+	}
+	if (enable)
+		glEnable(capability);
+	else
+		glDisable(capability);
+	return true;
+}
+
+void CommandReplayer::Replay(const CommandBuffer& buffer)
+{
+	typedef CommandBuffer::Header Header;
+
+	size_t skipped = 0;
+	for (size_t offset = 0; offset < buffer.size;)
+	{
+		const Header& header = *(const Header*)(buffer.data + offset);
+		const void* payload = &header + 1;
+		offset += header.size;
+
+		switch (header.type)
+		{
+		case CommandBuffer::USE_PROGRAM:
+			if (header.args[0] == program)
+				skipped++;
+			else
+				glUseProgram(program = header.args[0]);
+			break;
+
+		case CommandBuffer::BIND_VERTEX_ARRAY:
+			if (header.args[0] == vao)
+				skipped++;
+			else
+				glBindVertexArray(vao = header.args[0]);
+			break;
+
+		case CommandBuffer::BIND_TEXTURE:
+		{
+			const int unit = (int)header.args[0];
+			if (unit < MAX_UNITS && textures[unit] == header.args[1])
+			{
+				skipped++;
+				break;
+			}
+			if (unit != activeUnit)
+				glActiveTexture(GL_TEXTURE0 + (activeUnit = unit));
+			glBindTexture(GL_TEXTURE_2D, header.args[1]);
+			if (unit < MAX_UNITS)
+				textures[unit] = header.args[1];
+			break;
+		}
+
+		case CommandBuffer::ENABLE:
+		case CommandBuffer::DISABLE:
+			if (!SetCapability(header.args[0], header.type == CommandBuffer::ENABLE))
+				skipped++;
+			break;
+
+		case CommandBuffer::UNIFORM_INT:
+			glUniform1i((GLint)header.args[0], (GLint)header.args[1]);
+			break;
+
+		case CommandBuffer::UNIFORM_VEC2:
+			glUniform2fv((GLint)header.args[0], 1, (const GLfloat*)payload);
+			break;
+
+		case CommandBuffer::UNIFORM_MAT4:
+			glUniformMatrix4fv((GLint)header.args[0], 1, GL_FALSE, (const GLfloat*)payload);
+			break;
+
+		case CommandBuffer::BUFFER_DATA:
+		{
+			const GLenum target = header.args[0] >> 16;
+			const GLenum usage = header.args[0] & 0xFFFF;
+			const GLsizeiptr bytes = (GLsizeiptr)*(const uint64_t*)payload;
+			// only the array buffer binding is cached; element buffers belong to the vertex array
+			if (target != GL_ARRAY_BUFFER || header.args[1] != arrayBuffer)
+				glBindBuffer(target, header.args[1]);
+			else
+				skipped++;
+			if (target == GL_ARRAY_BUFFER)
+				arrayBuffer = header.args[1];
+			glBufferData(target, bytes, (const uint8_t*)payload + CommandBuffer::ALIGNMENT, usage);
+			break;
+		}
+
+		case CommandBuffer::DRAW_ARRAYS:
+		{
+			const GLint* args = (const GLint*)payload;
+			glDrawArrays(header.args[0], args[0], args[1]);
+			break;
+		}
+
+		case CommandBuffer::DRAW_ELEMENTS_INSTANCED:
+		{
+			const uint64_t* args = (const uint64_t*)payload;
+			glDrawElementsInstanced(header.args[0], (GLsizei)args[0], header.args[1], (const void*)(size_t)args[1], (GLsizei)args[2]);
+			break;
+		}
+		}
+	}
+
+	replayed += buffer.commands;
+	filtered += skipped;
+}
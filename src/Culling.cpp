@@ -0,0 +1,225 @@
+#include "Culling.h"
+
+#include <glm/simd/platform.h>
+
+#include <algorithm>
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+#include <emmintrin.h>
+#endif
+
+BoundingBox TransformBounds(const glm::mat4& m, const BoundingBox& local)
+{
+	const glm::vec3 translation(m[3]);
+	BoundingBox world(translation, translation);
+	for (int col = 0; col < 3; col++)
+	{
+		const glm::vec3 axis(m[col]);
+		const glm::vec3 a = axis * local.min[col];
+		const glm::vec3 b = axis * local.max[col];
+		world.min += glm::min(a, b);
+		world.max += glm::max(a, b);
+	}
+	return world;
+}
+
+Frustum::Frustum()
+{
+	// accepts everything
+	for (int i = 0; i < PLANES; i++)
+	{
+		nx[i] = ny[i] = nz[i] = ax[i] = ay[i] = az[i] = 0.0f;
+		d[i] = 1.0f;
+	}
+}
+
+Frustum::Frustum(const glm::mat4& clip)
+	: Frustum()
+{
+	// -w <= x, y, z <= w, with rows of the column-major matrix
+	const glm::vec4 x(clip[0][0], clip[1][0], clip[2][0], clip[3][0]);
+	const glm::vec4 y(clip[0][1], clip[1][1], clip[2][1], clip[3][1]);
+	const glm::vec4 z(clip[0][2], clip[1][2], clip[2][2], clip[3][2]);
+	const glm::vec4 w(clip[0][3], clip[1][3], clip[2][3], clip[3][3]);
+	const glm::vec4 planes[6] = { w + x, w - x, w + y, w - y, w + z, w - z };
+
+	for (int i = 0; i < 6; i++)
+	{
+		// normalized so sphere radii compare to real distances
+		const float length = glm::length(glm::vec3(planes[i]));
+		const glm::vec4 p = length > 0.0f ? planes[i] / length : glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);
+		nx[i] = p.x; ny[i] = p.y; nz[i] = p.z; d[i] = p.w;
+		ax[i] = std::abs(p.x); ay[i] = std::abs(p.y); az[i] = std::abs(p.z);
+	}
+	// planes 6 and 7 stay at the constructor's (0, 0, 0, 1), which nothing is outside of
+}
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+// 'distance' is the signed distance of the center to four planes, 'radius' the
+// volume's extent along their normals
+static inline int OutsideMask(__m128 distance, __m128 radius)
+{
+	return _mm_movemask_ps(_mm_cmplt_ps(_mm_add_ps(distance, radius), _mm_setzero_ps()));
+}
+
+static inline int IntersectMask(__m128 distance, __m128 radius)
+{
+	return _mm_movemask_ps(_mm_cmplt_ps(_mm_sub_ps(distance, radius), _mm_setzero_ps()));
+}
+
+Visibility Frustum::Test(const BoundingBox& box) const
+{
+	const glm::vec3 c = box.Center();
+	const glm::vec3 e = box.Extents();
+	const __m128 cx = _mm_set1_ps(c.x), cy = _mm_set1_ps(c.y), cz = _mm_set1_ps(c.z);
+	const __m128 ex = _mm_set1_ps(e.x), ey = _mm_set1_ps(e.y), ez = _mm_set1_ps(e.z);
+
+	int outside = 0, intersect = 0;
+	for (int i = 0; i < PLANES; i += 4)
+	{
+		const __m128 distance = _mm_add_ps(
+			_mm_add_ps(_mm_mul_ps(_mm_loadu_ps(nx + i), cx), _mm_mul_ps(_mm_loadu_ps(ny + i), cy)),
+			_mm_add_ps(_mm_mul_ps(_mm_loadu_ps(nz + i), cz), _mm_loadu_ps(d + i)));
+		const __m128 radius = _mm_add_ps(
+			_mm_add_ps(_mm_mul_ps(_mm_loadu_ps(ax + i), ex), _mm_mul_ps(_mm_loadu_ps(ay + i), ey)),
+			_mm_mul_ps(_mm_loadu_ps(az + i), ez));
+		outside |= OutsideMask(distance, radius);
+		intersect |= IntersectMask(distance, radius);
+	}
+	if (outside)
+		return Visibility::Outside;
+	return intersect ? Visibility::Intersecting : Visibility::Inside;
+}
+
+Visibility Frustum::Test(const BoundingSphere& sphere) const
+{
+	const __m128 cx = _mm_set1_ps(sphere.center.x), cy = _mm_set1_ps(sphere.center.y), cz = _mm_set1_ps(sphere.center.z);
+	const __m128 radius = _mm_set1_ps(sphere.radius);
+
+	int outside = 0, intersect = 0;
+	for (int i = 0; i < PLANES; i += 4)
+	{
+		const __m128 distance = _mm_add_ps(
+			_mm_add_ps(_mm_mul_ps(_mm_loadu_ps(nx + i), cx), _mm_mul_ps(_mm_loadu_ps(ny + i), cy)),
+			_mm_add_ps(_mm_mul_ps(_mm_loadu_ps(nz + i), cz), _mm_loadu_ps(d + i)));
+		outside |= OutsideMask(distance, radius);
+		intersect |= IntersectMask(distance, radius);
+	}
+	if (outside)
+		return Visibility::Outside;
+	return intersect ? Visibility::Intersecting : Visibility::Inside;
+}
+
+#else
+
+Visibility Frustum::Test(const BoundingBox& box) const
+{
+	const glm::vec3 c = box.Center();
+	const glm::vec3 e = box.Extents();
+	bool intersect = false;
+	for (int i = 0; i < PLANES; i++)
+	{
+		const float distance = nx[i] * c.x + ny[i] * c.y + nz[i] * c.z + d[i];
+		const float radius = ax[i] * e.x + ay[i] * e.y + az[i] * e.z;
+		if (distance + radius < 0.0f)
+			return Visibility::Outside;
+		intersect |= distance - radius < 0.0f;
+	}
+	return intersect ? Visibility::Intersecting : Visibility::Inside;
+}
+
+Visibility Frustum::Test(const BoundingSphere& sphere) const
+{
+	bool intersect = false;
+	for (int i = 0; i < PLANES; i++)
+	{
+		const float distance = nx[i] * sphere.center.x + ny[i] * sphere.center.y + nz[i] * sphere.center.z + d[i];
+		if (distance + sphere.radius < 0.0f)
+			return Visibility::Outside;
+		intersect |= distance - sphere.radius < 0.0f;
+	}
+	return intersect ? Visibility::Intersecting : Visibility::Inside;
+}
+
+#endif
+
+void BoundingVolumeHierarchy::Build(const std::vector<BoundingBox>& bounds)
+{
+	objects = bounds;
+	nodes.clear();
+	order.resize(bounds.size());
+	centers.resize(bounds.size());
+	for (size_t i = 0; i < bounds.size(); i++)
+	{
+		order[i] = (int)i;
+		centers[i] = bounds[i].Center();
+	}
+	if (!bounds.empty())
+	{
+		nodes.reserve(2 * (bounds.size() / LEAF_SIZE + 1));
+		BuildNode(0, (int)bounds.size());
+	}
+}
+
+int BoundingVolumeHierarchy::BuildNode(int first, int count)
+{
+	const int index = (int)nodes.size();
+	nodes.push_back(Node());
+
+	BoundingBox bounds = objects[order[first]];
+	for (int i = 1; i < count; i++)
+		bounds.Merge(objects[order[first + i]]);
+	nodes[index].bounds = bounds;
+	nodes[index].first = first;
+	nodes[index].count = count;
+	nodes[index].right = 0;
+	if (count <= LEAF_SIZE)
+		return index;
+
+	// split at the median center along the longest axis
+	const glm::vec3 size = bounds.max - bounds.min;
+	const int axis = (size.x >= size.y && size.x >= size.z) ? 0 : (size.y >= size.z ? 1 : 2);
+	const int half = count / 2;
+	std::nth_element(order.begin() + first, order.begin() + first + half, order.begin() + first + count,
+		[this, axis](int a, int b) { return centers[a][axis] < centers[b][axis]; });
+
+	BuildNode(first, half);
+	const int right = BuildNode(first + half, count - half);
+	// 'nodes' may have grown, so no reference is kept across the recursion
+	nodes[index].right = right;
+	return index;
+}
+
+void BoundingVolumeHierarchy::Query(const Frustum& frustum, std::vector<int>& visible) const
+{
+	if (!nodes.empty())
+		QueryNode(0, frustum, visible);
+}
+
+void BoundingVolumeHierarchy::QueryNode(int index, const Frustum& frustum, std::vector<int>& visible) const
+{
+	const Node& node = nodes[index];
+	const Visibility visibility = frustum.Test(node.bounds);
+	if (visibility == Visibility::Outside)
+		return;
+
+	if (visibility == Visibility::Inside)
+	{
+		visible.insert(visible.end(), order.begin() + node.first, order.begin() + node.first + node.count);
+		return;
+	}
+
+	if (node.right == 0)
+	{
+		for (int i = node.first; i < node.first + node.count; i++)
+		{
+			if (frustum.Test(objects[order[i]]) != Visibility::Outside)
+				visible.push_back(order[i]);
+		}
+		return;
+	}
+
+	QueryNode(index + 1, frustum, visible);
+	QueryNode(node.right, frustum, visible);
+}
@@ -0,0 +1,125 @@
+#include "FeatureTracker.h"
+
+#include <opencv2/imgproc.hpp>
+#include <opencv2/video/tracking.hpp>
+
+// glm::vec2 and cv::Point2f are both two packed floats, so the SoA streams
+// can be stored straight into the point vectors the LK call takes
+static_assert(sizeof(glm::vec2) == sizeof(cv::Point2f), "point layouts differ");
+
+FeatureTracker::FeatureTracker()
+	: current(0), previousLevels(-1), nextId(0), frames(0), detections(0), totalMs(0.0)
+{
+	positions.reserve(MAX_TRACKS);
+	velocities.reserve(MAX_TRACKS);
+	ids.reserve(MAX_TRACKS);
+	ages.reserve(MAX_TRACKS);
+	predicted.reserve(MAX_TRACKS);
+	previousPoints.reserve(MAX_TRACKS);
+	nextPoints.reserve(MAX_TRACKS);
+	status.reserve(MAX_TRACKS);
+	errors.reserve(MAX_TRACKS);
+	corners.reserve(MAX_TRACKS);
+}
+
+void FeatureTracker::Reset()
+{
+	positions.clear();
+	velocities.clear();
+	ids.resize(0);
+	ages.resize(0);
+	previousLevels = -1;
+}
+
+void FeatureTracker::Process(const cv::Mat& gray)
+{
+	if (gray.empty())
+		return;
+
+	const int64 start = cv::getTickCount();
+
+	// a new frame size invalidates the old pyramid and every track
+	if (!pyramids[current].empty() && pyramids[current][0].size() != gray.size())
+		Reset();
+
+	current = 1 - current;
+	const cv::Size window(WINDOW_SIZE, WINDOW_SIZE);
+	const int levels = cv::buildOpticalFlowPyramid(gray, pyramids[current], window, MAX_LEVEL, true);
+
+	if (previousLevels >= 0 && !positions.empty())
+		Flow(std::min(levels, previousLevels));
+	previousLevels = levels;
+
+	if ((int)positions.size() < MIN_TRACKS)
+		Detect(gray);
+
+	frames++;
+	totalMs += (cv::getTickCount() - start) * 1000.0 / cv::getTickFrequency();
+}
+
+void FeatureTracker::Flow(int levels)
+{
+	const size_t n = positions.size();
+
+	// start every search where constant motion puts the point
+	predicted = positions;
+	predicted += velocities;
+
+	previousPoints.resize(n);
+	nextPoints.resize(n);
+	positions.store((glm::vec2*)previousPoints.data());
+	predicted.store((glm::vec2*)nextPoints.data());
+
+	cv::calcOpticalFlowPyrLK(pyramids[1 - current], pyramids[current], previousPoints, nextPoints, status, errors,
+		cv::Size(WINDOW_SIZE, WINDOW_SIZE), levels,
+		cv::TermCriteria(cv::TermCriteria::COUNT + cv::TermCriteria::EPS, 30, 0.01), cv::OPTFLOW_USE_INITIAL_FLOW);
+
+	// compact the survivors in place
+	const cv::Size frame = pyramids[current][0].size();
+	float* px = positions.x();
+	float* py = positions.y();
+	float* vx = velocities.x();
+	float* vy = velocities.y();
+	size_t kept = 0;
+	for (size_t i = 0; i < n; i++)
+	{
+		const cv::Point2f& p = nextPoints[i];
+		if (!status[i] || p.x < 0.0f || p.y < 0.0f || p.x >= frame.width || p.y >= frame.height)
+			continue;
+		vx[kept] = p.x - previousPoints[i].x;
+		vy[kept] = p.y - previousPoints[i].y;
+		px[kept] = p.x;
+		py[kept] = p.y;
+		ids[kept] = ids[i];
+		ages[kept] = ages[i] + 1;
+		kept++;
+	}
+	positions.resize(kept);
+	velocities.resize(kept);
+	ids.resize(kept);
+	ages.resize(kept);
+}
+
+void FeatureTracker::Detect(const cv::Mat& gray)
+{
+	// keep new corners away from the tracks still alive
+	mask.create(gray.size(), CV_8U);
+	mask.setTo(cv::Scalar::all(255));
+	for (size_t i = 0; i < positions.size(); i++)
+		cv::circle(mask, cv::Point(cvRound(positions.x()[i]), cvRound(positions.y()[i])), MIN_DISTANCE, cv::Scalar::all(0), -1);
+
+	const int wanted = MAX_TRACKS - (int)positions.size();
+	cv::goodFeaturesToTrack(gray, corners, wanted, 0.01, MIN_DISTANCE, mask);
+	detections++;
+
+	for (size_t i = 0; i < corners.size(); i++)
+	{
+		const size_t k = positions.size();
+		positions.push_back(glm::vec2(corners[i].x, corners[i].y));
+		velocities.push_back(glm::vec2(0.0f));
+		ids.resize(k + 1);
+		ages.resize(k + 1);
+		ids[k] = nextId++;
+		ages[k] = 0;
+	}
+}
@@ -0,0 +1,89 @@
+#include "FileCache.h"
+
+#include <cstdio>
+#include <sys/stat.h>
+
+#ifdef _WIN32
+#include <direct.h>
+#define MAKE_DIRECTORY(path) _mkdir(path)
+#else
+#define MAKE_DIRECTORY(path) mkdir(path, 0755)
+#endif
+
+namespace FileCache
+{
+	uint64_t Hash(const void* data, size_t size, uint64_t seed)
+	{
+		const unsigned char* p = (const unsigned char*)data;
+		uint64_t hash = seed;
+		for (size_t i = 0; i < size; i++)
+		{
+			hash ^= p[i];
+			hash *= 1099511628211ULL;
+		}
+		return hash;
+	}
+
+	std::string EntryPath(const std::string& directory, const std::string& prefix, uint64_t key, const std::string& extension)
+	{
+		char hex[17];
+		snprintf(hex, sizeof(hex), "%016llx", (unsigned long long)key);
+
+		std::string path = directory;
+		if (!path.empty() && path.back() != '/' && path.back() != '\\')
+			path += '/';
+		return path + prefix + "_" + hex + extension;
+	}
+
+	bool EnsureDirectory(const std::string& directory)
+	{
+		if (directory.empty())
+			return true;
+
+		// create every parent in turn; failures on parents that already exist
+		// (or drive letters) do not matter, only the final directory does
+		for (size_t i = 1; i <= directory.size(); i++)
+		{
+			if (i == directory.size() || directory[i] == '/' || directory[i] == '\\')
+				MAKE_DIRECTORY(directory.substr(0, i).c_str());
+		}
+
+		struct stat info;
+		return stat(directory.c_str(), &info) == 0 && (info.st_mode & S_IFDIR) != 0;
+	}
+
+	bool Read(const std::string& path, std::vector<unsigned char>& data)
+	{
+		FILE* file = fopen(path.c_str(), "rb");
+		if (file == NULL)
+			return false;
+
+		fseek(file, 0, SEEK_END);
+		const long size = ftell(file);
+		fseek(file, 0, SEEK_SET);
+
+		data.resize(size > 0 ? (size_t)size : 0);
+		const bool ok = size >= 0 && fread(data.data(), 1, data.size(), file) == data.size();
+		fclose(file);
+		return ok;
+	}
+
+	bool Write(const std::string& path, const void* data, size_t size)
+	{
+		const std::string temporary = path + ".tmp";
+		FILE* file = fopen(temporary.c_str(), "wb");
+		if (file == NULL)
+			return false;
+
+		const bool written = fwrite(data, 1, size, file) == size;
+		if (fclose(file) != 0 || !written)
+		{
+			remove(temporary.c_str());
+			return false;
+		}
+
+		// rename does not replace an existing file on Windows
+		remove(path.c_str());
+		return rename(temporary.c_str(), path.c_str()) == 0;
+	}
+}
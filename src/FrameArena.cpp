@@ -0,0 +1,231 @@
+#include "FrameArena.h"
+
+#include <algorithm>
+#include <new>
+
+// marks buffers that did not fit the region and came from cv::fastMalloc
+static const int HEAP_BUFFER = 1;
+
+FrameArena::FrameArena(size_t capacity, int maxMats)
+	: region(NULL), capacity(0), maxCapacity(std::max<size_t>(capacity, 256 << 20)), offset(0), frameBytes(0),
+	pool(NULL), poolSize(0),
+	live(0), frameLive(0), frameHeap(0), lastFrameHeap(0), totalHeap(0), peakBytes(0), deferredResets(0)
+{
+	AllocateRegion(capacity);
+	AllocatePool(maxMats);
+}
+
+FrameArena::~FrameArena()
+{
+	CV_DbgAssert(live == 0);
+	cv::fastFree(region);
+	cv::fastFree(pool);
+}
+
+void FrameArena::AllocateRegion(size_t size)
+{
+	cv::fastFree(region);
+	region = size > 0 ? (uchar*)cv::fastMalloc(size) : NULL;
+	capacity = size;
+	offset = 0;
+}
+
+void FrameArena::AllocatePool(int count)
+{
+	// headers are constructed in place on allocate and destroyed on deallocate
+	cv::fastFree(pool);
+	pool = (uchar*)cv::fastMalloc(count * sizeof(cv::UMatData));
+	poolSize = count;
+
+	freeHeaders.clear();
+	freeHeaders.reserve(count);
+	for (int i = count - 1; i >= 0; i--)
+		freeHeaders.push_back((cv::UMatData*)(pool + i * sizeof(cv::UMatData)));
+}
+
+bool FrameArena::InPool(const cv::UMatData* u) const
+{
+	const uchar* p = (const uchar*)u;
+	return p >= pool && p < pool + poolSize * sizeof(cv::UMatData);
+}
+
+void FrameArena::Reset()
+{
+	std::lock_guard<std::mutex> lock(mutex);
+
+	// rewinding under a live Mat would hand its memory to someone else
+	if (live > 0)
+	{
+		deferredResets++;
+		return;
+	}
+
+	lastFrameHeap = frameHeap;
+	peakBytes = std::max(peakBytes, frameBytes);
+
+	// grow once to what the frame really needed, with some headroom
+	if (frameBytes > capacity && capacity < maxCapacity)
+		AllocateRegion(std::min(maxCapacity, cv::alignSize(frameBytes + frameBytes / 4, (int)ALIGNMENT)));
+	if (frameLive > poolSize)
+		AllocatePool(frameLive + frameLive / 2);
+
+	offset = 0;
+	frameBytes = 0;
+	frameHeap = 0;
+	frameLive = 0;
+}
+
+cv::Mat FrameArena::NewMat()
+{
+	cv::Mat m;
+	m.allocator = this;
+	return m;
+}
+
+size_t FrameArena::LastFrameHeapAllocations() const
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return lastFrameHeap;
+}
+
+size_t FrameArena::TotalHeapAllocations() const
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return totalHeap;
+}
+
+size_t FrameArena::PeakFrameBytes() const
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return std::max(peakBytes, frameBytes);
+}
+
+int FrameArena::DeferredResets() const
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return deferredResets;
+}
+
+cv::UMatData* FrameArena::allocate(int dims, const int* sizes, int type,
+	void* data0, size_t* step, int /*flags*/, cv::UMatUsageFlags /*usageFlags*/) const
+{
+	// same step computation as OpenCV's StdMatAllocator
+	size_t total = CV_ELEM_SIZE(type);
+	for (int i = dims - 1; i >= 0; i--)
+	{
+		if (step)
+		{
+			if (data0 && step[i] != CV_AUTOSTEP)
+			{
+				CV_Assert(total <= step[i]);
+				total = step[i];
+			}
+			else
+				step[i] = total;
+		}
+		total *= sizes[i];
+	}
+
+	std::lock_guard<std::mutex> lock(mutex);
+
+	cv::UMatData* u;
+	if (!freeHeaders.empty())
+	{
+		u = new (freeHeaders.back()) cv::UMatData(this);
+		freeHeaders.pop_back();
+	}
+	else
+	{
+		u = new cv::UMatData(this);
+		frameHeap++;
+		totalHeap++;
+	}
+
+	if (data0)
+	{
+		u->data = u->origdata = (uchar*)data0;
+		u->flags |= cv::UMatData::USER_ALLOCATED;
+	}
+	else
+	{
+		const size_t aligned = cv::alignSize(total, (int)ALIGNMENT);
+		frameBytes += aligned;
+		if (offset + aligned <= capacity)
+		{
+			u->data = u->origdata = region + offset;
+			offset += aligned;
+		}
+		else
+		{
+			u->data = u->origdata = (uchar*)cv::fastMalloc(total);
+			u->allocatorFlags_ = HEAP_BUFFER;
+			frameHeap++;
+			totalHeap++;
+		}
+	}
+	u->size = total;
+
+	live++;
+	frameLive = std::max(frameLive, live);
+	return u;
+}
+
+bool FrameArena::allocate(cv::UMatData* u, int /*accessFlags*/, cv::UMatUsageFlags /*usageFlags*/) const
+{
+	return u != NULL;
+}
+
+void FrameArena::deallocate(cv::UMatData* u) const
+{
+	if (u == NULL)
+		return;
+
+	CV_Assert(u->urefcount == 0 && u->refcount == 0);
+
+	// region memory is only reclaimed by Reset()
+	if (u->allocatorFlags_ & HEAP_BUFFER)
+		cv::fastFree(u->origdata);
+	u->origdata = NULL;
+
+	std::lock_guard<std::mutex> lock(mutex);
+	if (InPool(u))
+	{
+		u->~UMatData();
+		freeHeaders.push_back(u);
+	}
+	else
+		delete u;
+	live--;
+}
+
+cv::BufferPoolController* FrameArena::getBufferPoolController(const char* /*id*/) const
+{
+	return const_cast<FrameArena*>(this);
+}
+
+size_t FrameArena::getReservedSize() const
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return capacity;
+}
+
+size_t FrameArena::getMaxReservedSize() const
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return maxCapacity;
+}
+
+void FrameArena::setMaxReservedSize(size_t size)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	maxCapacity = size;
+	if (capacity > maxCapacity && live == 0)
+		AllocateRegion(maxCapacity);
+}
+
+void FrameArena::freeAllReservedBuffers()
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	if (live == 0)
+		AllocateRegion(0);
+}
@@ -0,0 +1,184 @@
+#include "FramePacer.h"
+
+#include <algorithm>
+#include <iostream>
+#include <thread>
+
+FramePacer::FramePacer()
+	: window(NULL), mode(PacingMode::VSync), framePeriod(1.0 / 60.0), tearControl(false), dirty(true), queryIndex(0)
+{
+	for (int i = 0; i < QUERY_COUNT; i++)
+	{
+		queries[i] = 0;
+		queryPending[i] = false;
+	}
+	stats = FrameStats();
+}
+
+FramePacer::~FramePacer()
+{
+	Release();
+}
+
+void FramePacer::Init(GLFWwindow* window, PacingMode mode, double targetFps)
+{
+	this->window = window;
+	framePeriod = 1.0 / (targetFps > 0.0 ? targetFps : 60.0);
+	tearControl = glfwExtensionSupported("WGL_EXT_swap_control_tear") || glfwExtensionSupported("GLX_EXT_swap_control_tear");
+
+	glGenQueries(QUERY_COUNT, queries);
+	SetMode(mode);
+}
+
+void FramePacer::Release()
+{
+	if (queries[0] != 0)
+	{
+		glDeleteQueries(QUERY_COUNT, queries);
+		for (int i = 0; i < QUERY_COUNT; i++)
+		{
+			queries[i] = 0;
+			queryPending[i] = false;
+		}
+	}
+	window = NULL;
+}
+
+void FramePacer::SetMode(PacingMode mode)
+{
+	this->mode.store(mode);
+
+	switch (mode)
+	{
+	case PacingMode::VSync:
+		glfwSwapInterval(1);
+		break;
+	case PacingMode::AdaptiveVSync:
+		if (!tearControl)
+			std::cout << "Adaptive vsync not supported by the driver, using vsync" << std::endl;
+		glfwSwapInterval(tearControl ? -1 : 1);
+		break;
+	case PacingMode::FixedRate:
+	case PacingMode::OnDemand:
+		// OnDemand draws rarely enough that waiting for vblank would only add latency
+		glfwSwapInterval(0);
+		break;
+	}
+
+	deadline = Clock::now();
+	dirty.store(true);
+}
+
+bool FramePacer::WaitForFrame()
+{
+	switch (mode)
+	{
+	case PacingMode::VSync:
+	case PacingMode::AdaptiveVSync:
+		// the swap already blocked on vblank
+		glfwPollEvents();
+		return true;
+
+	case PacingMode::FixedRate:
+	{
+		// sleep most of the way, then yield for the last stretch since sleep granularity
+		// is around a millisecond on most systems
+		const Clock::duration spin = std::chrono::milliseconds(1);
+		if (Clock::now() + spin < deadline)
+			std::this_thread::sleep_until(deadline - spin);
+		while (Clock::now() < deadline)
+			std::this_thread::yield();
+
+		// a missed deadline restarts the schedule instead of bursting to catch up
+		const Clock::duration period = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(framePeriod));
+		const Clock::time_point now = Clock::now();
+		deadline = (now - deadline > period) ? now + period : deadline + period;
+
+		glfwPollEvents();
+		return true;
+	}
+
+	case PacingMode::OnDemand:
+	{
+		if (dirty.exchange(false))
+		{
+			glfwPollEvents();
+			return true;
+		}
+
+		// any window event wakes us early, but only those that marked the frame
+		// dirty (bound keys, resizes, exposes, new camera frames) cause a redraw
+		glfwWaitEventsTimeout(MAX_IDLE_SECONDS);
+		if (dirty.exchange(false))
+			return true;
+
+		stats.skipped++;
+		return false;
+	}
+	}
+	return true;
+}
+
+void FramePacer::BeginFrame()
+{
+	frameStart = Clock::now();
+
+	CollectGpuQueries();
+
+	// a query whose result never showed up is simply overwritten
+	queryPending[queryIndex] = false;
+	glBeginQuery(GL_TIME_ELAPSED, queries[queryIndex]);
+}
+
+void FramePacer::EndFrame()
+{
+	glEndQuery(GL_TIME_ELAPSED);
+	queryPending[queryIndex] = true;
+	queryIndex = (queryIndex + 1) % QUERY_COUNT;
+
+	const Clock::time_point cpuEnd = Clock::now();
+	glfwSwapBuffers(window);
+	const Clock::time_point presented = Clock::now();
+
+	stats.frames++;
+	Accumulate(stats.cpu, std::chrono::duration<double, std::milli>(cpuEnd - frameStart).count(), stats.frames);
+	Accumulate(stats.present, std::chrono::duration<double, std::milli>(presented - frameStart).count(), stats.frames);
+}
+
+void FramePacer::MarkDirty()
+{
+	dirty.store(true);
+	if (mode.load() == PacingMode::OnDemand)
+		glfwPostEmptyEvent();
+}
+
+void FramePacer::CollectGpuQueries()
+{
+	// results of older frames, oldest first, without stalling on ones still in flight
+	for (int i = 1; i <= QUERY_COUNT; i++)
+	{
+		const int index = (queryIndex + i) % QUERY_COUNT;
+		if (!queryPending[index])
+			continue;
+
+		GLint available = 0;
+		glGetQueryObjectiv(queries[index], GL_QUERY_RESULT_AVAILABLE, &available);
+		if (!available)
+			continue;
+
+		GLuint64 elapsed = 0;
+		glGetQueryObjectui64v(queries[index], GL_QUERY_RESULT, &elapsed);
+		queryPending[index] = false;
+
+		Accumulate(stats.gpu, elapsed / 1.0e6, stats.frames);
+	}
+}
+
+void FramePacer::Accumulate(FrameTimeStat& stat, double ms, unsigned long long count)
+{
+	// exponential moving average over roughly the last 64 frames
+	const double alpha = 1.0 / 64.0;
+	stat.last = ms;
+	stat.average = (count <= 1 || stat.average == 0.0) ? ms : stat.average + (ms - stat.average) * alpha;
+	stat.worst = std::max(stat.worst, ms);
+}
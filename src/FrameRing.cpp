@@ -0,0 +1,60 @@
+#include "FrameRing.h"
+
+#include <algorithm>
+
+FrameRing::FrameRing(int capacity, cv::Size size, int type)
+	: slots(std::max(capacity, 3)), frameSize(size), head(0), droppedFull(0), tail(0), droppedSkipped(0), stale(0)
+{
+	// preallocate every slot so retrieve() never touches the heap in steady state
+	for (size_t i = 0; i < slots.size(); i++)
+		slots[i].create(size, type);
+}
+
+cv::Mat* FrameRing::BeginWrite()
+{
+	const uint64_t h = head.load(std::memory_order_relaxed);
+	const uint64_t t = tail.load(std::memory_order_acquire);
+
+	// slot (t - 1) is held by the consumer, so only capacity - 1 slots are writable
+	if (h - t >= slots.size() - 1)
+		return NULL;
+
+	return &slots[h % slots.size()];
+}
+
+void FrameRing::CommitWrite()
+{
+	head.store(head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+void FrameRing::CancelWrite()
+{
+	// nothing was published; the slot is simply reused by the next BeginWrite
+}
+
+void FrameRing::DropWrite()
+{
+	droppedFull.fetch_add(1, std::memory_order_relaxed);
+}
+
+bool FrameRing::AcquireLatest(cv::Mat& frame)
+{
+	const uint64_t h = head.load(std::memory_order_acquire);
+	const uint64_t t = tail.load(std::memory_order_relaxed);
+
+	if (h == t)
+	{
+		stale.fetch_add(1, std::memory_order_relaxed);
+		return false;
+	}
+
+	if (h - t > 1)
+		droppedSkipped.fetch_add(h - t - 1, std::memory_order_relaxed);
+
+	// shallow header copy, the pixel data stays in the slot
+	frame = slots[(h - 1) % slots.size()];
+
+	// releases every slot before h - 1 back to the producer
+	tail.store(h, std::memory_order_release);
+	return true;
+}
@@ -0,0 +1,88 @@
+#include "FrameSink.h"
+
+#include <opencv2/imgcodecs.hpp>
+
+#include <cstdio>
+#include <iostream>
+
+#include "FileCache.h"
+
+FrameSink::FrameSink()
+	: fps(0.0), count(0)
+{
+}
+
+bool FrameSink::Open(const std::string& path, double fps, cv::Size size)
+{
+	Close();
+	if (path.empty())
+		return true;
+	this->fps = fps > 0.0 ? fps : 30.0;
+
+	if (RawFrameWriter::IsRawPath(path))
+		return rawWriter.Open(path, size, CV_8UC3, this->fps);
+
+	if (IsVideoPath(path))
+	{
+		const int fourcc = (path.compare(path.size() - 4, 4, ".avi") == 0)
+			? cv::VideoWriter::fourcc('M', 'J', 'P', 'G')
+			: cv::VideoWriter::fourcc('m', 'p', '4', 'v');
+		if (!writer.open(path, fourcc, this->fps, size))
+		{
+			std::cout << "Failed to open output video " << path << std::endl;
+			return false;
+		}
+		return true;
+	}
+
+	// anything else is a directory receiving frame_000000.png, frame_000001.png, ...
+	// stat() on Windows rejects a trailing separator, so check the directory without it
+	std::string trimmed = path;
+	while (trimmed.size() > 1 && (trimmed.back() == '/' || trimmed.back() == '\\'))
+		trimmed.pop_back();
+	if (!FileCache::EnsureDirectory(trimmed))
+	{
+		std::cout << "Failed to create output directory " << path << std::endl;
+		return false;
+	}
+	directory = trimmed + '/';
+	return true;
+}
+
+void FrameSink::Close()
+{
+	writer.release();
+	rawWriter.Close();
+	directory.clear();
+	count = 0;
+}
+
+void FrameSink::Write(const cv::Mat& frame)
+{
+	if (writer.isOpened())
+		writer.write(frame);
+	else if (rawWriter.IsOpen())
+	{
+		if (!rawWriter.Write(frame, count / fps))
+			std::cout << "Failed to write frame " << count << std::endl;
+	}
+	else if (!directory.empty())
+	{
+		char name[32];
+		snprintf(name, sizeof(name), "frame_%06d.png", count);
+		if (!cv::imwrite(directory + name, frame))
+			std::cout << "Failed to write " << directory + name << std::endl;
+	}
+
+	if (callback)
+		callback(frame, count);
+	count++;
+}
+
+bool FrameSink::IsVideoPath(const std::string& path)
+{
+	if (path.size() < 4)
+		return false;
+	const std::string ext = path.substr(path.size() - 4);
+	return ext == ".avi" || ext == ".mp4" || ext == ".mkv";
+}
@@ -0,0 +1,79 @@
+#include "FrameSource.h"
+
+#include <iostream>
+
+std::unique_ptr<FrameSource> FrameSource::Open(const std::string& path, cv::Size cameraSize, double cameraFps)
+{
+	if (RawFrameWriter::IsRawPath(path))
+	{
+		std::unique_ptr<RawFileSource> source(new RawFileSource());
+		if (!source->Open(path))
+			return NULL;
+		return source;
+	}
+
+	std::unique_ptr<VideoCaptureSource> source(new VideoCaptureSource());
+	if (path.empty() ? !source->OpenCamera(0, cameraSize, cameraFps) : !source->OpenFile(path))
+		return NULL;
+	return source;
+}
+
+bool VideoCaptureSource::OpenFile(const std::string& path)
+{
+	if (!capture.open(path))
+	{
+		std::cout << "Failed to open " << path << std::endl;
+		return false;
+	}
+	return true;
+}
+
+bool VideoCaptureSource::OpenCamera(int index, cv::Size size, double fps)
+{
+	if (!capture.open(index))
+	{
+		std::cout << "Failed to open camera" << std::endl;
+		return false;
+	}
+	capture.set(cv::CAP_PROP_FRAME_WIDTH, size.width);
+	capture.set(cv::CAP_PROP_FRAME_HEIGHT, size.height);
+	capture.set(cv::CAP_PROP_FPS, fps);
+	return true;
+}
+
+cv::Size VideoCaptureSource::FrameSize() const
+{
+	return cv::Size((int)capture.get(cv::CAP_PROP_FRAME_WIDTH), (int)capture.get(cv::CAP_PROP_FRAME_HEIGHT));
+}
+
+double VideoCaptureSource::Fps() const
+{
+	return capture.get(cv::CAP_PROP_FPS);
+}
+
+RawFileSource::RawFileSource()
+	: current(-1)
+{
+}
+
+bool RawFileSource::Open(const std::string& path)
+{
+	current = -1;
+	return reader.Open(path);
+}
+
+bool RawFileSource::Grab()
+{
+	if (current + 1 >= reader.Count())
+		return false;
+	current++;
+	return true;
+}
+
+bool RawFileSource::Retrieve(cv::Mat& frame)
+{
+	if (current < 0 || current >= reader.Count())
+		return false;
+	frame = reader.Frame(current);
+	return true;
+}
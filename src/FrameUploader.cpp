@@ -0,0 +1,178 @@
+#include "FrameUploader.h"
+
+#include <cstring>
+#include <iostream>
+
+FrameUploader::FrameUploader()
+	: persistent(false), texture(0), next(0), type(-1), format(GL_BGR), rowBytes(0)
+{
+	for (int i = 0; i < RING_SIZE; i++)
+	{
+		pbo[i] = 0;
+		mapped[i] = NULL;
+		fences[i] = NULL;
+	}
+}
+
+FrameUploader::~FrameUploader()
+{
+	Release();
+}
+
+void FrameUploader::Init()
+{
+	// buffer storage is core since 4.4; on older contexts it has to come from the extension,
+	// whose entry point the eager loader only fills in for 4.4 contexts
+	persistent = (GLAD_GL_VERSION_4_4 || gladHasExtension("GL_ARB_buffer_storage")) && glBufferStorage != NULL;
+	if (!persistent)
+		std::cout << "GL_ARB_buffer_storage not available, uploading frames with glTexSubImage2D" << std::endl;
+}
+
+void FrameUploader::Release()
+{
+	ReleaseBuffers();
+	if (texture != 0)
+	{
+		glDeleteTextures(1, &texture);
+		texture = 0;
+	}
+	size = cv::Size();
+	type = -1;
+}
+
+void FrameUploader::Upload(const cv::Mat& frame)
+{
+	if (frame.empty() || frame.depth() != CV_8U)
+		return;
+
+	if ((frame.size() != size || frame.type() != type) && !Allocate(frame.size(), frame.type()))
+		return;
+
+	glBindTexture(GL_TEXTURE_2D, texture);
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+	if (persistent)
+		UploadPersistent(frame);
+	else
+		UploadDirect(frame);
+	glBindTexture(GL_TEXTURE_2D, 0);
+}
+
+bool FrameUploader::Allocate(cv::Size frameSize, int frameType)
+{
+	ReleaseBuffers();
+
+	GLenum internalFormat;
+	switch (CV_MAT_CN(frameType))
+	{
+	case 1: format = GL_RED; internalFormat = GL_R8; break;
+	case 3: format = GL_BGR; internalFormat = GL_RGB8; break;
+	case 4: format = GL_BGRA; internalFormat = GL_RGBA8; break;
+	default:
+		std::cout << "Unsupported frame format for upload" << std::endl;
+		return false;
+	}
+
+	size = frameSize;
+	type = frameType;
+	rowBytes = (size_t)size.width * CV_ELEM_SIZE(frameType);
+
+	if (texture == 0)
+		glGenTextures(1, &texture);
+	glBindTexture(GL_TEXTURE_2D, texture);
+	glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, size.width, size.height, 0, format, GL_UNSIGNED_BYTE, NULL);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+	// show single-channel frames as gray instead of red
+	const bool gray = (format == GL_RED);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_G, gray ? GL_RED : GL_GREEN);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_B, gray ? GL_RED : GL_BLUE);
+	glBindTexture(GL_TEXTURE_2D, 0);
+
+	if (!persistent)
+		return true;
+
+	const GLsizeiptr bytes = (GLsizeiptr)(rowBytes * size.height);
+	const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+	glGenBuffers(RING_SIZE, pbo);
+	for (int i = 0; i < RING_SIZE; i++)
+	{
+		glBindBuffer(GL_PIXEL_UNPACK_BUFFER, pbo[i]);
+		glBufferStorage(GL_PIXEL_UNPACK_BUFFER, bytes, NULL, flags);
+		mapped[i] = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, bytes, flags);
+		if (mapped[i] == NULL)
+		{
+			glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+			std::cout << "Failed to map pixel unpack buffer, falling back to glTexSubImage2D" << std::endl;
+			ReleaseBuffers();
+			persistent = false;
+			return true;
+		}
+	}
+	glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+	next = 0;
+	return true;
+}
+
+void FrameUploader::ReleaseBuffers()
+{
+	for (int i = 0; i < RING_SIZE; i++)
+	{
+		if (fences[i] != NULL)
+		{
+			glDeleteSync(fences[i]);
+			fences[i] = NULL;
+		}
+		if (pbo[i] != 0)
+		{
+			if (mapped[i] != NULL)
+			{
+				glBindBuffer(GL_PIXEL_UNPACK_BUFFER, pbo[i]);
+				glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+				glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+				mapped[i] = NULL;
+			}
+			glDeleteBuffers(1, &pbo[i]);
+			pbo[i] = 0;
+		}
+	}
+}
+
+void FrameUploader::UploadPersistent(const cv::Mat& frame)
+{
+	const int slot = next;
+	next = (next + 1) % RING_SIZE;
+
+	// the GPU finished with this buffer RING_SIZE frames ago in practice,
+	// so this wait returns immediately unless the GPU is badly behind
+	if (fences[slot] != NULL)
+	{
+		glClientWaitSync(fences[slot], GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);
+		glDeleteSync(fences[slot]);
+		fences[slot] = NULL;
+	}
+
+	// the one and only CPU copy of the frame
+	unsigned char* dst = (unsigned char*)mapped[slot];
+	if (frame.isContinuous())
+		memcpy(dst, frame.data, rowBytes * size.height);
+	else
+		for (int y = 0; y < size.height; y++)
+			memcpy(dst + y * rowBytes, frame.ptr(y), rowBytes);
+
+	glBindBuffer(GL_PIXEL_UNPACK_BUFFER, pbo[slot]);
+	glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, size.width, size.height, format, GL_UNSIGNED_BYTE, (const void*)0);
+	glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+	fences[slot] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+}
+
+void FrameUploader::UploadDirect(const cv::Mat& frame)
+{
+	// let GL walk the Mat's stride directly instead of repacking rows
+	glPixelStorei(GL_UNPACK_ROW_LENGTH, (GLint)(frame.step[0] / frame.elemSize()));
+	glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, size.width, size.height, format, GL_UNSIGNED_BYTE, frame.data);
+	glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+}
@@ -0,0 +1,229 @@
+#include "HeadlessContext.h"
+
+#include <cstring>
+#include <iostream>
+
+#if defined(__linux__)
+#include <dlfcn.h>
+
+// the few EGL declarations we need, so the build does not depend on EGL headers.
+// libEGL itself is loaded at runtime and only when headless mode is requested.
+namespace egl
+{
+	typedef void* Display;
+	typedef void* Config;
+	typedef void* Context;
+	typedef void* Surface;
+	typedef int Int;
+	typedef unsigned int Boolean;
+	typedef unsigned int Enum;
+
+	const Int NONE = 0x3038;
+	const Int RENDERABLE_TYPE = 0x3040;
+	const Int OPENGL_BIT = 0x0008;
+	const Int EXTENSIONS = 0x3055;
+	const Enum OPENGL_API = 0x30A2;
+	const Int CONTEXT_MAJOR_VERSION = 0x3098;
+	const Int CONTEXT_MINOR_VERSION = 0x30FB;
+	const Int CONTEXT_OPENGL_PROFILE_MASK = 0x30FD;
+	const Int CONTEXT_OPENGL_CORE_PROFILE_BIT = 0x0001;
+	const Enum PLATFORM_SURFACELESS_MESA = 0x31DD;
+
+	typedef void (*(*GetProcAddressProc)(const char*))(void);
+	typedef Display (*GetPlatformDisplayProc)(Enum platform, void* nativeDisplay, const Int* attribs);
+	typedef Boolean (*InitializeProc)(Display display, Int* major, Int* minor);
+	typedef Boolean (*TerminateProc)(Display display);
+	typedef const char* (*QueryStringProc)(Display display, Int name);
+	typedef Boolean (*BindAPIProc)(Enum api);
+	typedef Boolean (*ChooseConfigProc)(Display display, const Int* attribs, Config* configs, Int size, Int* count);
+	typedef Context (*CreateContextProc)(Display display, Config config, Context share, const Int* attribs);
+	typedef Boolean (*DestroyContextProc)(Display display, Context context);
+	typedef Boolean (*MakeCurrentProc)(Display display, Surface draw, Surface read, Context context);
+
+	static GetProcAddressProc GetProcAddress;
+	static TerminateProc Terminate;
+	static DestroyContextProc DestroyContext;
+	static MakeCurrentProc MakeCurrent;
+
+	// glad wants a void* returning loader
+	static void* LoadProc(const char* name)
+	{
+		return (void*)GetProcAddress(name);
+	}
+}
+#endif
+
+HeadlessContext::HeadlessContext()
+	: eglLibrary(NULL), eglDisplay(NULL), eglContext(NULL), window(NULL), lazyGL(false)
+{
+}
+
+HeadlessContext::~HeadlessContext()
+{
+	Destroy();
+}
+
+bool HeadlessContext::Create(bool lazyGL)
+{
+	this->lazyGL = lazyGL;
+
+	if (CreateEGL())
+	{
+		std::cout << "Headless: surfaceless EGL context" << std::endl;
+		return true;
+	}
+	if (CreateGLFW())
+	{
+		std::cout << "Headless: invisible GLFW window" << std::endl;
+		return true;
+	}
+	std::cout << "Failed to create a headless OpenGL context" << std::endl;
+	return false;
+}
+
+void HeadlessContext::Destroy()
+{
+#if defined(__linux__)
+	if (eglContext != NULL)
+	{
+		egl::MakeCurrent(eglDisplay, NULL, NULL, NULL);
+		egl::DestroyContext(eglDisplay, eglContext);
+		eglContext = NULL;
+	}
+	if (eglDisplay != NULL)
+	{
+		egl::Terminate(eglDisplay);
+		eglDisplay = NULL;
+	}
+	if (eglLibrary != NULL)
+	{
+		dlclose(eglLibrary);
+		eglLibrary = NULL;
+	}
+#endif
+	if (window != NULL)
+	{
+		glfwDestroyWindow(window);
+		window = NULL;
+		glfwTerminate();
+	}
+}
+
+bool HeadlessContext::CreateEGL()
+{
+#if defined(__linux__)
+	eglLibrary = dlopen("libEGL.so.1", RTLD_NOW | RTLD_LOCAL);
+	if (eglLibrary == NULL)
+		return false;
+
+	egl::GetProcAddress = (egl::GetProcAddressProc)dlsym(eglLibrary, "eglGetProcAddress");
+	egl::QueryStringProc queryString = (egl::QueryStringProc)dlsym(eglLibrary, "eglQueryString");
+	if (egl::GetProcAddress == NULL || queryString == NULL)
+	{
+		Destroy();
+		return false;
+	}
+
+	// the surfaceless platform is a client extension, queried without a display
+	const char* clientExtensions = queryString(NULL, egl::EXTENSIONS);
+	egl::GetPlatformDisplayProc getPlatformDisplay = (egl::GetPlatformDisplayProc)egl::GetProcAddress("eglGetPlatformDisplayEXT");
+	if (clientExtensions == NULL || strstr(clientExtensions, "EGL_MESA_platform_surfaceless") == NULL || getPlatformDisplay == NULL)
+	{
+		Destroy();
+		return false;
+	}
+
+	egl::InitializeProc initialize = (egl::InitializeProc)dlsym(eglLibrary, "eglInitialize");
+	egl::BindAPIProc bindAPI = (egl::BindAPIProc)dlsym(eglLibrary, "eglBindAPI");
+	egl::ChooseConfigProc chooseConfig = (egl::ChooseConfigProc)dlsym(eglLibrary, "eglChooseConfig");
+	egl::CreateContextProc createContext = (egl::CreateContextProc)dlsym(eglLibrary, "eglCreateContext");
+	egl::Terminate = (egl::TerminateProc)dlsym(eglLibrary, "eglTerminate");
+	egl::DestroyContext = (egl::DestroyContextProc)dlsym(eglLibrary, "eglDestroyContext");
+	egl::MakeCurrent = (egl::MakeCurrentProc)dlsym(eglLibrary, "eglMakeCurrent");
+	if (!initialize || !bindAPI || !chooseConfig || !createContext || !egl::Terminate || !egl::DestroyContext || !egl::MakeCurrent)
+	{
+		Destroy();
+		return false;
+	}
+
+	eglDisplay = getPlatformDisplay(egl::PLATFORM_SURFACELESS_MESA, NULL, NULL);
+	egl::Int major, minor;
+	if (eglDisplay == NULL || !initialize(eglDisplay, &major, &minor))
+	{
+		eglDisplay = NULL;
+		Destroy();
+		return false;
+	}
+
+	if (!bindAPI(egl::OPENGL_API))
+	{
+		Destroy();
+		return false;
+	}
+
+	// rendering only ever goes to FBOs, so a context without any config
+	// (EGL_KHR_no_config_context) is fine when the driver exposes no configs at all
+	const egl::Int configAttribs[] = { egl::RENDERABLE_TYPE, egl::OPENGL_BIT, egl::NONE };
+	egl::Config config = NULL;
+	egl::Int configCount = 0;
+	if (!chooseConfig(eglDisplay, configAttribs, &config, 1, &configCount) || configCount == 0)
+		config = NULL;
+
+	// OpenGL version : 3.3 core, same as the windowed path
+	const egl::Int contextAttribs[] = {
+		egl::CONTEXT_MAJOR_VERSION, 3,
+		egl::CONTEXT_MINOR_VERSION, 3,
+		egl::CONTEXT_OPENGL_PROFILE_MASK, egl::CONTEXT_OPENGL_CORE_PROFILE_BIT,
+		egl::NONE
+	};
+	eglContext = createContext(eglDisplay, config, NULL, contextAttribs);
+	if (eglContext == NULL || !egl::MakeCurrent(eglDisplay, NULL, NULL, eglContext))
+	{
+		Destroy();
+		return false;
+	}
+
+	if (!LoadGL((GLADloadproc)egl::LoadProc))
+	{
+		std::cout << "Failed to initialize GLAD" << std::endl;
+		Destroy();
+		return false;
+	}
+	return true;
+#else
+	return false;
+#endif
+}
+
+bool HeadlessContext::CreateGLFW()
+{
+	if (!glfwInit())
+		return false;
+
+	glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+	glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+	glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+	glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+
+	// the default framebuffer is never used, keep it tiny
+	window = glfwCreateWindow(1, 1, "HW1 headless", NULL, NULL);
+	if (window == NULL)
+	{
+		glfwTerminate();
+		return false;
+	}
+	glfwMakeContextCurrent(window);
+
+	if (!LoadGL((GLADloadproc)glfwGetProcAddress))
+	{
+		std::cout << "Failed to initialize GLAD" << std::endl;
+		Destroy();
+		return false;
+	}
+	return true;
+}
+
+bool HeadlessContext::LoadGL(GLADloadproc load)
+{
+	return (lazyGL ? gladLoadGLLoaderLazy(load) : gladLoadGLLoader(load)) != 0;
+}
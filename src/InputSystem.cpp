@@ -0,0 +1,309 @@
+#include "InputSystem.h"
+
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+
+static const int MOD_MASK = GLFW_MOD_SHIFT | GLFW_MOD_CONTROL | GLFW_MOD_ALT | GLFW_MOD_SUPER;
+
+struct NamedKey
+{
+	const char* name;
+	int code;
+};
+
+static const NamedKey KEY_NAMES[] = {
+	{ "escape", GLFW_KEY_ESCAPE }, { "space", GLFW_KEY_SPACE }, { "enter", GLFW_KEY_ENTER },
+	{ "tab", GLFW_KEY_TAB }, { "backspace", GLFW_KEY_BACKSPACE },
+	{ "left", GLFW_KEY_LEFT }, { "right", GLFW_KEY_RIGHT }, { "up", GLFW_KEY_UP }, { "down", GLFW_KEY_DOWN }
+};
+
+struct NamedAction
+{
+	const char* name;
+	InputAction action;
+};
+
+static const NamedAction ACTION_NAMES[] = {
+	{ "none", InputAction::None }, { "quit", InputAction::Quit }, { "trace", InputAction::WriteTrace },
+	{ "pacing", InputAction::CyclePacing }, { "overlays", InputAction::ToggleOverlays }
+};
+
+static std::string Lower(std::string s)
+{
+	for (size_t i = 0; i < s.size(); i++)
+		s[i] = (char)tolower((unsigned char)s[i]);
+	return s;
+}
+
+// single key or button name, without modifiers
+static bool ParseKey(const std::string& name, KeyBinding& binding)
+{
+	binding.mouse = false;
+	if (name.size() == 1 && isalnum((unsigned char)name[0]))
+	{
+		// GLFW_KEY_A..Z and GLFW_KEY_0..9 are their upper case ASCII codes
+		binding.code = toupper((unsigned char)name[0]);
+		return true;
+	}
+	if (name.size() >= 2 && name[0] == 'f' && isdigit((unsigned char)name[1]))
+	{
+		const int n = atoi(name.c_str() + 1);
+		binding.code = GLFW_KEY_F1 + n - 1;
+		return n >= 1 && n <= 25;
+	}
+	if (name.compare(0, 5, "mouse") == 0 && name.size() > 5)
+	{
+		const int n = atoi(name.c_str() + 5);
+		binding.code = GLFW_MOUSE_BUTTON_1 + n - 1;
+		binding.mouse = true;
+		return n >= 1 && n <= 8;
+	}
+	for (size_t i = 0; i < sizeof(KEY_NAMES) / sizeof(KEY_NAMES[0]); i++)
+	{
+		if (name == KEY_NAMES[i].name)
+		{
+			binding.code = KEY_NAMES[i].code;
+			return true;
+		}
+	}
+	return false;
+}
+
+InputSystem::InputSystem()
+	: window(NULL), head(0), tail(0), overflows(0),
+	cursor(0.0), cursorKnown(false), cursorDelta(0.0), scroll(0.0), motionEvents(0), events(0)
+{
+}
+
+InputSystem::~InputSystem()
+{
+	Detach();
+}
+
+void InputSystem::Attach(GLFWwindow* window)
+{
+	Detach();
+	this->window = window;
+	glfwSetWindowUserPointer(window, this);
+	glfwSetKeyCallback(window, KeyCallback);
+	glfwSetMouseButtonCallback(window, MouseButtonCallback);
+	glfwSetCursorPosCallback(window, CursorCallback);
+	glfwSetScrollCallback(window, ScrollCallback);
+	glfwSetFramebufferSizeCallback(window, FramebufferSizeCallback);
+	glfwSetWindowRefreshCallback(window, RefreshCallback);
+}
+
+void InputSystem::Detach()
+{
+	if (window == NULL)
+		return;
+	glfwSetKeyCallback(window, NULL);
+	glfwSetMouseButtonCallback(window, NULL);
+	glfwSetCursorPosCallback(window, NULL);
+	glfwSetScrollCallback(window, NULL);
+	glfwSetFramebufferSizeCallback(window, NULL);
+	glfwSetWindowRefreshCallback(window, NULL);
+	glfwSetWindowUserPointer(window, NULL);
+	window = NULL;
+}
+
+void InputSystem::BindDefaults()
+{
+	const KeyBinding defaults[] = {
+		{ GLFW_KEY_ESCAPE, 0, false, InputAction::Quit },
+		{ GLFW_KEY_F12, 0, false, InputAction::WriteTrace },
+		{ GLFW_KEY_P, 0, false, InputAction::CyclePacing },
+		{ GLFW_KEY_O, 0, false, InputAction::ToggleOverlays }
+	};
+	for (size_t i = 0; i < sizeof(defaults) / sizeof(defaults[0]); i++)
+		Bind(defaults[i]);
+}
+
+void InputSystem::Bind(const KeyBinding& binding)
+{
+	const int key = BindingKey(binding.code, binding.mods, binding.mouse);
+	if (binding.action == InputAction::None)
+		table.erase(key);
+	else
+		table[key] = binding.action;
+}
+
+bool InputSystem::ParseBinding(const std::string& spec, KeyBinding& binding)
+{
+	const size_t equals = spec.find('=');
+	if (equals == std::string::npos)
+		return false;
+	std::string key = Lower(spec.substr(0, equals));
+	const std::string action = Lower(spec.substr(equals + 1));
+
+	// modifier prefixes, in any order
+	binding.mods = 0;
+	static const NamedKey MODIFIERS[] = {
+		{ "shift+", GLFW_MOD_SHIFT }, { "ctrl+", GLFW_MOD_CONTROL }, { "alt+", GLFW_MOD_ALT }, { "super+", GLFW_MOD_SUPER }
+	};
+	for (bool found = true; found;)
+	{
+		found = false;
+		for (size_t i = 0; i < sizeof(MODIFIERS) / sizeof(MODIFIERS[0]); i++)
+		{
+			const size_t length = strlen(MODIFIERS[i].name);
+			if (key.size() > length && key.compare(0, length, MODIFIERS[i].name) == 0)
+			{
+				binding.mods |= MODIFIERS[i].code;
+				key = key.substr(length);
+				found = true;
+			}
+		}
+	}
+	if (!ParseKey(key, binding))
+		return false;
+
+	for (size_t i = 0; i < sizeof(ACTION_NAMES) / sizeof(ACTION_NAMES[0]); i++)
+	{
+		if (action == ACTION_NAMES[i].name)
+		{
+			binding.action = ACTION_NAMES[i].action;
+			return true;
+		}
+	}
+	return false;
+}
+
+int InputSystem::BindingKey(int code, int mods, bool mouse)
+{
+	return (mouse ? 1 << 30 : 0) | ((mods & MOD_MASK) << 16) | (code & 0xFFFF);
+}
+
+InputAction InputSystem::Lookup(int code, int mods, bool mouse) const
+{
+	const std::unordered_map<int, InputAction>::const_iterator it = table.find(BindingKey(code, mods, mouse));
+	return it != table.end() ? it->second : InputAction::None;
+}
+
+void InputSystem::Push(const InputEvent& event)
+{
+	// wake an on-demand loop only for what changes the picture
+	bool redraw = event.type == InputEvent::Resize || event.type == InputEvent::Refresh;
+	if ((event.type == InputEvent::Key || event.type == InputEvent::MouseButton) && event.action == GLFW_PRESS)
+		redraw = Lookup(event.code, event.mods, event.type == InputEvent::MouseButton) != InputAction::None;
+
+	// unbound keys, releases and repeats leave the reserved slots free
+	const uint32_t h = head.load(std::memory_order_relaxed);
+	const uint32_t t = tail.load(std::memory_order_acquire);
+	const uint32_t limit = redraw ? QUEUE_SIZE : QUEUE_SIZE - RESERVED_SLOTS;
+	if (h - t >= limit)
+	{
+		overflows.fetch_add(1, std::memory_order_relaxed);
+		if (wake)
+			wake();
+		return;
+	}
+	queue[h & (QUEUE_SIZE - 1)] = event;
+	head.store(h + 1, std::memory_order_release);
+
+	if (redraw && wake)
+		wake();
+}
+
+void InputSystem::Move(double x, double y)
+{
+	const glm::dvec2 position(x, y);
+	if (cursorKnown)
+		cursorDelta += position - cursor;
+	cursor = position;
+	cursorKnown = true;
+	motionEvents++;
+}
+
+void InputSystem::Scroll(double x, double y)
+{
+	scroll += glm::dvec2(x, y);
+	motionEvents++;
+}
+
+void InputSystem::Drain(InputFrame& frame)
+{
+	frame.actions.clear();
+	frame.resized = false;
+	frame.damaged = false;
+
+	const uint32_t h = head.load(std::memory_order_acquire);
+	uint32_t t = tail.load(std::memory_order_relaxed);
+	events += h - t;
+	for (; t != h; t++)
+	{
+		const InputEvent& event = queue[t & (QUEUE_SIZE - 1)];
+		switch (event.type)
+		{
+		case InputEvent::Key:
+		case InputEvent::MouseButton:
+			// repeats and releases trigger nothing
+			if (event.action == GLFW_PRESS)
+			{
+				const InputAction action = Lookup(event.code, event.mods, event.type == InputEvent::MouseButton);
+				if (action != InputAction::None)
+					frame.actions.push_back(action);
+			}
+			break;
+		case InputEvent::Resize:
+			frame.resized = true;
+			frame.width = (int)event.x;
+			frame.height = (int)event.y;
+			frame.damaged = true;
+			break;
+		case InputEvent::Refresh:
+			frame.damaged = true;
+			break;
+		}
+	}
+	tail.store(t, std::memory_order_release);
+
+	frame.cursor = cursor;
+	frame.cursorDelta = cursorDelta;
+	frame.scroll = scroll;
+	cursorDelta = glm::dvec2(0.0);
+	scroll = glm::dvec2(0.0);
+	events += motionEvents;
+	motionEvents = 0;
+}
+
+void InputSystem::KeyCallback(GLFWwindow* window, int key, int /*scancode*/, int action, int mods)
+{
+	InputSystem* input = (InputSystem*)glfwGetWindowUserPointer(window);
+	const InputEvent event = { InputEvent::Key, key, action, mods & MOD_MASK, 0.0, 0.0 };
+	input->Push(event);
+}
+
+void InputSystem::MouseButtonCallback(GLFWwindow* window, int button, int action, int mods)
+{
+	InputSystem* input = (InputSystem*)glfwGetWindowUserPointer(window);
+	const InputEvent event = { InputEvent::MouseButton, button, action, mods & MOD_MASK, 0.0, 0.0 };
+	input->Push(event);
+}
+
+void InputSystem::CursorCallback(GLFWwindow* window, double x, double y)
+{
+	InputSystem* input = (InputSystem*)glfwGetWindowUserPointer(window);
+	input->Move(x, y);
+}
+
+void InputSystem::ScrollCallback(GLFWwindow* window, double x, double y)
+{
+	InputSystem* input = (InputSystem*)glfwGetWindowUserPointer(window);
+	input->Scroll(x, y);
+}
+
+void InputSystem::FramebufferSizeCallback(GLFWwindow* window, int width, int height)
+{
+	InputSystem* input = (InputSystem*)glfwGetWindowUserPointer(window);
+	const InputEvent event = { InputEvent::Resize, 0, 0, 0, (double)width, (double)height };
+	input->Push(event);
+}
+
+void InputSystem::RefreshCallback(GLFWwindow* window)
+{
+	InputSystem* input = (InputSystem*)glfwGetWindowUserPointer(window);
+	const InputEvent event = { InputEvent::Refresh, 0, 0, 0, 0.0, 0.0 };
+	input->Push(event);
+}
@@ -0,0 +1,198 @@
+#include "InstancedRenderer.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "PointTransform.h"
+
+// per-instance attributes: MVP in locations 2..5 (one per column), color in 6
+static const char* INSTANCE_VS =
+	"#version 330 core\n"
+	"layout(location = 0) in vec3 position;\n"
+	"layout(location = 1) in vec3 normal;\n"
+	"layout(location = 2) in mat4 mvp;\n"
+	"layout(location = 6) in vec4 color;\n"
+	"out vec4 vertexColor;\n"
+	"void main()\n"
+	"{\n"
+	"	// fixed light in object space, enough to tell the faces apart\n"
+	"	float light = 0.55 + 0.45 * abs(dot(normal, normalize(vec3(0.3, 0.5, 0.8))));\n"
+	"	vertexColor = vec4(color.rgb * light, color.a);\n"
+	"	gl_Position = mvp * vec4(position, 1.0);\n"
+	"}\n";
+
+static const char* INSTANCE_FS =
+	"#version 330 core\n"
+	"in vec4 vertexColor;\n"
+	"out vec4 fragColor;\n"
+	"void main()\n"
+	"{\n"
+	"	fragColor = vertexColor;\n"
+	"}\n";
+
+InstancedRenderer::InstancedRenderer()
+	: vao(0), vertexBuffer(0), indexBuffer(0), mvpBuffer(0), colorBuffer(0), indexCount(0),
+	viewProjection(1.0f), drawCalls(0), instances(0), culled(0)
+{
+}
+
+InstancedRenderer::~InstancedRenderer()
+{
+	// GL objects are released by Release() while the context is still current
+}
+
+bool InstancedRenderer::Init(InstanceMesh mesh, ShaderManager& shaders)
+{
+	Release();
+	if (!shaders.Build(shader, INSTANCE_VS, INSTANCE_FS))
+		return false;
+
+	glGenVertexArrays(1, &vao);
+	glBindVertexArray(vao);
+	CreateMesh(mesh);
+
+	// per-instance attributes: an MVP in 2..5 and a color in 6, each in a buffer
+	// of its own so the pointers stay valid whatever the instance count
+	glGenBuffers(1, &mvpBuffer);
+	glBindBuffer(GL_ARRAY_BUFFER, mvpBuffer);
+	for (int c = 0; c < 4; c++)
+	{
+		glVertexAttribPointer(2 + c, 4, GL_FLOAT, GL_FALSE, sizeof(glm::mat4), (void*)(c * sizeof(glm::vec4)));
+		glEnableVertexAttribArray(2 + c);
+		glVertexAttribDivisor(2 + c, 1);
+	}
+	glGenBuffers(1, &colorBuffer);
+	glBindBuffer(GL_ARRAY_BUFFER, colorBuffer);
+	glVertexAttribPointer(6, 4, GL_FLOAT, GL_FALSE, sizeof(glm::vec4), (void*)0);
+	glEnableVertexAttribArray(6);
+	glVertexAttribDivisor(6, 1);
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+	glBindVertexArray(0);
+	return true;
+}
+
+void InstancedRenderer::Release()
+{
+	shader.Release();
+	if (vao != 0)
+		glDeleteVertexArrays(1, &vao);
+	if (vertexBuffer != 0)
+		glDeleteBuffers(1, &vertexBuffer);
+	if (indexBuffer != 0)
+		glDeleteBuffers(1, &indexBuffer);
+	if (mvpBuffer != 0)
+		glDeleteBuffers(1, &mvpBuffer);
+	if (colorBuffer != 0)
+		glDeleteBuffers(1, &colorBuffer);
+	vao = vertexBuffer = indexBuffer = mvpBuffer = colorBuffer = 0;
+}
+
+void InstancedRenderer::CreateMesh(InstanceMesh mesh)
+{
+	// position, normal
+	std::vector<float> vertices;
+	std::vector<GLushort> indices;
+
+	// one quad per face so every face gets its own normal
+	const int faces = (mesh == InstanceMesh::Cube) ? 6 : 1;
+	for (int f = 0; f < faces; f++)
+	{
+		const int axis = f / 2;
+		const float side = (f % 2 == 0) ? 1.0f : -1.0f;
+		glm::vec3 n(0.0f), u(0.0f), v(0.0f);
+		// cube faces are ordered +z, -z, +x, -x, +y, -y; the quad is the +z face at z = 0
+		const int a = (axis + 2) % 3;
+		n[a] = side;
+		u[(a + 1) % 3] = 1.0f;
+		v[(a + 2) % 3] = side;
+		const glm::vec3 center = (mesh == InstanceMesh::Cube)
+			? glm::vec3(0.0f, 0.0f, 0.5f) + 0.5f * n
+			: glm::vec3(0.0f);
+
+		const GLushort base = (GLushort)(vertices.size() / 6);
+		const float corners[4][2] = { { -0.5f, -0.5f }, { 0.5f, -0.5f }, { 0.5f, 0.5f }, { -0.5f, 0.5f } };
+		for (int c = 0; c < 4; c++)
+		{
+			const glm::vec3 p = center + corners[c][0] * u + corners[c][1] * v;
+			vertices.insert(vertices.end(), { p.x, p.y, p.z, n.x, n.y, n.z });
+		}
+		indices.insert(indices.end(), { base, (GLushort)(base + 1), (GLushort)(base + 2), base, (GLushort)(base + 2), (GLushort)(base + 3) });
+	}
+	indexCount = (GLsizei)indices.size();
+	meshBounds = (mesh == InstanceMesh::Cube)
+		? BoundingBox(glm::vec3(-0.5f, -0.5f, 0.0f), glm::vec3(0.5f, 0.5f, 1.0f))
+		: BoundingBox(glm::vec3(-0.5f, -0.5f, 0.0f), glm::vec3(0.5f, 0.5f, 0.0f));
+
+	glGenBuffers(1, &vertexBuffer);
+	glBindBuffer(GL_ARRAY_BUFFER, vertexBuffer);
+	glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(float), vertices.data(), GL_STATIC_DRAW);
+	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void*)0);
+	glEnableVertexAttribArray(0);
+	glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void*)(3 * sizeof(float)));
+	glEnableVertexAttribArray(1);
+
+	glGenBuffers(1, &indexBuffer);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBuffer);
+	glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(GLushort), indices.data(), GL_STATIC_DRAW);
+}
+
+void InstancedRenderer::Begin(const glm::mat4& viewProjection)
+{
+	this->viewProjection = viewProjection;
+	models.clear();
+	colors.clear();
+}
+
+void InstancedRenderer::Add(const glm::mat4& model, const glm::vec4& color)
+{
+	models.push_back(model);
+	colors.push_back(color);
+}
+
+// gather the models and colors of instances inside the frustum into 'visibleModels' and
+// 'visibleColors'. returns how many there are.
+size_t InstancedRenderer::CullInstances()
+{
+	const size_t count = models.size();
+	worldBounds.resize(count);
+	for (size_t i = 0; i < count; i++)
+		worldBounds[i] = TransformBounds(models[i], meshBounds);
+	hierarchy.Build(worldBounds);
+
+	visible.clear();
+	hierarchy.Query(Frustum(viewProjection), visible);
+
+	visibleModels.resize(visible.size());
+	visibleColors.resize(visible.size());
+	for (size_t i = 0; i < visible.size(); i++)
+	{
+		visibleModels[i] = models[visible[i]];
+		visibleColors[i] = colors[visible[i]];
+	}
+	culled += count - visible.size();
+	return visible.size();
+}
+
+void InstancedRenderer::Record(CommandBuffer& commands)
+{
+	if (models.empty() || !shader.IsValid() || vao == 0)
+		return;
+
+	const size_t count = CullInstances();
+	if (count == 0)
+		return;
+
+	// BufferData orphans last frame's storage, so the upload never waits for
+	// draws still reading it
+	void* mvpData = commands.BufferData(GL_ARRAY_BUFFER, mvpBuffer, count * sizeof(glm::mat4), GL_STREAM_DRAW);
+	MultiplyMatrices(viewProjection, visibleModels.data(), (glm::mat4*)mvpData, count);
+	void* colorData = commands.BufferData(GL_ARRAY_BUFFER, colorBuffer, count * sizeof(glm::vec4), GL_STREAM_DRAW);
+	memcpy(colorData, visibleColors.data(), count * sizeof(glm::vec4));
+
+	commands.UseProgram(shader.ID);
+	commands.BindVertexArray(vao);
+	commands.DrawElementsInstanced(GL_TRIANGLES, indexCount, GL_UNSIGNED_SHORT, 0, (GLsizei)count);
+
+	drawCalls++;
+	instances += count;
+}
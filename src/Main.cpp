@@ -3,18 +3,98 @@
 #include <opencv2/core.hpp>
 #include <opencv2/opencv.hpp>
 
-// all callback functions must be declared in 'C' style.
-// therefore, we cannot use class methods as callback.
-// whenever the window size changed, this callback function executes
-void framebuffer_size_callback(GLFWwindow* window, int width, int height)
+#include <chrono>
+#include <memory>
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include "FrameRing.h"
+#include "CaptureThread.h"
+#include "FrameUploader.h"
+#include "FramePacer.h"
+#include "Shader.h"
+#include "HeadlessContext.h"
+#include "RenderTarget.h"
+#include "FrameSink.h"
+#include "FrameArena.h"
+#include "MarkerTracker.h"
+#include "Undistorter.h"
+#include "Calibrator.h"
+#include "FeatureTracker.h"
+#include "VideoRecorder.h"
+#include "AsyncReadback.h"
+#include "ShaderManager.h"
+#include "InstancedRenderer.h"
+#include "RenderQueue.h"
+#include "Trace.h"
+#include "InputSystem.h"
+#include "AppConfig.h"
+
+// fullscreen triangle generated from gl_VertexID, no vertex buffer needed
+static const char* BACKGROUND_VS =
+	"#version 330 core\n"
+	"out vec2 uv;\n"
+	"void main()\n"
+	"{\n"
+	"	vec2 p = vec2((gl_VertexID << 1) & 2, gl_VertexID & 2);\n"
+	"	uv = vec2(p.x, 1.0 - p.y);\n" // camera rows are stored top-down
+	"	gl_Position = vec4(p * 2.0 - 1.0, 0.0, 1.0);\n"
+	"}\n";
+
+static const char* BACKGROUND_FS =
+	"#version 330 core\n"
+	"in vec2 uv;\n"
+	"out vec4 fragColor;\n"
+	"uniform sampler2D cameraTexture;\n"
+	"void main()\n"
+	"{\n"
+	"	fragColor = vec4(texture(cameraTexture, uv).rgb, 1.0);\n"
+	"}\n";
+
+// same, but the camera texture is sampled where the undistortion lookup says
+static const char* BACKGROUND_UNDISTORT_FS =
+	"#version 330 core\n"
+	"in vec2 uv;\n"
+	"out vec4 fragColor;\n"
+	"uniform sampler2D cameraTexture;\n"
+	"uniform sampler2D undistortMap;\n"
+	"uniform vec2 lookupRange;\n" // offset, scale
+	"void main()\n"
+	"{\n"
+	"	vec2 src = texture(undistortMap, uv).rg * lookupRange.y + lookupRange.x;\n"
+	"	if (any(lessThan(src, vec2(0.0))) || any(greaterThan(src, vec2(1.0))))\n"
+	"		fragColor = vec4(0.0, 0.0, 0.0, 1.0);\n"
+	"	else\n"
+	"		fragColor = vec4(texture(cameraTexture, src).rgb, 1.0);\n"
+	"}\n";
+
+// GL projection for a pinhole camera, applied to OpenCV camera coordinates
+// (x right, y down, z forward) so marker poses need no axis conversion.
+// 'nearPlane' and 'farPlane' are distances along +z.
+static glm::mat4 ProjectionFromIntrinsics(const CameraCalibration& calibration, float nearPlane, float farPlane)
 {
-	glViewport(0, 0, width, height);
+	const cv::Mat_<double> k = calibration.cameraMatrix;
+	const float w = (float)calibration.imageSize.width;
+	const float h = (float)calibration.imageSize.height;
+
+	// glm is column-major: p[column][row]
+	glm::mat4 p(0.0f);
+	p[0][0] = 2.0f * (float)k(0, 0) / w;
+	p[2][0] = 2.0f * (float)k(0, 2) / w - 1.0f;
+	// image rows grow downwards, NDC y upwards
+	p[1][1] = -2.0f * (float)k(1, 1) / h;
+	p[2][1] = 1.0f - 2.0f * (float)k(1, 2) / h;
+	p[2][2] = (farPlane + nearPlane) / (farPlane - nearPlane);
+	p[3][2] = -2.0f * farPlane * nearPlane / (farPlane - nearPlane);
+	p[2][3] = 1.0f;
+	return p;
 }
 
 class MainApplication
 {
 public:
-	MainApplication() 
+	MainApplication(const AppConfig& config)
+		: config(config), window(NULL), glReady(false), sourceFps(0.0), backgroundVAO(0), showOverlays(true)
 	{
 		
 	}
@@ -27,8 +107,28 @@ public:
 	// Main function for application
 	void Start()
 	{
-		InitGL();
-		CVTest();
+		if (config.headless)
+		{
+			if (!InitHeadless())
+				return;
+			InitBackground();
+			if (OpenSource())
+			{
+				InitProcessing();
+				HeadlessLoop();
+			}
+			return;
+		}
+
+		if (!InitGL())
+			return;
+		InitBackground();
+		if (OpenSource())
+		{
+			InitProcessing();
+			InitCapture();
+		}
+		InitRecording();
 		RenderLoop();
 	}
 
@@ -37,6 +137,8 @@ private:
 	// returns false if it fail to initialize.
 	bool InitGL()
 	{
+		TRACE_ZONE("InitGL");
+
 		// initialize glfw
 		// OpenGL version : 3.3
 		glfwInit();
@@ -54,27 +156,317 @@ private:
 		}
 		glfwMakeContextCurrent(window);
 		
-		// add callback function
-		glfwSetFramebufferSizeCallback(window, framebuffer_size_callback);
+		// input arrives through callbacks and is handled once per frame in processInput
+		input.Attach(window);
+		input.BindDefaults();
+		for (size_t i = 0; i < config.bindings.size(); i++)
+			input.Bind(config.bindings[i]);
+		input.SetWakeCallback([this]() { framePacer.MarkDirty(); });
 
-		// glad: load all OpenGL function pointers
-		if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+		// glad: load all OpenGL function pointers, or only trampolines resolving on first call
+		const int loaded = config.lazyGL
+			? gladLoadGLLoaderLazy((GLADloadproc)glfwGetProcAddress)
+			: gladLoadGLLoader((GLADloadproc)glfwGetProcAddress);
+		if (!loaded)
 		{
 			cout << "Failed to initialize GLAD" << endl;
 			return false;
 		}
 
+		glReady = true;
+
 		// configure global opengl state
 		glEnable(GL_DEPTH_TEST);
 
+		framePacer.Init(window, config.pacing, config.targetFps);
+
 		return true;
 	}
 
+	// initialize OpenGL without a visible window and an offscreen target of the window's size.
+	// returns false if it fail to initialize.
+	bool InitHeadless()
+	{
+		TRACE_ZONE("InitHeadless");
+		if (!headlessContext.Create(config.lazyGL))
+			return false;
+		glReady = true;
+
+		if (!renderTarget.Create(SCR_WIDTH, SCR_HEIGHT))
+			return false;
+
+		// configure global opengl state
+		glEnable(GL_DEPTH_TEST);
+
+		return frameSink.Open(config.outputPath, config.targetFps, cv::Size(SCR_WIDTH, SCR_HEIGHT));
+	}
+
+
+	// prepare the camera texture upload stage and the shader drawing it behind the scene
+	bool InitBackground()
+	{
+		TRACE_ZONE("InitBackground");
+
+		// headless output must be complete from the first frame, so only windowed
+		// mode compiles in the background and draws without the shaders meanwhile
+		shaderManager.Init(config.headless ? NULL : window, config.cacheDirectory);
+
+		frameUploader.Init();
+		glGenVertexArrays(1, &backgroundVAO);
+		if (config.undistort == UndistortMode::GPU && !shaderManager.Build(undistortShader, BACKGROUND_VS, BACKGROUND_UNDISTORT_FS))
+			return false;
+
+		// 3D overlays: a cube on every marker, a small square on every feature track
+		if (config.markers != MarkerMode::Off && !markerRenderer.Init(InstanceMesh::Cube, shaderManager))
+			return false;
+		if (config.trackFeatures && !featureRenderer.Init(InstanceMesh::Quad, shaderManager))
+			return false;
+		if (config.markers != MarkerMode::Off || config.trackFeatures)
+			renderQueue.Start(RENDER_WORKERS);
+		return shaderManager.Build(backgroundShader, BACKGROUND_VS, BACKGROUND_FS);
+	}
+
+	// draw the latest uploaded camera frame over the whole viewport
+	void DrawBackground()
+	{
+		TRACE_ZONE("DrawBackground");
+		if (frameUploader.Texture() == 0 || !backgroundShader.IsValid())
+			return;
+
+		const GLuint lookup = (config.undistort == UndistortMode::GPU && undistortShader.IsValid())
+			? undistorter.LookupTexture() : 0;
+		const Shader& shader = lookup != 0 ? undistortShader : backgroundShader;
+
+		glDisable(GL_DEPTH_TEST);
+		shader.Use();
+		shader.SetInt("cameraTexture", 0);
+		glActiveTexture(GL_TEXTURE0);
+		glBindTexture(GL_TEXTURE_2D, frameUploader.Texture());
+		if (lookup != 0)
+		{
+			shader.SetInt("undistortMap", 1);
+			shader.SetVec2("lookupRange", glm::vec2(Undistorter::LOOKUP_OFFSET, Undistorter::LOOKUP_SCALE));
+			glActiveTexture(GL_TEXTURE1);
+			glBindTexture(GL_TEXTURE_2D, lookup);
+			glActiveTexture(GL_TEXTURE0);
+		}
+		glBindVertexArray(backgroundVAO);
+		glDrawArrays(GL_TRIANGLES, 0, 3);
+		glBindVertexArray(0);
+		glEnable(GL_DEPTH_TEST);
+	}
+
+	// queue the tracking results drawn over the camera frame, one instanced draw call per mesh.
+	// the jobs only read tracker output, which stays untouched until the queue is submitted
+	void RecordOverlays()
+	{
+		TRACE_ZONE("RecordOverlays");
+		if (!markerTracker.Markers().empty() && calibration.IsValid())
+		{
+			renderQueue.Record([this](CommandBuffer& commands)
+			{
+				TRACE_ZONE("RecordMarkers");
+				const vector<TrackedMarker>& markers = markerTracker.Markers();
+				const float length = config.markerLength;
+				markerRenderer.Begin(ProjectionFromIntrinsics(calibration, 0.1f * length, 1000.0f * length));
+				for (size_t i = 0; i < markers.size(); i++)
+				{
+					const TrackedMarker& marker = markers[i];
+					cv::Matx33d r;
+					cv::Rodrigues(marker.rvec, r);
+
+					glm::mat4 pose(1.0f);
+					for (int row = 0; row < 3; row++)
+					{
+						for (int col = 0; col < 3; col++)
+							pose[col][row] = (float)r(row, col);
+						pose[3][row] = (float)marker.tvec[row];
+					}
+					// the marker's z axis points out of the printed side, towards the camera
+					const glm::mat4 model = glm::scale(pose, glm::vec3(length, length, 0.5f * length));
+					markerRenderer.Add(model, marker.detected ? glm::vec4(0.2f, 0.8f, 0.3f, 1.0f) : glm::vec4(0.9f, 0.6f, 0.1f, 1.0f));
+				}
+				markerRenderer.Record(commands);
+			});
+		}
+
+		if (featureTracker.Count() > 0 && frameUploader.Texture() != 0)
+		{
+			const cv::Size frameSize = SourceFrameSize();
+			renderQueue.Record([this, frameSize](CommandBuffer& commands)
+			{
+				TRACE_ZONE("RecordFeatures");
+				// features live in image pixels, drawn flat on top of everything
+				const size_t tracks = featureTracker.Count();
+				const float* x = featureTracker.Positions().x();
+				const float* y = featureTracker.Positions().y();
+				const soa_scalar<int>& ages = featureTracker.Ages();
+				featureRenderer.Begin(glm::ortho(0.0f, (float)frameSize.width, (float)frameSize.height, 0.0f, -1.0f, 1.0f));
+				for (size_t i = 0; i < tracks; i++)
+				{
+					const glm::mat4 model = glm::scale(glm::translate(glm::mat4(1.0f), glm::vec3(x[i], y[i], 0.0f)),
+						glm::vec3((float)FEATURE_SIZE, (float)FEATURE_SIZE, 1.0f));
+					// young tracks are red, tracks older than a second turn yellow
+					const float age = std::min(ages[i], 30) / 30.0f;
+					featureRenderer.Add(model, glm::vec4(1.0f, age, 0.1f, 1.0f));
+				}
+				commands.Disable(GL_DEPTH_TEST);
+				featureRenderer.Record(commands);
+				commands.Enable(GL_DEPTH_TEST);
+			});
+		}
+	}
+
+	// open the input file (a .rawf recording or any video) if one was given, the default camera otherwise.
+	// returns false if neither is available; windowed rendering goes on without frames.
+	bool OpenSource()
+	{
+		TRACE_ZONE("OpenSource");
+		source = FrameSource::Open(config.inputPath, cv::Size(SCR_WIDTH, SCR_HEIGHT), 60.0);
+		return source != NULL;
+	}
+
+	// the camera may not honor the requested size, so go by what the source reports.
+	// once capture runs the source belongs to the capture thread and the ring's size is used
+	cv::Size SourceFrameSize() const
+	{
+		if (frameRing)
+			return frameRing->FrameSize();
+		const cv::Size frameSize = source ? source->FrameSize() : cv::Size();
+		return frameSize.area() > 0 ? frameSize : cv::Size(SCR_WIDTH, SCR_HEIGHT);
+	}
+
+	// start the capture thread on the opened source
+	bool InitCapture()
+	{
+		TRACE_ZONE("InitCapture");
+		frameRing.reset(new FrameRing(FRAME_RING_SIZE, SourceFrameSize(), CV_8UC3));
+		sourceFps = source->Fps();
+		capture.reset(new CaptureThread(*source, *frameRing));
+
+		// a new camera frame is what makes the on-demand pacer redraw
+		capture->SetFrameCallback([this]() { framePacer.MarkDirty(); });
+		return capture->Start();
+	}
+
+	// load the camera intrinsics for the opened source and set up the CV stages using them
+	void InitProcessing()
+	{
+		TRACE_ZONE("InitProcessing");
+		if (config.markers == MarkerMode::Off && config.undistort == UndistortMode::Off)
+			return;
+
+		const cv::Size frameSize = SourceFrameSize();
+		CameraCalibration loaded;
+		if (!config.calibrationPath.empty() && loaded.Load(config.calibrationPath))
+			calibration = loaded.ScaledTo(frameSize);
+		else
+		{
+			cout << "No camera calibration, using guessed intrinsics" << endl;
+			calibration = CameraCalibration::Guess(frameSize);
+		}
+
+		InitUndistort();
+		InitMarkers();
+	}
+
+	// build or load the undistortion maps for the calibration
+	void InitUndistort()
+	{
+		if (config.undistort == UndistortMode::Off)
+			return;
+
+		const int64 start = cv::getTickCount();
+		if (!undistorter.Init(calibration, config.cacheDirectory))
+		{
+			cout << "Failed to prepare undistortion maps" << endl;
+			return;
+		}
+		cout << "Undistortion maps " << (undistorter.FromCache() ? "loaded" : "built") << " in "
+			<< (cv::getTickCount() - start) * 1000.0 / cv::getTickFrequency() << " ms" << endl;
+	}
+
+	// set up the marker stage, if one was asked for
+	void InitMarkers()
+	{
+		if (config.markers == MarkerMode::Off)
+			return;
+
+		// frames reaching the tracker are already corrected when undistorting on the CPU
+		CameraCalibration markerCalibration = calibration;
+		if (config.undistort == UndistortMode::CPU && undistorter.IsReady())
+			markerCalibration.distCoeffs = cv::Mat::zeros(1, 5, CV_64F);
+		markerTracker.Init(markerCalibration, config.markerLength, config.markers == MarkerMode::Tracking);
+	}
+
+	// open the recorders asked for; each runs its own encoder thread
+	void InitRecording()
+	{
+		TRACE_ZONE("InitRecording");
+		if (!config.recordCameraPath.empty() && frameRing)
+		{
+			const double fps = sourceFps > 0.0 ? sourceFps : 30.0;
+			const cv::Size frameSize = SourceFrameSize();
+			cameraRecorder.Open(config.recordCameraPath, fps, frameSize, config.recordPolicy);
+		}
+
+		if (!config.recordOutputPath.empty())
+		{
+			// the window is recorded at its framebuffer size when recording starts
+			int width, height;
+			glfwGetFramebufferSize(window, &width, &height);
+			if (outputRecorder.Open(config.recordOutputPath, config.targetFps, cv::Size(width, height), config.recordPolicy, true))
+				readback.Init(cv::Size(width, height));
+		}
+	}
+
+	// start reading the finished back buffer, and hand frames read in earlier
+	// frames to the recorder. never waits for the GPU.
+	void RecordOutput()
+	{
+		TRACE_ZONE("RecordOutput");
+		CollectOutput(false);
+
+		int width, height;
+		glfwGetFramebufferSize(window, &width, &height);
+		if (cv::Size(width, height) != readback.Size())
+		{
+			outputRecorder.DropWrite();
+			return;
+		}
+		readback.Issue(0, GL_BACK);
+	}
+
+	// pass finished readbacks to the recorder; with 'wait' set, all frames in flight
+	void CollectOutput(bool wait)
+	{
+		cv::Mat frame;
+		while (readback.Acquire(frame, wait))
+		{
+			// the only CPU copy, rows stay bottom-up until the encoder thread
+			cv::Mat* slot = outputRecorder.BeginWrite();
+			if (slot != NULL)
+			{
+				frame.copyTo(*slot);
+				outputRecorder.CommitWrite();
+			}
+			readback.ReleaseAcquired();
+		}
+	}
 
-	void CVTest()
+	// headless: write frames read back earlier to the sink, in order.
+	// with 'all' set, waits until every issued frame is written.
+	void WriteReadback(bool all)
 	{
-		cv::Mat testImg = cv::Mat::zeros(cv::Size(300, 400), CV_8U);
-		cv::imshow("test", testImg);
+		TRACE_ZONE("WriteReadback");
+		cv::Mat frame, result;
+		while (readback.Acquire(frame, all || readback.IsFull()))
+		{
+			// GL rows are bottom-up
+			cv::flip(frame, result, 0);
+			readback.ReleaseAcquired();
+			frameSink.Write(result);
+		}
 	}
 
 	// GLFW rendering loop function
@@ -82,42 +474,409 @@ private:
 	{
 		while (!glfwWindowShouldClose(window))
 		{
+			// poll IO events (keys pressed/released, mouse moved etc.), sleeping as the pacing mode asks
+			{
+				TRACE_ZONE("WaitForFrame");
+				if (!framePacer.WaitForFrame())
+				{
+					// idle wake-up: nothing to draw, but the input queue must not fill up
+					processInput();
+					continue;
+				}
+			}
+			TRACE_ZONE("Frame");
+			framePacer.BeginFrame();
+
 			// process input
-			processInput(window);
+			processInput();
+
+			// programs compiled in the background become usable
+			{
+				TRACE_ZONE("UpdateShaders");
+				shaderManager.Update();
+			}
+
+			// take the newest camera frame, never waiting for the camera
+			if (frameRing && frameRing->AcquireLatest(cameraFrame))
+			{
+				if (cameraRecorder.IsOpen())
+					cameraRecorder.Write(cameraFrame);
+				const cv::Mat& shown = ProcessFrame(cameraFrame);
+				TRACE_ZONE("Upload");
+				frameUploader.Upload(shown);
+			}
+
+			// render
+			RenderScene();
+			if (outputRecorder.IsOpen())
+				RecordOutput();
+
+			// swap buffers
+			TRACE_ZONE("Present");
+			framePacer.EndFrame();
+		}
+		if (outputRecorder.IsOpen())
+			CollectOutput(true);
+
+		const FrameStats& stats = framePacer.Stats();
+		cout << "Frames: " << stats.frames << " drawn, " << stats.skipped << " idle wake-ups" << endl;
+		cout << "  cpu     avg " << stats.cpu.average << " ms, worst " << stats.cpu.worst << " ms" << endl;
+		cout << "  gpu     avg " << stats.gpu.average << " ms, worst " << stats.gpu.worst << " ms" << endl;
+		cout << "  present avg " << stats.present.average << " ms, worst " << stats.present.worst << " ms" << endl;
+	}
+
+	// headless processing loop: every input frame is rendered into the offscreen target
+	// and handed to the frame sink, as fast as frames can be decoded
+	void HeadlessLoop()
+	{
+		const chrono::steady_clock::time_point start = chrono::steady_clock::now();
+		int processed = 0;
+
+		// rendered frames reach the sink a few frames late, but none is skipped
+		readback.Init(cv::Size(renderTarget.Width(), renderTarget.Height()));
+		renderTarget.Bind();
+		while (config.maxFrames == 0 || processed < config.maxFrames)
+		{
+			TRACE_ZONE("Frame");
+
+			// no capture thread here: every frame of a recording must be processed, none dropped
+			{
+				TRACE_ZONE("Read");
+				if (!source->Read(cameraFrame))
+					break;
+			}
+			const cv::Mat& shown = ProcessFrame(cameraFrame);
+			{
+				TRACE_ZONE("Upload");
+				frameUploader.Upload(shown);
+			}
+
+			RenderScene();
+
+			WriteReadback(false);
+			readback.Issue(renderTarget.Framebuffer(), GL_COLOR_ATTACHMENT0);
+			processed++;
+		}
+		WriteReadback(true);
+		RenderTarget::BindDefault();
+
+		const double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+		cout << "Headless: " << processed << " frames in " << seconds << " s ("
+			<< (seconds > 0.0 ? processed / seconds : 0.0) << " fps)" << endl;
+	}
+
+	// CV stages for a new camera frame. their results come from the frame arena
+	// and stay valid until the next call. returns the frame to show.
+	const cv::Mat& ProcessFrame(const cv::Mat& frame)
+	{
+		TRACE_ZONE("ProcessFrame");
+
+		// last frame's temporaries must be gone before the arena rewinds
+		grayFrame.release();
+		undistortedFrame.release();
+		frameArena.Reset();
+
+		const cv::Mat* shown = &frame;
+		if (config.undistort == UndistortMode::CPU && undistorter.IsReady() && frame.size() == undistorter.Size())
+		{
+			TRACE_ZONE("Undistort");
+			undistortedFrame = frameArena.NewMat();
+			undistorter.Apply(frame, undistortedFrame);
+			shown = &undistortedFrame;
+		}
+
+		{
+			TRACE_ZONE("Grayscale");
+			grayFrame = frameArena.NewMat();
+			cv::cvtColor(*shown, grayFrame, cv::COLOR_BGR2GRAY);
+		}
+
+		if (markerTracker.IsInitialized())
+		{
+			TRACE_ZONE("Markers");
+			markerTracker.Process(grayFrame);
+		}
+		if (config.trackFeatures)
+		{
+			TRACE_ZONE("Features");
+			featureTracker.Process(grayFrame);
+		}
+		return *shown;
+	}
+
+	// draw one frame into the currently bound framebuffer
+	void RenderScene()
+	{
+		TRACE_ZONE("RenderScene");
+		// overlays are recorded by the render workers while the background is drawn here
+		if (showOverlays)
+			RecordOverlays();
+		glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+		glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT); // also clear the depth buffer now!
+		DrawBackground();
+		renderQueue.Submit();
+	}
+
+	// process all input queued since the last frame and run the actions it triggered
+	void processInput()
+	{
+		TRACE_ZONE("processInput");
+		input.Drain(inputFrame);
+		if (inputFrame.resized)
+			glViewport(0, 0, inputFrame.width, inputFrame.height);
 
-			// render (only clearcolor for now...)
-			glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
-			glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT); // also clear the depth buffer now!
+		for (size_t i = 0; i < inputFrame.actions.size(); i++)
+		{
+			switch (inputFrame.actions[i])
+			{
+			case InputAction::Quit:
+				glfwSetWindowShouldClose(window, true);
+				break;
+			case InputAction::WriteTrace:
+				if (Trace::IsEnabled())
+					WriteTrace();
+				break;
+			case InputAction::CyclePacing:
+			{
+				static const char* const NAMES[] = { "vsync", "adaptive", "fixed", "ondemand" };
+				const int next = ((int)framePacer.Mode() + 1) % 4;
+				framePacer.SetMode((PacingMode)next);
+				cout << "Pacing: " << NAMES[next] << endl;
+				break;
+			}
+			case InputAction::ToggleOverlays:
+				showOverlays = !showOverlays;
+				break;
+			case InputAction::None:
+				break;
+			}
+		}
+	}
 
-			// swap buffers and poll IO events (keys pressed/released, mouse moved etc.)
-			glfwSwapBuffers(window);
-			glfwPollEvents();
+	void WriteTrace()
+	{
+		if (Trace::Write(config.tracePath))
+		{
+			cout << "Trace: " << Trace::EventCount() << " events written to " << config.tracePath;
+			if (Trace::DroppedCount() > 0)
+				cout << ", " << Trace::DroppedCount() << " dropped";
+			cout << endl;
 		}
 	}
 
-	// process all input: query GLFW whether relevant keys are pressed/released this frame and react accordingly
-	void processInput(GLFWwindow *window)
+	// flush a recorder and print its counters
+	static void PrintRecorder(const char* name, VideoRecorder& recorder)
 	{
-		if (glfwGetKey(window, GLFW_KEY_ESCAPE) == GLFW_PRESS)
-			glfwSetWindowShouldClose(window, true);
+		if (!recorder.IsOpen())
+			return;
+		recorder.Close();
+		cout << "Recording " << name << ": " << recorder.Written() << " frames written, " << recorder.Dropped()
+			<< " dropped, queue depth peaked at " << recorder.MaxQueueDepth() << endl;
 	}
 
 	// terminate application
 	void Terminate()
 	{
+		if (capture)
+		{
+			capture->Stop();
+			cout << "Capture: " << frameRing->Produced() << " frames, "
+				<< frameRing->Dropped() << " dropped, " << frameRing->Stale() << " stale polls" << endl;
+			capture.reset();
+		}
+
+		frameSink.Close();
+		PrintRecorder("camera", cameraRecorder);
+		PrintRecorder("output", outputRecorder);
+		if (readback.Issued() > 0)
+		{
+			cout << "Readback: " << readback.Acquired() << " of " << readback.Issued() << " frames, "
+				<< readback.Discarded() << " discarded, " << readback.Stalls() << " stalls, latency avg "
+				<< readback.AverageLatency() << " ms, worst " << readback.WorstLatency() << " ms" << endl;
+		}
+
+		grayFrame.release();
+		undistortedFrame.release();
+		cout << "Frame arena: peak " << frameArena.PeakFrameBytes() / 1024 << " KB per frame, "
+			<< frameArena.TotalHeapAllocations() << " heap allocations in total, "
+			<< frameArena.LastFrameHeapAllocations() << " in the last frame, "
+			<< frameArena.DeferredResets() << " resets deferred by live Mats" << endl;
+
+		if (markerTracker.Frames() > 0)
+		{
+			cout << "Markers: " << markerTracker.Frames() << " frames, " << markerTracker.FullScans() << " full scans ("
+				<< markerTracker.TilesPerScan() << " tiles), "
+				<< markerTracker.AverageDetectMs() << " ms avg, "
+				<< markerTracker.AverageScannedFraction() * 100.0 << "% of each frame scanned" << endl;
+		}
+		if (featureTracker.Frames() > 0)
+		{
+			cout << "Features: " << featureTracker.Frames() << " frames, " << featureTracker.Detections() << " detections, "
+				<< featureTracker.Count() << " tracks at exit, " << featureTracker.AverageMs() << " ms avg" << endl;
+		}
+
+		// GL objects must go before the context does
+		if (glReady)
+		{
+			shaderManager.Release();
+			if (shaderManager.CacheHits() + shaderManager.CacheMisses() > 0)
+			{
+				cout << "Shaders: " << shaderManager.CacheHits() << " from cache in " << shaderManager.LoadMs() << " ms, "
+					<< shaderManager.CacheMisses() << " compiled, " << shaderManager.BackgroundBuilds() << " in the background" << endl;
+			}
+			frameUploader.Release();
+			framePacer.Release();
+			renderTarget.Release();
+			readback.Release();
+			backgroundShader.Release();
+			undistortShader.Release();
+			undistorter.Release();
+			renderQueue.Stop();
+			if (renderQueue.Replayed() > 0)
+			{
+				cout << "Commands: " << renderQueue.Replayed() << " replayed, " << renderQueue.Filtered()
+					<< " redundant state changes skipped, peak " << renderQueue.PeakBytes() / 1024 << " KB per frame" << endl;
+			}
+			if (markerRenderer.DrawCalls() + featureRenderer.DrawCalls() > 0)
+			{
+				cout << "Overlays: " << markerRenderer.Instances() + featureRenderer.Instances() << " instances in "
+					<< markerRenderer.DrawCalls() + featureRenderer.DrawCalls() << " draw calls, "
+					<< markerRenderer.Culled() + featureRenderer.Culled() << " culled" << endl;
+			}
+			markerRenderer.Release();
+			featureRenderer.Release();
+			if (backgroundVAO != 0)
+				glDeleteVertexArrays(1, &backgroundVAO);
+			backgroundVAO = 0;
+			glReady = false;
+
+			if (config.lazyGL)
+				gladPrintLazyStats();
+		}
+		if (input.Events() > 0)
+			cout << "Input: " << input.Events() << " events, " << input.Overflows() << " lost to a full queue" << endl;
+		input.Detach();
+		window = NULL;
+		headlessContext.Destroy();
 		glfwTerminate();
+
+		// every other thread has finished by now
+		if (Trace::IsEnabled())
+			WriteTrace();
 	}
 
 private:
+	AppConfig config;
 	GLFWwindow* window;
-	cv::VideoCapture video;
+	bool glReady;
+	unique_ptr<FrameSource> source;
+	double sourceFps;	// read before the capture thread takes the source over
+
+	// camera frames arrive through a lock-free ring filled by the capture thread
+	static const int FRAME_RING_SIZE = 4;
+	unique_ptr<FrameRing> frameRing;
+	unique_ptr<CaptureThread> capture;
+	cv::Mat cameraFrame;
+
+	// per-frame CV temporaries are bump allocated and released all at once
+	FrameArena frameArena;
+	cv::Mat grayFrame;
+	cv::Mat undistortedFrame;
+
+	// intrinsics of the opened source, scaled to its frame size
+	CameraCalibration calibration;
+
+	// lens correction maps, applied before upload or while drawing the background
+	Undistorter undistorter;
+	Shader undistortShader;
+
+	// ArUco markers with filtered poses, optionally searched only where they are expected
+	MarkerTracker markerTracker;
+
+	// corner tracks carried from frame to frame
+	FeatureTracker featureTracker;
+
+	// tracking results drawn over the background, every object of a kind in one draw call
+	static const int FEATURE_SIZE = 5;	// pixels
+	InstancedRenderer markerRenderer;
+	InstancedRenderer featureRenderer;
+
+	// overlay draws are recorded on worker threads and replayed here in one submission
+	static const int RENDER_WORKERS = 2;
+	RenderQueue renderQueue;
+
+	// programs come from the binary cache or a background compile
+	ShaderManager shaderManager;
+
+	// camera frames reach the screen through a texture drawn as background
+	FrameUploader frameUploader;
+	Shader backgroundShader;
+	GLuint backgroundVAO;
+
+	// decides when to draw and measures cpu/gpu/present time of every frame
+	FramePacer framePacer;
+
+	// headless mode renders offscreen and streams results to the sink instead of swapping
+	HeadlessContext headlessContext;
+	RenderTarget renderTarget;
+	FrameSink frameSink;
+
+	// windowed recording never blocks the render loop on the encoder (unless asked to)
+	VideoRecorder cameraRecorder;
+	VideoRecorder outputRecorder;
+
+	// rendered frames come back to the CPU through pack buffers, never stalling the GPU pipeline
+	AsyncReadback readback;
+
+	// window events queued by GLFW callbacks, mapped to actions
+	InputSystem input;
+	InputFrame inputFrame;
+	bool showOverlays;
 };
 
-int main()
+// calibration tool mode: no window, no camera
+static bool RunCalibration(const AppConfig& config)
+{
+	CalibratorOptions options;
+	options.boardSize = config.boardSize;
+	options.squareSize = config.squareSize;
+	options.flags = config.solverFlags;
+	options.cacheDirectory = config.cacheDirectory;
+
+	Calibrator calibrator(options);
+	CameraCalibration calibration;
+	const bool solved = calibrator.Run(config.calibrateImages, calibration);
+	cout << "Calibration: " << calibrator.Images() << " images, " << calibrator.CachedImages() << " from cache, "
+		<< calibrator.UsableImages() << " with a board, detection " << calibrator.DetectSeconds() << " s" << endl;
+	if (!solved)
+		return false;
+
+	cout << "  rms reprojection error " << calibrator.ReprojectionError() << " px, solve " << calibrator.SolveSeconds() << " s" << endl;
+	const std::string path = config.calibrationPath.empty() ? "calibration.yml" : config.calibrationPath;
+	if (!calibration.Save(path))
+		return false;
+	cout << "  written to " << path << endl;
+	return true;
+}
+
+int main(int argc, char** argv)
 {
 	cout << "HW1 started" << endl;
 
-	MainApplication app;
+	AppConfig config;
+	if (!ParseArgs(argc, argv, config))
+		return 1;
+
+	if (!config.tracePath.empty())
+	{
+		Trace::Enable(true);
+		Trace::SetThreadName("Main");
+	}
+
+	if (!config.calibrateImages.empty())
+		return RunCalibration(config) ? 0 : 1;
+
+	MainApplication app(config);
 	app.Start();
 
 	return 0;
@@ -0,0 +1,433 @@
+#include "MarkerTracker.h"
+
+#include <opencv2/calib3d.hpp>
+#include <opencv2/core/utility.hpp>
+#include <opencv2/imgproc.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+// pose state: rvec, tvec and their per-frame velocities
+static const int STATE_SIZE = 12;
+static const int MEASUREMENT_SIZE = 6;
+
+// ROIs grow by this fraction of the predicted marker size on every side
+static const float ROI_PADDING = 0.5f;
+
+MarkerTracker::MarkerTracker()
+	: markerLength(0.0f), roiTracking(true), tiledScan(true), lostTrack(true), framesSinceScan(0),
+	frames(0), fullScans(0), tilesPerScan(1), detectMs(0.0), scannedFraction(0.0)
+{
+}
+
+void MarkerTracker::Init(const CameraCalibration& calibration, float markerLength, bool roiTracking)
+{
+	this->calibration = calibration;
+	this->markerLength = markerLength;
+	this->roiTracking = roiTracking;
+
+	dictionary = cv::aruco::getPredefinedDictionary(DEFAULT_DICTIONARY);
+	parameters = cv::aruco::DetectorParameters::create();
+	parameters->cornerRefinementMethod = cv::aruco::CORNER_REFINE_SUBPIX;
+
+	// same corner order estimatePoseSingleMarkers uses
+	const float h = markerLength * 0.5f;
+	objectCorners.clear();
+	objectCorners.push_back(cv::Point3f(-h, h, 0.0f));
+	objectCorners.push_back(cv::Point3f(h, h, 0.0f));
+	objectCorners.push_back(cv::Point3f(h, -h, 0.0f));
+	objectCorners.push_back(cv::Point3f(-h, -h, 0.0f));
+
+	tracks.clear();
+	markers.clear();
+	lostTrack = true;
+}
+
+void MarkerTracker::InitFilter(cv::KalmanFilter& filter, const cv::Vec3d& rvec, const cv::Vec3d& tvec) const
+{
+	filter.init(STATE_SIZE, MEASUREMENT_SIZE, 0, CV_64F);
+
+	// x' = x + v, v' = v
+	cv::setIdentity(filter.transitionMatrix);
+	for (int i = 0; i < MEASUREMENT_SIZE; i++)
+		filter.transitionMatrix.at<double>(i, i + MEASUREMENT_SIZE) = 1.0;
+	filter.measurementMatrix = cv::Mat::zeros(MEASUREMENT_SIZE, STATE_SIZE, CV_64F);
+	for (int i = 0; i < MEASUREMENT_SIZE; i++)
+		filter.measurementMatrix.at<double>(i, i) = 1.0;
+
+	// translations scale with the marker size, rotations are in radians
+	const double t2 = (double)markerLength * markerLength;
+	cv::setIdentity(filter.processNoiseCov, cv::Scalar::all(1e-4));
+	for (int i = 0; i < 3; i++)
+	{
+		filter.processNoiseCov.at<double>(3 + i, 3 + i) = 1e-4 * t2;
+		filter.processNoiseCov.at<double>(9 + i, 9 + i) = 1e-3 * t2;
+		filter.processNoiseCov.at<double>(6 + i, 6 + i) = 1e-3;
+	}
+	cv::setIdentity(filter.measurementNoiseCov, cv::Scalar::all(1e-3));
+	for (int i = 0; i < 3; i++)
+		filter.measurementNoiseCov.at<double>(3 + i, 3 + i) = 1e-4 * t2;
+	cv::setIdentity(filter.errorCovPost, cv::Scalar::all(1.0));
+
+	filter.statePost = cv::Mat::zeros(STATE_SIZE, 1, CV_64F);
+	for (int i = 0; i < 3; i++)
+	{
+		filter.statePost.at<double>(i) = rvec[i];
+		filter.statePost.at<double>(3 + i) = tvec[i];
+	}
+}
+
+bool MarkerTracker::PredictRois(cv::Size frameSize, std::vector<cv::Rect>& rois)
+{
+	const cv::Rect frame(cv::Point(0, 0), frameSize);
+	rois.clear();
+
+	// every filter steps forward, even when one prediction already forces a
+	// full scan: the scan corrects all of them against this frame
+	bool usable = true;
+	for (size_t i = 0; i < tracks.size(); i++)
+	{
+		Track& track = tracks[i];
+		const cv::Mat& state = track.filter.predict();
+		track.marker.rvec = cv::Vec3d(state.at<double>(0), state.at<double>(1), state.at<double>(2));
+		track.marker.tvec = cv::Vec3d(state.at<double>(3), state.at<double>(4), state.at<double>(5));
+		track.marker.detected = false;
+
+		// behind the camera: the prediction is useless, scan everything
+		if (track.marker.tvec[2] <= 0.0)
+		{
+			usable = false;
+			continue;
+		}
+
+		cv::projectPoints(objectCorners, track.marker.rvec, track.marker.tvec,
+			calibration.cameraMatrix, calibration.distCoeffs, track.marker.corners);
+
+		cv::Rect box = cv::boundingRect(track.marker.corners);
+		const int pad = std::max(MIN_ROI_PADDING, (int)(ROI_PADDING * std::max(box.width, box.height)));
+		box = cv::Rect(box.x - pad, box.y - pad, box.width + 2 * pad, box.height + 2 * pad) & frame;
+		if (box.area() > 0)
+			rois.push_back(box);
+	}
+
+	if (!usable)
+		return false;
+
+	// overlapping ROIs would detect the same marker twice, merge them
+	for (bool merged = true; merged; )
+	{
+		merged = false;
+		for (size_t i = 0; i < rois.size() && !merged; i++)
+		{
+			for (size_t j = i + 1; j < rois.size(); j++)
+			{
+				if ((rois[i] & rois[j]).area() > 0)
+				{
+					rois[i] |= rois[j];
+					rois.erase(rois.begin() + j);
+					merged = true;
+					break;
+				}
+			}
+		}
+	}
+	return true;
+}
+
+// a marker found twice, by overlapping tiles or ROIs, has nearly the same corners
+// both times. two real markers never overlap, whatever their ids
+static bool SameMarker(const std::vector<cv::Point2f>& a, const std::vector<cv::Point2f>& b)
+{
+	const cv::Point2f centerA = (a[0] + a[1] + a[2] + a[3]) * 0.25f;
+	const cv::Point2f centerB = (b[0] + b[1] + b[2] + b[3]) * 0.25f;
+	const double side = cv::norm(a[1] - a[0]);
+	return cv::norm(centerA - centerB) < 0.25 * side;
+}
+
+// of two candidates that close, detectMarkers keeps the larger one (the outer
+// border contour rather than the inner), so merging does the same
+static void AppendUnique(const std::vector<std::vector<cv::Point2f> >& found, const std::vector<int>& foundIds,
+	std::vector<std::vector<cv::Point2f> >& corners, std::vector<int>& ids)
+{
+	for (size_t i = 0; i < found.size(); i++)
+	{
+		size_t j = 0;
+		while (j < corners.size() && !SameMarker(found[i], corners[j]))
+			j++;
+		if (j == corners.size())
+		{
+			corners.push_back(found[i]);
+			ids.push_back(foundIds[i]);
+		}
+		else if (cv::arcLength(found[i], true) > cv::arcLength(corners[j], true))
+		{
+			corners[j] = found[i];
+			ids[j] = foundIds[i];
+		}
+	}
+}
+
+void MarkerTracker::FramePerimeters(cv::Size frameSize, int& minPerimeter, int& maxPerimeter) const
+{
+	// as detectMarkers computes them for the whole frame
+	const int size = std::max(frameSize.width, frameSize.height);
+	minPerimeter = (int)(parameters->minMarkerPerimeterRate * size);
+	maxPerimeter = (int)(parameters->maxMarkerPerimeterRate * size);
+}
+
+cv::Ptr<cv::aruco::DetectorParameters> MarkerTracker::ParametersFor(cv::Size regionSize, int minPerimeter, int maxPerimeter) const
+{
+	// detectMarkers measures contours in points and scales its limits by the
+	// larger image side; the half point survives its truncation back to pixels
+	cv::Ptr<cv::aruco::DetectorParameters> region = cv::makePtr<cv::aruco::DetectorParameters>(*parameters);
+	const double size = std::max(regionSize.width, regionSize.height);
+	region->minMarkerPerimeterRate = (minPerimeter + 0.5) / size;
+	region->maxMarkerPerimeterRate = (maxPerimeter + 0.5) / size;
+	return region;
+}
+
+void MarkerTracker::Detect(const cv::Mat& gray, const cv::Rect& roi, int minPerimeter, int maxPerimeter,
+	std::vector<std::vector<cv::Point2f> >& corners, std::vector<int>& ids) const
+{
+	cv::aruco::detectMarkers(gray(roi), dictionary, corners, ids, ParametersFor(roi.size(), minPerimeter, maxPerimeter));
+
+	const cv::Point2f offset((float)roi.x, (float)roi.y);
+	for (size_t i = 0; i < corners.size(); i++)
+	{
+		for (size_t c = 0; c < corners[i].size(); c++)
+			corners[i][c] += offset;
+	}
+}
+
+int MarkerTracker::TileOverlap(cv::Size frameSize) const
+{
+	// room for a quarter of the frame, or the largest tracked marker, centered
+	// in a tile core, plus the largest adaptive threshold window around it
+	int largest = std::min(frameSize.width, frameSize.height) / 4;
+	for (size_t i = 0; i < tracks.size(); i++)
+	{
+		const cv::Rect box = cv::boundingRect(tracks[i].marker.corners);
+		largest = std::max(largest, std::max(box.width, box.height));
+	}
+	return largest / 2 + parameters->adaptiveThreshWinSizeMax + MIN_ROI_PADDING;
+}
+
+void MarkerTracker::DetectTiled(const cv::Mat& gray, std::vector<std::vector<cv::Point2f> >& corners, std::vector<int>& ids)
+{
+	const cv::Rect frame(cv::Point(0, 0), gray.size());
+	int minPerimeter, maxPerimeter;
+	FramePerimeters(gray.size(), minPerimeter, maxPerimeter);
+
+	// near-square grid with about one tile per thread
+	const int threads = std::max(1, cv::getNumThreads());
+	int cols = std::max(1, std::min(frame.width / MIN_TILE_SIZE, (int)std::ceil(std::sqrt(threads * (double)frame.width / frame.height))));
+	int rows = std::max(1, std::min(frame.height / MIN_TILE_SIZE, (threads + cols - 1) / cols));
+
+	// a convex quad reaches at most 3/8 of its perimeter from its center, and a
+	// contour of c points is at most sqrt(2) c long: markers with contours up to
+	// 'tilePerimeter' points lie completely inside the tile whose core holds
+	// their center. longer ones are located in a downscaled copy of the frame
+	// and detected again at full resolution around where they were found
+	const int overlap = TileOverlap(gray.size());
+	const int margin = parameters->adaptiveThreshWinSizeMax + MIN_ROI_PADDING;
+	const int tilePerimeter = (overlap - margin) * 15 / 8;
+	const bool coarse = maxPerimeter > tilePerimeter;
+	const int scale = tilePerimeter / MIN_COARSE_PERIMETER;
+
+	tilesPerScan = cols * rows;
+	if (!tiledScan || tilesPerScan == 1 || tilePerimeter < minPerimeter || (coarse && scale < 2))
+	{
+		tilesPerScan = 1;
+		Detect(gray, frame, minPerimeter, maxPerimeter, corners, ids);
+		return;
+	}
+
+	std::vector<cv::Rect> cores(tilesPerScan), tiles(tilesPerScan);
+	for (int r = 0; r < rows; r++)
+	{
+		for (int c = 0; c < cols; c++)
+		{
+			const int x0 = frame.width * c / cols, x1 = frame.width * (c + 1) / cols;
+			const int y0 = frame.height * r / rows, y1 = frame.height * (r + 1) / rows;
+			cores[r * cols + c] = cv::Rect(x0, y0, x1 - x0, y1 - y0);
+			tiles[r * cols + c] = cv::Rect(x0 - overlap, y0 - overlap, x1 - x0 + 2 * overlap, y1 - y0 + 2 * overlap) & frame;
+		}
+	}
+
+	// the coarse pass runs next to the tiles as one more task
+	const int tasks = tilesPerScan + (coarse ? 1 : 0);
+	std::vector<std::vector<std::vector<cv::Point2f> > > tileCorners(tasks);
+	std::vector<std::vector<int> > tileIds(tasks);
+	cv::Mat small;
+	cv::parallel_for_(cv::Range(0, tasks), [&](const cv::Range& range)
+	{
+		for (int t = range.start; t < range.end; t++)
+		{
+			if (t < tilesPerScan)
+			{
+				Detect(gray, tiles[t], minPerimeter, std::min(maxPerimeter, tilePerimeter), tileCorners[t], tileIds[t]);
+				continue;
+			}
+
+			// contours shrink by about 'scale' points per point, the limits leave slack
+			// for that; the full resolution pass applies the exact ones
+			cv::resize(gray, small, cv::Size(gray.cols / scale, gray.rows / scale), 0.0, 0.0, cv::INTER_AREA);
+			const cv::Rect all(cv::Point(0, 0), small.size());
+			Detect(small, all, tilePerimeter * 2 / (3 * scale), maxPerimeter * 3 / (2 * scale), tileCorners[t], tileIds[t]);
+		}
+	}, tasks);
+
+	// merge in tile order so the result does not depend on thread timing
+	for (int t = 0; t < tilesPerScan; t++)
+	{
+		std::vector<std::vector<cv::Point2f> > found;
+		std::vector<int> foundIds;
+		for (size_t i = 0; i < tileIds[t].size(); i++)
+		{
+			const std::vector<cv::Point2f>& quad = tileCorners[t][i];
+			const cv::Point2f center = (quad[0] + quad[1] + quad[2] + quad[3]) * 0.25f;
+			if (!cores[t].contains(cv::Point((int)std::floor(center.x), (int)std::floor(center.y))))
+				continue;
+			found.push_back(quad);
+			foundIds.push_back(tileIds[t][i]);
+		}
+		AppendUnique(found, foundIds, corners, ids);
+	}
+	if (!coarse || tileIds[tilesPerScan].empty())
+		return;
+
+	// map the coarse quads back to full resolution pixel centers and search
+	// around them, padded like a tile around its core
+	const float sx = (float)gray.cols / small.cols, sy = (float)gray.rows / small.rows;
+	std::vector<cv::Rect> regions;
+	for (size_t i = 0; i < tileCorners[tilesPerScan].size(); i++)
+	{
+		std::vector<cv::Point2f> quad = tileCorners[tilesPerScan][i];
+		for (size_t c = 0; c < quad.size(); c++)
+			quad[c] = cv::Point2f((quad[c].x + 0.5f) * sx - 0.5f, (quad[c].y + 0.5f) * sy - 0.5f);
+		const cv::Rect box = cv::boundingRect(quad);
+		const int pad = margin + 2 * scale;
+		regions.push_back(cv::Rect(box.x - pad, box.y - pad, box.width + 2 * pad, box.height + 2 * pad) & frame);
+	}
+
+	std::vector<std::vector<std::vector<cv::Point2f> > > regionCorners(regions.size());
+	std::vector<std::vector<int> > regionIds(regions.size());
+	cv::parallel_for_(cv::Range(0, (int)regions.size()), [&](const cv::Range& range)
+	{
+		for (int r = range.start; r < range.end; r++)
+			Detect(gray, regions[r], tilePerimeter + 1, maxPerimeter, regionCorners[r], regionIds[r]);
+	});
+	for (size_t r = 0; r < regions.size(); r++)
+		AppendUnique(regionCorners[r], regionIds[r], corners, ids);
+}
+
+void MarkerTracker::Update(const std::vector<std::vector<cv::Point2f> >& corners, const std::vector<int>& ids)
+{
+	std::vector<cv::Vec3d> rvecs, tvecs;
+	if (!ids.empty())
+		cv::aruco::estimatePoseSingleMarkers(corners, markerLength, calibration.cameraMatrix, calibration.distCoeffs, rvecs, tvecs);
+
+	for (size_t i = 0; i < tracks.size(); i++)
+		tracks[i].missed++;
+
+	cv::Mat measurement(MEASUREMENT_SIZE, 1, CV_64F);
+	for (size_t i = 0; i < ids.size(); i++)
+	{
+		Track* track = NULL;
+		for (size_t t = 0; t < tracks.size() && track == NULL; t++)
+		{
+			if (tracks[t].id == ids[i])
+				track = &tracks[t];
+		}
+
+		if (track == NULL)
+		{
+			tracks.push_back(Track());
+			track = &tracks.back();
+			track->id = ids[i];
+			track->marker.id = ids[i];
+			InitFilter(track->filter, rvecs[i], tvecs[i]);
+		}
+		else
+		{
+			for (int k = 0; k < 3; k++)
+			{
+				measurement.at<double>(k) = rvecs[i][k];
+				measurement.at<double>(3 + k) = tvecs[i][k];
+			}
+			track->filter.correct(measurement);
+		}
+
+		const cv::Mat& state = track->filter.statePost;
+		track->marker.rvec = cv::Vec3d(state.at<double>(0), state.at<double>(1), state.at<double>(2));
+		track->marker.tvec = cv::Vec3d(state.at<double>(3), state.at<double>(4), state.at<double>(5));
+		track->marker.corners = corners[i];
+		track->marker.detected = true;
+		track->missed = 0;
+	}
+
+	// a marker that slipped out of its ROI is searched for in the whole next frame
+	lostTrack = false;
+	for (size_t i = 0; i < tracks.size(); )
+	{
+		if (tracks[i].missed > 0)
+			lostTrack = true;
+		if (tracks[i].missed > MAX_MISSED_FRAMES)
+			tracks.erase(tracks.begin() + i);
+		else
+			i++;
+	}
+
+	markers.clear();
+	for (size_t i = 0; i < tracks.size(); i++)
+		markers.push_back(tracks[i].marker);
+}
+
+void MarkerTracker::Process(const cv::Mat& gray)
+{
+	if (!IsInitialized() || gray.empty())
+		return;
+
+	const int64 start = cv::getTickCount();
+	const cv::Rect frame(cv::Point(0, 0), gray.size());
+
+	std::vector<cv::Rect> rois;
+	bool fullScan = !roiTracking || tracks.empty() || lostTrack || framesSinceScan + 1 >= FULL_SCAN_INTERVAL;
+	if (!PredictRois(gray.size(), rois))
+		fullScan = true;
+	if (fullScan)
+	{
+		rois.assign(1, frame);
+		framesSinceScan = 0;
+		fullScans++;
+	}
+	else
+		framesSinceScan++;
+
+	std::vector<std::vector<cv::Point2f> > corners;
+	std::vector<int> ids;
+	double area = 0.0;
+	if (fullScan)
+	{
+		DetectTiled(gray, corners, ids);
+		area = frame.area();
+	}
+	else
+	{
+		int minPerimeter, maxPerimeter;
+		FramePerimeters(gray.size(), minPerimeter, maxPerimeter);
+		for (size_t i = 0; i < rois.size(); i++)
+		{
+			std::vector<std::vector<cv::Point2f> > roiCorners;
+			std::vector<int> roiIds;
+			Detect(gray, rois[i], minPerimeter, maxPerimeter, roiCorners, roiIds);
+			AppendUnique(roiCorners, roiIds, corners, ids);
+			area += rois[i].area();
+		}
+	}
+	Update(corners, ids);
+
+	frames++;
+	detectMs += (cv::getTickCount() - start) * 1000.0 / cv::getTickFrequency();
+	scannedFraction += area / frame.area();
+}
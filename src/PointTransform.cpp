@@ -0,0 +1,703 @@
+#include "PointTransform.h"
+
+#include <glm/simd/matrix.h>
+
+#include <opencv2/core.hpp>
+#include <opencv2/core/utility.hpp>
+
+#include <algorithm>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(_M_IX86) || defined(__i386__)
+#define PT_X86 1
+#include <immintrin.h>
+#endif
+
+// GCC and clang only emit AVX instructions in functions that ask for them,
+// MSVC accepts the intrinsics anywhere
+#if defined(__GNUC__) || defined(__clang__)
+#define PT_TARGET(isa) __attribute__((target(isa)))
+#else
+#define PT_TARGET(isa)
+#endif
+
+namespace
+{
+	struct SoAStreams
+	{
+		const float* x;
+		const float* y;
+		const float* z;
+		float* outX;
+		float* outY;
+		float* outZ;
+		float* outW;
+	};
+
+	typedef void (*Vec4Kernel)(const glm::mat4& m, const glm::vec4* in, glm::vec4* out, size_t count);
+	typedef void (*Vec3To4Kernel)(const glm::mat4& m, const glm::vec3* in, glm::vec4* out, size_t count);
+	typedef void (*Vec3Kernel)(const glm::mat4& m, const glm::vec3* in, glm::vec3* out, size_t count);
+	typedef void (*SoAKernel)(const glm::mat4& m, const SoAStreams& s, size_t begin, size_t end);
+	typedef void (*QuatMulKernel)(const glm::quat* a, const glm::quat* b, glm::quat* out, size_t count);
+	// 't' may be NULL, then 'tConst' is used for every pair
+	typedef void (*QuatSlerpKernel)(const glm::quat* a, const glm::quat* b, const float* t, float tConst, glm::quat* out, size_t count);
+
+	// Eberly's slerp coefficients: u[i] = 1 / ((i + 1) * (2i + 3)), v[i] = (i + 1) / (2i + 3).
+	// the last pair is scaled by mu to balance the truncation error; with 14 terms and
+	// this mu the weights stay within 1.5e-7 of sin(t * angle) / sin(angle), which
+	// leaves results within 5e-7 of glm::slerp after float rounding
+	const int SLERP_TERMS = 14;
+	const float SLERP_MU = 1.9065f;
+	const float SLERP_U[SLERP_TERMS] = {
+		1.0f / (1 * 3), 1.0f / (2 * 5), 1.0f / (3 * 7), 1.0f / (4 * 9),
+		1.0f / (5 * 11), 1.0f / (6 * 13), 1.0f / (7 * 15), 1.0f / (8 * 17),
+		1.0f / (9 * 19), 1.0f / (10 * 21), 1.0f / (11 * 23), 1.0f / (12 * 25),
+		1.0f / (13 * 27), SLERP_MU / (14 * 29)
+	};
+	const float SLERP_V[SLERP_TERMS] = {
+		1.0f / 3, 2.0f / 5, 3.0f / 7, 4.0f / 9,
+		5.0f / 11, 6.0f / 13, 7.0f / 15, 8.0f / 17,
+		9.0f / 19, 10.0f / 21, 11.0f / 23, 12.0f / 25,
+		13.0f / 27, SLERP_MU * 14 / 29
+	};
+
+	// ---------------------------------------------------------------- scalar
+
+	void Vec4Scalar(const glm::mat4& m, const glm::vec4* in, glm::vec4* out, size_t count)
+	{
+		for (size_t i = 0; i < count; i++)
+			out[i] = m * in[i];
+	}
+
+	void Vec3To4Scalar(const glm::mat4& m, const glm::vec3* in, glm::vec4* out, size_t count)
+	{
+		for (size_t i = 0; i < count; i++)
+			out[i] = m * glm::vec4(in[i], 1.0f);
+	}
+
+	void Vec3Scalar(const glm::mat4& m, const glm::vec3* in, glm::vec3* out, size_t count)
+	{
+		for (size_t i = 0; i < count; i++)
+			out[i] = glm::vec3(m * glm::vec4(in[i], 1.0f));
+	}
+
+	void SoAScalar(const glm::mat4& m, const SoAStreams& s, size_t begin, size_t end)
+	{
+		for (size_t i = begin; i < end; i++)
+		{
+			const glm::vec4 r = m * glm::vec4(s.x[i], s.y[i], s.z[i], 1.0f);
+			s.outX[i] = r.x;
+			s.outY[i] = r.y;
+			s.outZ[i] = r.z;
+			if (s.outW)
+				s.outW[i] = r.w;
+		}
+	}
+
+	void QuatMulScalar(const glm::quat* a, const glm::quat* b, glm::quat* out, size_t count)
+	{
+		for (size_t i = 0; i < count; i++)
+			out[i] = a[i] * b[i];
+	}
+
+	// the same polynomial the SIMD kernels use, so every level gives the same result
+	void QuatSlerpScalar(const glm::quat* a, const glm::quat* b, const float* t, float tConst, glm::quat* out, size_t count)
+	{
+		for (size_t i = 0; i < count; i++)
+		{
+			float x = glm::dot(a[i], b[i]);
+			const float sign = x < 0.0f ? -1.0f : 1.0f;
+			x *= sign;
+
+			const float ti = t ? t[i] : tConst;
+			const float di = 1.0f - ti;
+			const float xm1 = x - 1.0f;
+			float cT = 1.0f, cD = 1.0f;
+			for (int k = SLERP_TERMS - 1; k >= 0; k--)
+			{
+				cT = 1.0f + (SLERP_U[k] * ti * ti - SLERP_V[k]) * xm1 * cT;
+				cD = 1.0f + (SLERP_U[k] * di * di - SLERP_V[k]) * xm1 * cD;
+			}
+			cT *= sign * ti;
+			cD *= di;
+
+			const glm::quat& p = a[i];
+			const glm::quat& q = b[i];
+			out[i] = glm::quat(p.w * cD + q.w * cT, p.x * cD + q.x * cT, p.y * cD + q.y * cT, p.z * cD + q.z * cT);
+		}
+	}
+
+#if PT_X86
+	// ---------------------------------------------------------------- SSE2
+
+	// 4 packed vec3 (3 registers) <-> x, y, z registers
+	inline void Deinterleave3(__m128 a, __m128 b, __m128 c, __m128& x, __m128& y, __m128& z)
+	{
+		// a = x0 y0 z0 x1, b = y1 z1 x2 y2, c = z2 x3 y3 z3
+		const __m128 x23 = _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2));
+		x = _mm_shuffle_ps(a, x23, _MM_SHUFFLE(2, 0, 3, 0));
+		const __m128 y01 = _mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1));
+		const __m128 y23 = _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3));
+		y = _mm_shuffle_ps(y01, y23, _MM_SHUFFLE(2, 0, 2, 0));
+		const __m128 z01 = _mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2));
+		const __m128 z23 = _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 0, 0));
+		z = _mm_shuffle_ps(z01, z23, _MM_SHUFFLE(2, 0, 2, 0));
+	}
+
+	inline void Interleave3(__m128 x, __m128 y, __m128 z, __m128& a, __m128& b, __m128& c)
+	{
+		const __m128 xy0 = _mm_shuffle_ps(x, y, _MM_SHUFFLE(0, 0, 0, 0));
+		const __m128 zx0 = _mm_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0));
+		a = _mm_shuffle_ps(xy0, zx0, _MM_SHUFFLE(2, 0, 2, 0));
+		const __m128 yz1 = _mm_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1));
+		const __m128 xy2 = _mm_shuffle_ps(x, y, _MM_SHUFFLE(2, 2, 2, 2));
+		b = _mm_shuffle_ps(yz1, xy2, _MM_SHUFFLE(2, 0, 2, 0));
+		const __m128 zx2 = _mm_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2));
+		const __m128 yz3 = _mm_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3));
+		c = _mm_shuffle_ps(zx2, yz3, _MM_SHUFFLE(2, 0, 2, 0));
+	}
+
+	// one output row of m * (x, y, z, 1) for 4 points
+	inline __m128 Row4(const glm::mat4& m, int row, __m128 x, __m128 y, __m128 z)
+	{
+		__m128 r = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(m[0][row]), x), _mm_mul_ps(_mm_set1_ps(m[1][row]), y));
+		r = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(m[2][row]), z));
+		return _mm_add_ps(r, _mm_set1_ps(m[3][row]));
+	}
+
+	void Vec4SSE2(const glm::mat4& m, const glm::vec4* in, glm::vec4* out, size_t count)
+	{
+		glm_vec4 cols[4];
+		for (int c = 0; c < 4; c++)
+			cols[c] = _mm_loadu_ps(&m[c][0]);
+
+		for (size_t i = 0; i < count; i++)
+			_mm_storeu_ps(&out[i].x, glm_mat4_mul_vec4(cols, _mm_loadu_ps(&in[i].x)));
+	}
+
+	void Vec3To4SSE2(const glm::mat4& m, const glm::vec3* in, glm::vec4* out, size_t count)
+	{
+		const float* src = &in[0].x;
+		size_t i = 0;
+		for (; i + 4 <= count; i += 4, src += 12)
+		{
+			__m128 x, y, z;
+			Deinterleave3(_mm_loadu_ps(src), _mm_loadu_ps(src + 4), _mm_loadu_ps(src + 8), x, y, z);
+			__m128 rx = Row4(m, 0, x, y, z);
+			__m128 ry = Row4(m, 1, x, y, z);
+			__m128 rz = Row4(m, 2, x, y, z);
+			__m128 rw = Row4(m, 3, x, y, z);
+			_MM_TRANSPOSE4_PS(rx, ry, rz, rw);
+			_mm_storeu_ps(&out[i + 0].x, rx);
+			_mm_storeu_ps(&out[i + 1].x, ry);
+			_mm_storeu_ps(&out[i + 2].x, rz);
+			_mm_storeu_ps(&out[i + 3].x, rw);
+		}
+		Vec3To4Scalar(m, in + i, out + i, count - i);
+	}
+
+	void Vec3SSE2(const glm::mat4& m, const glm::vec3* in, glm::vec3* out, size_t count)
+	{
+		const float* src = &in[0].x;
+		float* dst = &out[0].x;
+		size_t i = 0;
+		for (; i + 4 <= count; i += 4, src += 12, dst += 12)
+		{
+			__m128 x, y, z, a, b, c;
+			Deinterleave3(_mm_loadu_ps(src), _mm_loadu_ps(src + 4), _mm_loadu_ps(src + 8), x, y, z);
+			Interleave3(Row4(m, 0, x, y, z), Row4(m, 1, x, y, z), Row4(m, 2, x, y, z), a, b, c);
+			_mm_storeu_ps(dst, a);
+			_mm_storeu_ps(dst + 4, b);
+			_mm_storeu_ps(dst + 8, c);
+		}
+		Vec3Scalar(m, in + i, out + i, count - i);
+	}
+
+	void SoASSE2(const glm::mat4& m, const SoAStreams& s, size_t begin, size_t end)
+	{
+		size_t i = begin;
+		for (; i + 4 <= end; i += 4)
+		{
+			const __m128 x = _mm_loadu_ps(s.x + i);
+			const __m128 y = _mm_loadu_ps(s.y + i);
+			const __m128 z = _mm_loadu_ps(s.z + i);
+			const __m128 rx = Row4(m, 0, x, y, z);
+			const __m128 ry = Row4(m, 1, x, y, z);
+			const __m128 rz = Row4(m, 2, x, y, z);
+			if (s.outW)
+				_mm_storeu_ps(s.outW + i, Row4(m, 3, x, y, z));
+			_mm_storeu_ps(s.outX + i, rx);
+			_mm_storeu_ps(s.outY + i, ry);
+			_mm_storeu_ps(s.outZ + i, rz);
+		}
+		SoAScalar(m, s, i, end);
+	}
+
+	// 4 quaternions <-> x, y, z, w registers
+	inline void LoadQuats4(const glm::quat* q, __m128& x, __m128& y, __m128& z, __m128& w)
+	{
+		x = _mm_loadu_ps(&q[0].x);
+		y = _mm_loadu_ps(&q[1].x);
+		z = _mm_loadu_ps(&q[2].x);
+		w = _mm_loadu_ps(&q[3].x);
+		_MM_TRANSPOSE4_PS(x, y, z, w);
+	}
+
+	inline void StoreQuats4(glm::quat* q, __m128 x, __m128 y, __m128 z, __m128 w)
+	{
+		_MM_TRANSPOSE4_PS(x, y, z, w);
+		_mm_storeu_ps(&q[0].x, x);
+		_mm_storeu_ps(&q[1].x, y);
+		_mm_storeu_ps(&q[2].x, z);
+		_mm_storeu_ps(&q[3].x, w);
+	}
+
+	void QuatMulSSE2(const glm::quat* a, const glm::quat* b, glm::quat* out, size_t count)
+	{
+		size_t i = 0;
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128 px, py, pz, pw, qx, qy, qz, qw;
+			LoadQuats4(a + i, px, py, pz, pw);
+			LoadQuats4(b + i, qx, qy, qz, qw);
+
+			const __m128 w = _mm_sub_ps(_mm_sub_ps(_mm_mul_ps(pw, qw), _mm_mul_ps(px, qx)), _mm_add_ps(_mm_mul_ps(py, qy), _mm_mul_ps(pz, qz)));
+			const __m128 x = _mm_sub_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(pw, qx), _mm_mul_ps(px, qw)), _mm_mul_ps(py, qz)), _mm_mul_ps(pz, qy));
+			const __m128 y = _mm_sub_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(pw, qy), _mm_mul_ps(py, qw)), _mm_mul_ps(pz, qx)), _mm_mul_ps(px, qz));
+			const __m128 z = _mm_sub_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(pw, qz), _mm_mul_ps(pz, qw)), _mm_mul_ps(px, qy)), _mm_mul_ps(py, qx));
+			StoreQuats4(out + i, x, y, z, w);
+		}
+		QuatMulScalar(a + i, b + i, out + i, count - i);
+	}
+
+	void QuatSlerpSSE2(const glm::quat* a, const glm::quat* b, const float* t, float tConst, glm::quat* out, size_t count)
+	{
+		const __m128 one = _mm_set1_ps(1.0f);
+		const __m128 signBit = _mm_set1_ps(-0.0f);
+
+		size_t i = 0;
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128 px, py, pz, pw, qx, qy, qz, qw;
+			LoadQuats4(a + i, px, py, pz, pw);
+			LoadQuats4(b + i, qx, qy, qz, qw);
+
+			const __m128 dot = _mm_add_ps(_mm_add_ps(_mm_mul_ps(px, qx), _mm_mul_ps(py, qy)), _mm_add_ps(_mm_mul_ps(pz, qz), _mm_mul_ps(pw, qw)));
+			const __m128 sign = _mm_and_ps(dot, signBit);
+			const __m128 xm1 = _mm_sub_ps(_mm_andnot_ps(signBit, dot), one);
+
+			const __m128 vt = t ? _mm_loadu_ps(t + i) : _mm_set1_ps(tConst);
+			const __m128 vd = _mm_sub_ps(one, vt);
+			const __m128 tt = _mm_mul_ps(vt, vt);
+			const __m128 dd = _mm_mul_ps(vd, vd);
+			__m128 cT = one, cD = one;
+			for (int k = SLERP_TERMS - 1; k >= 0; k--)
+			{
+				const __m128 u = _mm_set1_ps(SLERP_U[k]);
+				const __m128 v = _mm_set1_ps(SLERP_V[k]);
+				cT = _mm_add_ps(one, _mm_mul_ps(_mm_mul_ps(_mm_sub_ps(_mm_mul_ps(u, tt), v), xm1), cT));
+				cD = _mm_add_ps(one, _mm_mul_ps(_mm_mul_ps(_mm_sub_ps(_mm_mul_ps(u, dd), v), xm1), cD));
+			}
+			// flipping the sign of the b weight takes the shorter arc
+			cT = _mm_xor_ps(_mm_mul_ps(cT, vt), sign);
+			cD = _mm_mul_ps(cD, vd);
+
+			StoreQuats4(out + i,
+				_mm_add_ps(_mm_mul_ps(px, cD), _mm_mul_ps(qx, cT)),
+				_mm_add_ps(_mm_mul_ps(py, cD), _mm_mul_ps(qy, cT)),
+				_mm_add_ps(_mm_mul_ps(pz, cD), _mm_mul_ps(qz, cT)),
+				_mm_add_ps(_mm_mul_ps(pw, cD), _mm_mul_ps(qw, cT)));
+		}
+		QuatSlerpScalar(a + i, b + i, t ? t + i : NULL, tConst, out + i, count - i);
+	}
+
+	// ---------------------------------------------------------------- AVX2 + FMA
+
+	PT_TARGET("avx2,fma") inline __m256 Row8(const glm::mat4& m, int row, __m256 x, __m256 y, __m256 z)
+	{
+		__m256 r = _mm256_fmadd_ps(_mm256_set1_ps(m[0][row]), x, _mm256_set1_ps(m[3][row]));
+		r = _mm256_fmadd_ps(_mm256_set1_ps(m[1][row]), y, r);
+		return _mm256_fmadd_ps(_mm256_set1_ps(m[2][row]), z, r);
+	}
+
+	PT_TARGET("avx2,fma") inline __m256 Combine(__m128 lo, __m128 hi)
+	{
+		return _mm256_insertf128_ps(_mm256_castps128_ps256(lo), hi, 1);
+	}
+
+	PT_TARGET("avx2,fma") void Vec4AVX2(const glm::mat4& m, const glm::vec4* in, glm::vec4* out, size_t count)
+	{
+		// every matrix column repeated in both 128 bit lanes, two points per register
+		const __m256 c0 = _mm256_broadcast_ps((const __m128*)&m[0][0]);
+		const __m256 c1 = _mm256_broadcast_ps((const __m128*)&m[1][0]);
+		const __m256 c2 = _mm256_broadcast_ps((const __m128*)&m[2][0]);
+		const __m256 c3 = _mm256_broadcast_ps((const __m128*)&m[3][0]);
+
+		size_t i = 0;
+		for (; i + 4 <= count; i += 4)
+		{
+			const __m256 v0 = _mm256_loadu_ps(&in[i].x);
+			const __m256 v1 = _mm256_loadu_ps(&in[i + 2].x);
+			__m256 r0 = _mm256_mul_ps(c0, _mm256_permute_ps(v0, 0x00));
+			__m256 r1 = _mm256_mul_ps(c0, _mm256_permute_ps(v1, 0x00));
+			r0 = _mm256_fmadd_ps(c1, _mm256_permute_ps(v0, 0x55), r0);
+			r1 = _mm256_fmadd_ps(c1, _mm256_permute_ps(v1, 0x55), r1);
+			r0 = _mm256_fmadd_ps(c2, _mm256_permute_ps(v0, 0xAA), r0);
+			r1 = _mm256_fmadd_ps(c2, _mm256_permute_ps(v1, 0xAA), r1);
+			r0 = _mm256_fmadd_ps(c3, _mm256_permute_ps(v0, 0xFF), r0);
+			r1 = _mm256_fmadd_ps(c3, _mm256_permute_ps(v1, 0xFF), r1);
+			_mm256_storeu_ps(&out[i].x, r0);
+			_mm256_storeu_ps(&out[i + 2].x, r1);
+		}
+		Vec4SSE2(m, in + i, out + i, count - i);
+	}
+
+	PT_TARGET("avx2,fma") void Vec3To4AVX2(const glm::mat4& m, const glm::vec3* in, glm::vec4* out, size_t count)
+	{
+		const float* src = &in[0].x;
+		size_t i = 0;
+		for (; i + 8 <= count; i += 8, src += 24)
+		{
+			__m128 x0, y0, z0, x1, y1, z1;
+			Deinterleave3(_mm_loadu_ps(src), _mm_loadu_ps(src + 4), _mm_loadu_ps(src + 8), x0, y0, z0);
+			Deinterleave3(_mm_loadu_ps(src + 12), _mm_loadu_ps(src + 16), _mm_loadu_ps(src + 20), x1, y1, z1);
+			const __m256 x = Combine(x0, x1), y = Combine(y0, y1), z = Combine(z0, z1);
+
+			const __m256 rx = Row8(m, 0, x, y, z);
+			const __m256 ry = Row8(m, 1, x, y, z);
+			const __m256 rz = Row8(m, 2, x, y, z);
+			const __m256 rw = Row8(m, 3, x, y, z);
+			for (int half = 0; half < 2; half++)
+			{
+				__m128 ox = half ? _mm256_extractf128_ps(rx, 1) : _mm256_castps256_ps128(rx);
+				__m128 oy = half ? _mm256_extractf128_ps(ry, 1) : _mm256_castps256_ps128(ry);
+				__m128 oz = half ? _mm256_extractf128_ps(rz, 1) : _mm256_castps256_ps128(rz);
+				__m128 ow = half ? _mm256_extractf128_ps(rw, 1) : _mm256_castps256_ps128(rw);
+				_MM_TRANSPOSE4_PS(ox, oy, oz, ow);
+				glm::vec4* dst = out + i + half * 4;
+				_mm_storeu_ps(&dst[0].x, ox);
+				_mm_storeu_ps(&dst[1].x, oy);
+				_mm_storeu_ps(&dst[2].x, oz);
+				_mm_storeu_ps(&dst[3].x, ow);
+			}
+		}
+		Vec3To4SSE2(m, in + i, out + i, count - i);
+	}
+
+	PT_TARGET("avx2,fma") void Vec3AVX2(const glm::mat4& m, const glm::vec3* in, glm::vec3* out, size_t count)
+	{
+		const float* src = &in[0].x;
+		float* dst = &out[0].x;
+		size_t i = 0;
+		for (; i + 8 <= count; i += 8, src += 24, dst += 24)
+		{
+			__m128 x0, y0, z0, x1, y1, z1;
+			Deinterleave3(_mm_loadu_ps(src), _mm_loadu_ps(src + 4), _mm_loadu_ps(src + 8), x0, y0, z0);
+			Deinterleave3(_mm_loadu_ps(src + 12), _mm_loadu_ps(src + 16), _mm_loadu_ps(src + 20), x1, y1, z1);
+			const __m256 x = Combine(x0, x1), y = Combine(y0, y1), z = Combine(z0, z1);
+
+			const __m256 rx = Row8(m, 0, x, y, z);
+			const __m256 ry = Row8(m, 1, x, y, z);
+			const __m256 rz = Row8(m, 2, x, y, z);
+
+			__m128 a, b, c;
+			Interleave3(_mm256_castps256_ps128(rx), _mm256_castps256_ps128(ry), _mm256_castps256_ps128(rz), a, b, c);
+			_mm_storeu_ps(dst, a);
+			_mm_storeu_ps(dst + 4, b);
+			_mm_storeu_ps(dst + 8, c);
+			Interleave3(_mm256_extractf128_ps(rx, 1), _mm256_extractf128_ps(ry, 1), _mm256_extractf128_ps(rz, 1), a, b, c);
+			_mm_storeu_ps(dst + 12, a);
+			_mm_storeu_ps(dst + 16, b);
+			_mm_storeu_ps(dst + 20, c);
+		}
+		Vec3SSE2(m, in + i, out + i, count - i);
+	}
+
+	PT_TARGET("avx2,fma") void SoAAVX2(const glm::mat4& m, const SoAStreams& s, size_t begin, size_t end)
+	{
+		size_t i = begin;
+		for (; i + 8 <= end; i += 8)
+		{
+			const __m256 x = _mm256_loadu_ps(s.x + i);
+			const __m256 y = _mm256_loadu_ps(s.y + i);
+			const __m256 z = _mm256_loadu_ps(s.z + i);
+			const __m256 rx = Row8(m, 0, x, y, z);
+			const __m256 ry = Row8(m, 1, x, y, z);
+			const __m256 rz = Row8(m, 2, x, y, z);
+			if (s.outW)
+				_mm256_storeu_ps(s.outW + i, Row8(m, 3, x, y, z));
+			_mm256_storeu_ps(s.outX + i, rx);
+			_mm256_storeu_ps(s.outY + i, ry);
+			_mm256_storeu_ps(s.outZ + i, rz);
+		}
+		SoASSE2(m, s, i, end);
+	}
+
+	PT_TARGET("avx2,fma") inline void LoadQuats8(const glm::quat* q, __m256& x, __m256& y, __m256& z, __m256& w)
+	{
+		__m128 x0, y0, z0, w0, x1, y1, z1, w1;
+		LoadQuats4(q, x0, y0, z0, w0);
+		LoadQuats4(q + 4, x1, y1, z1, w1);
+		x = Combine(x0, x1);
+		y = Combine(y0, y1);
+		z = Combine(z0, z1);
+		w = Combine(w0, w1);
+	}
+
+	PT_TARGET("avx2,fma") inline void StoreQuats8(glm::quat* q, __m256 x, __m256 y, __m256 z, __m256 w)
+	{
+		StoreQuats4(q, _mm256_castps256_ps128(x), _mm256_castps256_ps128(y), _mm256_castps256_ps128(z), _mm256_castps256_ps128(w));
+		StoreQuats4(q + 4, _mm256_extractf128_ps(x, 1), _mm256_extractf128_ps(y, 1), _mm256_extractf128_ps(z, 1), _mm256_extractf128_ps(w, 1));
+	}
+
+	PT_TARGET("avx2,fma") void QuatMulAVX2(const glm::quat* a, const glm::quat* b, glm::quat* out, size_t count)
+	{
+		size_t i = 0;
+		for (; i + 8 <= count; i += 8)
+		{
+			__m256 px, py, pz, pw, qx, qy, qz, qw;
+			LoadQuats8(a + i, px, py, pz, pw);
+			LoadQuats8(b + i, qx, qy, qz, qw);
+
+			const __m256 w = _mm256_fmsub_ps(pw, qw, _mm256_fmadd_ps(px, qx, _mm256_fmadd_ps(py, qy, _mm256_mul_ps(pz, qz))));
+			const __m256 x = _mm256_fmadd_ps(pw, qx, _mm256_fmadd_ps(px, qw, _mm256_fmsub_ps(py, qz, _mm256_mul_ps(pz, qy))));
+			const __m256 y = _mm256_fmadd_ps(pw, qy, _mm256_fmadd_ps(py, qw, _mm256_fmsub_ps(pz, qx, _mm256_mul_ps(px, qz))));
+			const __m256 z = _mm256_fmadd_ps(pw, qz, _mm256_fmadd_ps(pz, qw, _mm256_fmsub_ps(px, qy, _mm256_mul_ps(py, qx))));
+			StoreQuats8(out + i, x, y, z, w);
+		}
+		QuatMulSSE2(a + i, b + i, out + i, count - i);
+	}
+
+	PT_TARGET("avx2,fma") void QuatSlerpAVX2(const glm::quat* a, const glm::quat* b, const float* t, float tConst, glm::quat* out, size_t count)
+	{
+		const __m256 one = _mm256_set1_ps(1.0f);
+		const __m256 signBit = _mm256_set1_ps(-0.0f);
+
+		size_t i = 0;
+		for (; i + 8 <= count; i += 8)
+		{
+			__m256 px, py, pz, pw, qx, qy, qz, qw;
+			LoadQuats8(a + i, px, py, pz, pw);
+			LoadQuats8(b + i, qx, qy, qz, qw);
+
+			const __m256 dot = _mm256_fmadd_ps(px, qx, _mm256_fmadd_ps(py, qy, _mm256_fmadd_ps(pz, qz, _mm256_mul_ps(pw, qw))));
+			const __m256 sign = _mm256_and_ps(dot, signBit);
+			const __m256 xm1 = _mm256_sub_ps(_mm256_andnot_ps(signBit, dot), one);
+
+			const __m256 vt = t ? _mm256_loadu_ps(t + i) : _mm256_set1_ps(tConst);
+			const __m256 vd = _mm256_sub_ps(one, vt);
+			const __m256 tt = _mm256_mul_ps(vt, vt);
+			const __m256 dd = _mm256_mul_ps(vd, vd);
+			__m256 cT = one, cD = one;
+			for (int k = SLERP_TERMS - 1; k >= 0; k--)
+			{
+				const __m256 u = _mm256_set1_ps(SLERP_U[k]);
+				const __m256 v = _mm256_set1_ps(SLERP_V[k]);
+				cT = _mm256_fmadd_ps(_mm256_mul_ps(_mm256_fmsub_ps(u, tt, v), xm1), cT, one);
+				cD = _mm256_fmadd_ps(_mm256_mul_ps(_mm256_fmsub_ps(u, dd, v), xm1), cD, one);
+			}
+			cT = _mm256_xor_ps(_mm256_mul_ps(cT, vt), sign);
+			cD = _mm256_mul_ps(cD, vd);
+
+			StoreQuats8(out + i,
+				_mm256_fmadd_ps(px, cD, _mm256_mul_ps(qx, cT)),
+				_mm256_fmadd_ps(py, cD, _mm256_mul_ps(qy, cT)),
+				_mm256_fmadd_ps(pz, cD, _mm256_mul_ps(qz, cT)),
+				_mm256_fmadd_ps(pw, cD, _mm256_mul_ps(qw, cT)));
+		}
+		QuatSlerpSSE2(a + i, b + i, t ? t + i : NULL, tConst, out + i, count - i);
+	}
+
+	// ---------------------------------------------------------------- AVX-512F
+
+	PT_TARGET("avx512f") inline __m512 Row16(const glm::mat4& m, int row, __m512 x, __m512 y, __m512 z)
+	{
+		__m512 r = _mm512_fmadd_ps(_mm512_set1_ps(m[0][row]), x, _mm512_set1_ps(m[3][row]));
+		r = _mm512_fmadd_ps(_mm512_set1_ps(m[1][row]), y, r);
+		return _mm512_fmadd_ps(_mm512_set1_ps(m[2][row]), z, r);
+	}
+
+	PT_TARGET("avx512f") void Vec4AVX512(const glm::mat4& m, const glm::vec4* in, glm::vec4* out, size_t count)
+	{
+		// four points per register
+		const __m512 c0 = _mm512_broadcast_f32x4(_mm_loadu_ps(&m[0][0]));
+		const __m512 c1 = _mm512_broadcast_f32x4(_mm_loadu_ps(&m[1][0]));
+		const __m512 c2 = _mm512_broadcast_f32x4(_mm_loadu_ps(&m[2][0]));
+		const __m512 c3 = _mm512_broadcast_f32x4(_mm_loadu_ps(&m[3][0]));
+
+		size_t i = 0;
+		for (; i + 8 <= count; i += 8)
+		{
+			const __m512 v0 = _mm512_loadu_ps(&in[i].x);
+			const __m512 v1 = _mm512_loadu_ps(&in[i + 4].x);
+			__m512 r0 = _mm512_mul_ps(c0, _mm512_permute_ps(v0, 0x00));
+			__m512 r1 = _mm512_mul_ps(c0, _mm512_permute_ps(v1, 0x00));
+			r0 = _mm512_fmadd_ps(c1, _mm512_permute_ps(v0, 0x55), r0);
+			r1 = _mm512_fmadd_ps(c1, _mm512_permute_ps(v1, 0x55), r1);
+			r0 = _mm512_fmadd_ps(c2, _mm512_permute_ps(v0, 0xAA), r0);
+			r1 = _mm512_fmadd_ps(c2, _mm512_permute_ps(v1, 0xAA), r1);
+			r0 = _mm512_fmadd_ps(c3, _mm512_permute_ps(v0, 0xFF), r0);
+			r1 = _mm512_fmadd_ps(c3, _mm512_permute_ps(v1, 0xFF), r1);
+			_mm512_storeu_ps(&out[i].x, r0);
+			_mm512_storeu_ps(&out[i + 4].x, r1);
+		}
+		Vec4AVX2(m, in + i, out + i, count - i);
+	}
+
+	PT_TARGET("avx512f") void SoAAVX512(const glm::mat4& m, const SoAStreams& s, size_t begin, size_t end)
+	{
+		// masked loads and stores handle the tail, no scalar remainder loop
+		for (size_t i = begin; i < end; i += 16)
+		{
+			const __mmask16 mask = (end - i >= 16) ? (__mmask16)0xFFFF : (__mmask16)((1u << (end - i)) - 1);
+			const __m512 x = _mm512_maskz_loadu_ps(mask, s.x + i);
+			const __m512 y = _mm512_maskz_loadu_ps(mask, s.y + i);
+			const __m512 z = _mm512_maskz_loadu_ps(mask, s.z + i);
+			const __m512 rx = Row16(m, 0, x, y, z);
+			const __m512 ry = Row16(m, 1, x, y, z);
+			const __m512 rz = Row16(m, 2, x, y, z);
+			if (s.outW)
+				_mm512_mask_storeu_ps(s.outW + i, mask, Row16(m, 3, x, y, z));
+			_mm512_mask_storeu_ps(s.outX + i, mask, rx);
+			_mm512_mask_storeu_ps(s.outY + i, mask, ry);
+			_mm512_mask_storeu_ps(s.outZ + i, mask, rz);
+		}
+	}
+#endif
+
+	// ---------------------------------------------------------------- dispatch
+
+	struct Kernels
+	{
+		Vec4Kernel vec4;
+		Vec3To4Kernel vec3To4;
+		Vec3Kernel vec3;
+		SoAKernel soa;
+		QuatMulKernel quatMul;
+		QuatSlerpKernel quatSlerp;
+	};
+
+	Kernels KernelsFor(SimdLevel level)
+	{
+		Kernels k = { Vec4Scalar, Vec3To4Scalar, Vec3Scalar, SoAScalar, QuatMulScalar, QuatSlerpScalar };
+#if PT_X86
+		switch (level)
+		{
+		case SimdLevel::AVX512:
+			// vec3 AoS and quaternions gain nothing from 512 bit registers over the shuffle-bound AVX2 path
+			k.vec4 = Vec4AVX512; k.vec3To4 = Vec3To4AVX2; k.vec3 = Vec3AVX2; k.soa = SoAAVX512;
+			k.quatMul = QuatMulAVX2; k.quatSlerp = QuatSlerpAVX2;
+			break;
+		case SimdLevel::AVX2:
+			k.vec4 = Vec4AVX2; k.vec3To4 = Vec3To4AVX2; k.vec3 = Vec3AVX2; k.soa = SoAAVX2;
+			k.quatMul = QuatMulAVX2; k.quatSlerp = QuatSlerpAVX2;
+			break;
+		case SimdLevel::SSE2:
+			k.vec4 = Vec4SSE2; k.vec3To4 = Vec3To4SSE2; k.vec3 = Vec3SSE2; k.soa = SoASSE2;
+			k.quatMul = QuatMulSSE2; k.quatSlerp = QuatSlerpSSE2;
+			break;
+		case SimdLevel::Scalar:
+			break;
+		}
+#endif
+		return k;
+	}
+
+	SimdLevel activeLevel = DetectSimdLevel();
+	Kernels active = KernelsFor(activeLevel);
+
+	// run body(begin, end) over [0, count), in parallel chunks for large batches
+	template <typename Body>
+	void ForChunks(size_t count, const Body& body)
+	{
+		if (count < PARALLEL_THRESHOLD)
+		{
+			body(0, count);
+			return;
+		}
+
+		const size_t CHUNK = 8192;
+		const int chunks = (int)((count + CHUNK - 1) / CHUNK);
+		cv::parallel_for_(cv::Range(0, chunks), [&](const cv::Range& range)
+		{
+			const size_t begin = (size_t)range.start * CHUNK;
+			const size_t end = std::min(count, (size_t)range.end * CHUNK);
+			body(begin, end);
+		});
+	}
+}
+
+SimdLevel DetectSimdLevel()
+{
+#if PT_X86
+	if (cv::checkHardwareSupport(CV_CPU_AVX_512F))
+		return SimdLevel::AVX512;
+	if (cv::checkHardwareSupport(CV_CPU_AVX2) && cv::checkHardwareSupport(CV_CPU_FMA3))
+		return SimdLevel::AVX2;
+	if (cv::checkHardwareSupport(CV_CPU_SSE2))
+		return SimdLevel::SSE2;
+#endif
+	return SimdLevel::Scalar;
+}
+
+void SetSimdLevel(SimdLevel level)
+{
+	activeLevel = std::min(level, DetectSimdLevel());
+	active = KernelsFor(activeLevel);
+}
+
+SimdLevel GetSimdLevel()
+{
+	return activeLevel;
+}
+
+void TransformPoints(const glm::mat4& m, const glm::vec4* in, glm::vec4* out, size_t count)
+{
+	const Vec4Kernel kernel = active.vec4;
+	ForChunks(count, [&](size_t begin, size_t end) { kernel(m, in + begin, out + begin, end - begin); });
+}
+
+void TransformPoints(const glm::mat4& m, const glm::vec3* in, glm::vec4* out, size_t count)
+{
+	const Vec3To4Kernel kernel = active.vec3To4;
+	ForChunks(count, [&](size_t begin, size_t end) { kernel(m, in + begin, out + begin, end - begin); });
+}
+
+void TransformPoints(const glm::mat4& m, const glm::vec3* in, glm::vec3* out, size_t count)
+{
+	const Vec3Kernel kernel = active.vec3;
+	ForChunks(count, [&](size_t begin, size_t end) { kernel(m, in + begin, out + begin, end - begin); });
+}
+
+void MultiplyMatrices(const glm::mat4& m, const glm::mat4* in, glm::mat4* out, size_t count)
+{
+	// column j of m * in[i] is m * in[i][j]: a point transform over all columns
+	static_assert(sizeof(glm::mat4) == 4 * sizeof(glm::vec4), "mat4 columns are not packed");
+	TransformPoints(m, (const glm::vec4*)in, (glm::vec4*)out, count * 4);
+}
+
+void TransformPointsSoA(const glm::mat4& m,
+	const float* x, const float* y, const float* z,
+	float* outX, float* outY, float* outZ, float* outW, size_t count)
+{
+	const SoAStreams streams = { x, y, z, outX, outY, outZ, outW };
+	const SoAKernel kernel = active.soa;
+	ForChunks(count, [&](size_t begin, size_t end) { kernel(m, streams, begin, end); });
+}
+
+void MultiplyQuats(const glm::quat* a, const glm::quat* b, glm::quat* out, size_t count)
+{
+	const QuatMulKernel kernel = active.quatMul;
+	ForChunks(count, [&](size_t begin, size_t end) { kernel(a + begin, b + begin, out + begin, end - begin); });
+}
+
+void SlerpQuats(const glm::quat* a, const glm::quat* b, const float* t, glm::quat* out, size_t count)
+{
+	const QuatSlerpKernel kernel = active.quatSlerp;
+	ForChunks(count, [&](size_t begin, size_t end) { kernel(a + begin, b + begin, t + begin, 0.0f, out + begin, end - begin); });
+}
+
+void SlerpQuats(const glm::quat* a, const glm::quat* b, float t, glm::quat* out, size_t count)
+{
+	const QuatSlerpKernel kernel = active.quatSlerp;
+	ForChunks(count, [&](size_t begin, size_t end) { kernel(a + begin, b + begin, NULL, t, out + begin, end - begin); });
+}
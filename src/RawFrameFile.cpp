@@ -0,0 +1,259 @@
+#include "RawFrameFile.h"
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+#if defined(_WIN32)
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+static const char RAW_MAGIC[4] = { 'R', 'A', 'W', 'F' };
+static const uint32_t RAW_VERSION = 1;
+
+// ---------------------------------------------------------------- writer
+
+RawFrameWriter::RawFrameWriter()
+	: file(NULL), offset(0)
+{
+	memset(&header, 0, sizeof(header));
+}
+
+RawFrameWriter::~RawFrameWriter()
+{
+	Close();
+}
+
+bool RawFrameWriter::IsRawPath(const std::string& path)
+{
+	return path.size() >= 5 && path.compare(path.size() - 5, 5, ".rawf") == 0;
+}
+
+bool RawFrameWriter::Open(const std::string& path, cv::Size size, int type, double fps)
+{
+	Close();
+
+	file = fopen(path.c_str(), "wb");
+	if (file == NULL)
+	{
+		std::cout << "Failed to create " << path << std::endl;
+		return false;
+	}
+
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, RAW_MAGIC, sizeof(RAW_MAGIC));
+	header.version = RAW_VERSION;
+	header.width = size.width;
+	header.height = size.height;
+	header.type = type;
+	header.fps = fps;
+	index.clear();
+
+	// the header is rewritten with the index position on Close
+	offset = 0;
+	if (fwrite(&header, sizeof(header), 1, file) != 1)
+	{
+		fclose(file);
+		file = NULL;
+		return false;
+	}
+	offset = sizeof(header);
+	return true;
+}
+
+bool RawFrameWriter::Pad(uint64_t to)
+{
+	static const unsigned char zeros[FRAME_ALIGNMENT] = { 0 };
+	while (offset < to)
+	{
+		const size_t n = (size_t)std::min<uint64_t>(to - offset, sizeof(zeros));
+		if (fwrite(zeros, 1, n, file) != n)
+			return false;
+		offset += n;
+	}
+	return true;
+}
+
+bool RawFrameWriter::Write(const cv::Mat& frame, double timestamp)
+{
+	if (file == NULL || frame.cols != header.width || frame.rows != header.height || frame.type() != header.type)
+		return false;
+
+	if (!Pad((offset + FRAME_ALIGNMENT - 1) / FRAME_ALIGNMENT * FRAME_ALIGNMENT))
+		return false;
+
+	RawFrameIndexEntry entry;
+	entry.offset = offset;
+	entry.timestamp = timestamp;
+
+	const size_t rowBytes = frame.cols * frame.elemSize();
+	if (frame.isContinuous())
+	{
+		if (fwrite(frame.data, 1, rowBytes * frame.rows, file) != rowBytes * frame.rows)
+			return false;
+	}
+	else
+	{
+		for (int y = 0; y < frame.rows; y++)
+		{
+			if (fwrite(frame.ptr(y), 1, rowBytes, file) != rowBytes)
+				return false;
+		}
+	}
+	offset += (uint64_t)rowBytes * frame.rows;
+	index.push_back(entry);
+	return true;
+}
+
+bool RawFrameWriter::Close()
+{
+	if (file == NULL)
+		return true;
+
+	bool ok = Pad((offset + 7) / 8 * 8);
+	header.frameCount = index.size();
+	header.indexOffset = offset;
+	if (ok && !index.empty())
+		ok = fwrite(index.data(), sizeof(RawFrameIndexEntry), index.size(), file) == index.size();
+	ok = ok && fseek(file, 0, SEEK_SET) == 0 && fwrite(&header, sizeof(header), 1, file) == 1;
+	ok = (fclose(file) == 0) && ok;
+
+	file = NULL;
+	index.clear();
+	if (!ok)
+		std::cout << "Failed to finish raw frame file" << std::endl;
+	return ok;
+}
+
+// ---------------------------------------------------------------- reader
+
+RawFrameReader::RawFrameReader()
+	: mapped(NULL), mappedSize(0), mapping(NULL), index(NULL)
+{
+	memset(&header, 0, sizeof(header));
+}
+
+RawFrameReader::~RawFrameReader()
+{
+	Close();
+}
+
+bool RawFrameReader::Map(const std::string& path)
+{
+#if defined(_WIN32)
+	HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+	if (file == INVALID_HANDLE_VALUE)
+		return false;
+	LARGE_INTEGER size;
+	if (!GetFileSizeEx(file, &size) || size.QuadPart == 0)
+	{
+		CloseHandle(file);
+		return false;
+	}
+
+	// copy-on-write: frames may be modified in memory without touching the file
+	HANDLE handle = CreateFileMappingA(file, NULL, PAGE_WRITECOPY, 0, 0, NULL);
+	CloseHandle(file);
+	if (handle == NULL)
+		return false;
+	void* view = MapViewOfFile(handle, FILE_MAP_COPY, 0, 0, 0);
+	if (view == NULL)
+	{
+		CloseHandle(handle);
+		return false;
+	}
+	mapping = handle;
+	mapped = (unsigned char*)view;
+	mappedSize = (uint64_t)size.QuadPart;
+#else
+	const int fd = open(path.c_str(), O_RDONLY);
+	if (fd < 0)
+		return false;
+	struct stat info;
+	if (fstat(fd, &info) != 0 || info.st_size == 0)
+	{
+		close(fd);
+		return false;
+	}
+
+	// copy-on-write: frames may be modified in memory without touching the file
+	void* view = mmap(NULL, (size_t)info.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (view == MAP_FAILED)
+		return false;
+	madvise(view, (size_t)info.st_size, MADV_SEQUENTIAL);
+	mapped = (unsigned char*)view;
+	mappedSize = (uint64_t)info.st_size;
+#endif
+	return true;
+}
+
+void RawFrameReader::Unmap()
+{
+	if (mapped == NULL)
+		return;
+#if defined(_WIN32)
+	UnmapViewOfFile(mapped);
+	CloseHandle((HANDLE)mapping);
+#else
+	munmap(mapped, (size_t)mappedSize);
+#endif
+	mapped = NULL;
+	mapping = NULL;
+	mappedSize = 0;
+}
+
+bool RawFrameReader::Open(const std::string& path)
+{
+	Close();
+	if (!Map(path))
+	{
+		std::cout << "Failed to map " << path << std::endl;
+		return false;
+	}
+
+	bool valid = mappedSize >= sizeof(header);
+	if (valid)
+	{
+		memcpy(&header, mapped, sizeof(header));
+		valid = memcmp(header.magic, RAW_MAGIC, sizeof(RAW_MAGIC)) == 0 && header.version == RAW_VERSION &&
+			header.width > 0 && header.height > 0 && header.indexOffset != 0 &&
+			header.indexOffset <= mappedSize && header.frameCount <= (mappedSize - header.indexOffset) / sizeof(RawFrameIndexEntry);
+	}
+
+	// every frame must lie completely inside the file
+	const uint64_t frameBytes = (uint64_t)header.width * header.height * CV_ELEM_SIZE(header.type);
+	if (valid)
+	{
+		index = (const RawFrameIndexEntry*)(mapped + header.indexOffset);
+		for (uint64_t i = 0; i < header.frameCount && valid; i++)
+			valid = index[i].offset + frameBytes <= header.indexOffset;
+	}
+
+	if (!valid)
+	{
+		std::cout << path << " is not a complete raw frame file" << std::endl;
+		Close();
+		return false;
+	}
+	return true;
+}
+
+void RawFrameReader::Close()
+{
+	Unmap();
+	index = NULL;
+	memset(&header, 0, sizeof(header));
+}
+
+cv::Mat RawFrameReader::Frame(int i) const
+{
+	CV_Assert(i >= 0 && i < Count());
+	return cv::Mat(header.height, header.width, header.type, mapped + index[i].offset);
+}
@@ -0,0 +1,111 @@
+#include "RenderQueue.h"
+
+#include <algorithm>
+
+#include "Trace.h"
+
+RenderQueue::RenderQueue()
+	: nextJob(0), finishedJobs(0), stopping(false), peakBytes(0)
+{
+}
+
+RenderQueue::~RenderQueue()
+{
+	Stop();
+}
+
+void RenderQueue::Start(int count)
+{
+	Stop();
+	stopping = false;
+	for (int i = 0; i < count; i++)
+		workers.push_back(std::thread(&RenderQueue::Run, this));
+}
+
+void RenderQueue::Stop()
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		stopping = true;
+	}
+	wake.notify_all();
+	for (size_t i = 0; i < workers.size(); i++)
+		workers[i].join();
+	workers.clear();
+
+	// anything recorded but never submitted is dropped
+	jobs.clear();
+	nextJob = finishedJobs = 0;
+}
+
+void RenderQueue::Record(const std::function<void(CommandBuffer&)>& job)
+{
+	std::unique_lock<std::mutex> lock(mutex);
+	const size_t index = jobs.size();
+	if (buffers.size() <= index)
+		buffers.emplace_back(new CommandBuffer());
+	CommandBuffer* buffer = buffers[index].get();
+	buffer->Clear();
+	jobs.push_back(job);
+
+	if (workers.empty())
+	{
+		lock.unlock();
+		TRACE_ZONE("Record");
+		job(*buffer);
+		lock.lock();
+		nextJob++;
+		finishedJobs++;
+		return;
+	}
+	wake.notify_one();
+}
+
+void RenderQueue::Submit()
+{
+	TRACE_ZONE("Submit");
+	std::unique_lock<std::mutex> lock(mutex);
+	done.wait(lock, [this]() { return finishedJobs == jobs.size(); });
+	const size_t count = jobs.size();
+	jobs.clear();
+	nextJob = finishedJobs = 0;
+	lock.unlock();
+
+	// buffers [0, count) are only touched by this thread until the next Record
+	size_t bytes = 0;
+	replayer.Begin();
+	for (size_t i = 0; i < count; i++)
+	{
+		replayer.Replay(*buffers[i]);
+		bytes += buffers[i]->Bytes();
+	}
+	peakBytes = std::max(peakBytes, bytes);
+}
+
+void RenderQueue::Run()
+{
+	Trace::SetThreadName("Render worker");
+
+	std::unique_lock<std::mutex> lock(mutex);
+	for (;;)
+	{
+		wake.wait(lock, [this]() { return nextJob < jobs.size() || stopping; });
+		if (stopping)
+			break;
+
+		// the job is copied: Record may grow 'jobs' while this one runs
+		const size_t index = nextJob++;
+		const std::function<void(CommandBuffer&)> job = jobs[index];
+		CommandBuffer* buffer = buffers[index].get();
+		lock.unlock();
+
+		{
+			TRACE_ZONE("Record");
+			job(*buffer);
+		}
+
+		lock.lock();
+		if (++finishedJobs == jobs.size())
+			done.notify_one();
+	}
+}
@@ -0,0 +1,66 @@
+#include "RenderTarget.h"
+
+#include <iostream>
+
+RenderTarget::RenderTarget()
+	: fbo(0), color(0), depth(0), width(0), height(0)
+{
+}
+
+RenderTarget::~RenderTarget()
+{
+	Release();
+}
+
+bool RenderTarget::Create(int width, int height)
+{
+	Release();
+	this->width = width;
+	this->height = height;
+
+	glGenRenderbuffers(1, &color);
+	glBindRenderbuffer(GL_RENDERBUFFER, color);
+	glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, width, height);
+
+	glGenRenderbuffers(1, &depth);
+	glBindRenderbuffer(GL_RENDERBUFFER, depth);
+	glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, width, height);
+	glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+	glGenFramebuffers(1, &fbo);
+	glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+	glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, color);
+	glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, depth);
+
+	const GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+	glBindFramebuffer(GL_FRAMEBUFFER, 0);
+	if (status != GL_FRAMEBUFFER_COMPLETE)
+	{
+		std::cout << "Offscreen framebuffer incomplete: 0x" << std::hex << status << std::dec << std::endl;
+		Release();
+		return false;
+	}
+	return true;
+}
+
+void RenderTarget::Release()
+{
+	if (fbo != 0)
+		glDeleteFramebuffers(1, &fbo);
+	if (color != 0)
+		glDeleteRenderbuffers(1, &color);
+	if (depth != 0)
+		glDeleteRenderbuffers(1, &depth);
+	fbo = color = depth = 0;
+}
+
+void RenderTarget::Bind() const
+{
+	glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+	glViewport(0, 0, width, height);
+}
+
+void RenderTarget::BindDefault()
+{
+	glBindFramebuffer(GL_FRAMEBUFFER, 0);
+}
@@ -0,0 +1,112 @@
+#include "Shader.h"
+
+#include <glm/gtc/type_ptr.hpp>
+
+#include <iostream>
+
+Shader::Shader()
+	: ID(0)
+{
+}
+
+Shader::~Shader()
+{
+	Release();
+}
+
+bool Shader::Build(const char* vertexSource, const char* fragmentSource)
+{
+	Release();
+	ID = Link(vertexSource, fragmentSource, false);
+	return ID != 0;
+}
+
+void Shader::Adopt(GLuint program)
+{
+	Release();
+	ID = program;
+}
+
+GLuint Shader::Link(const char* vertexSource, const char* fragmentSource, bool retrievable)
+{
+	GLuint vertex = CompileStage(GL_VERTEX_SHADER, vertexSource);
+	GLuint fragment = CompileStage(GL_FRAGMENT_SHADER, fragmentSource);
+	if (vertex == 0 || fragment == 0)
+	{
+		glDeleteShader(vertex);
+		glDeleteShader(fragment);
+		return 0;
+	}
+
+	GLuint program = glCreateProgram();
+	if (retrievable)
+		glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+	glAttachShader(program, vertex);
+	glAttachShader(program, fragment);
+	glLinkProgram(program);
+
+	// shaders are no longer needed once linked
+	glDeleteShader(vertex);
+	glDeleteShader(fragment);
+
+	GLint success = 0;
+	glGetProgramiv(program, GL_LINK_STATUS, &success);
+	if (!success)
+	{
+		char infoLog[1024];
+		glGetProgramInfoLog(program, sizeof(infoLog), NULL, infoLog);
+		std::cout << "Failed to link shader program\n" << infoLog << std::endl;
+		glDeleteProgram(program);
+		return 0;
+	}
+	return program;
+}
+
+void Shader::Release()
+{
+	if (ID != 0)
+	{
+		glDeleteProgram(ID);
+		ID = 0;
+	}
+}
+
+void Shader::SetInt(const std::string& name, int value) const
+{
+	glUniform1i(glGetUniformLocation(ID, name.c_str()), value);
+}
+
+void Shader::SetFloat(const std::string& name, float value) const
+{
+	glUniform1f(glGetUniformLocation(ID, name.c_str()), value);
+}
+
+void Shader::SetVec2(const std::string& name, const glm::vec2& value) const
+{
+	glUniform2fv(glGetUniformLocation(ID, name.c_str()), 1, glm::value_ptr(value));
+}
+
+void Shader::SetMat4(const std::string& name, const glm::mat4& value) const
+{
+	glUniformMatrix4fv(glGetUniformLocation(ID, name.c_str()), 1, GL_FALSE, glm::value_ptr(value));
+}
+
+GLuint Shader::CompileStage(GLenum type, const char* source)
+{
+	GLuint shader = glCreateShader(type);
+	glShaderSource(shader, 1, &source, NULL);
+	glCompileShader(shader);
+
+	GLint success = 0;
+	glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+	if (!success)
+	{
+		char infoLog[1024];
+		glGetShaderInfoLog(shader, sizeof(infoLog), NULL, infoLog);
+		std::cout << "Failed to compile " << (type == GL_VERTEX_SHADER ? "vertex" : "fragment")
+			<< " shader\n" << infoLog << std::endl;
+		glDeleteShader(shader);
+		return 0;
+	}
+	return shader;
+}
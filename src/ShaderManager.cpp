@@ -0,0 +1,279 @@
+#include "ShaderManager.h"
+
+#include <opencv2/core/utility.hpp>
+
+#include <cstring>
+#include <iostream>
+
+#include "FileCache.h"
+#include "Trace.h"
+
+static const char PROGRAM_MAGIC[4] = { 'P', 'R', 'G', 'B' };
+static const uint32_t PROGRAM_VERSION = 1;
+
+struct ProgramHeader
+{
+	char magic[4];
+	uint32_t version;
+	uint32_t format;
+	uint32_t length;
+};
+
+ShaderManager::ShaderManager()
+	: binarySupported(false), driverKey(0), compileWindow(NULL), inFlight(0), stopping(false),
+	cacheHits(0), cacheMisses(0), backgroundBuilds(0), loadMs(0.0)
+{
+}
+
+ShaderManager::~ShaderManager()
+{
+	// the compile thread and its window must be gone before the main context is
+	CV_DbgAssert(!worker.joinable());
+}
+
+void ShaderManager::Init(GLFWwindow* shareWindow, const std::string& cacheDirectory)
+{
+	Release();
+
+	// program binaries are core since 4.1
+	GLint formats = 0;
+	if (GLAD_GL_VERSION_4_1 || gladHasExtension("GL_ARB_get_program_binary"))
+		glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+	binarySupported = formats > 0 && glGetProgramBinary != NULL && glProgramBinary != NULL;
+	if (!binarySupported)
+		std::cout << "Program binaries not supported, shaders are compiled on every start" << std::endl;
+
+	this->cacheDirectory = binarySupported ? cacheDirectory : std::string();
+	if (!this->cacheDirectory.empty() && !FileCache::EnsureDirectory(this->cacheDirectory))
+	{
+		std::cout << "Failed to create cache directory " << cacheDirectory << std::endl;
+		this->cacheDirectory.clear();
+	}
+
+	// a driver update changes at least one of these
+	const char* strings[3] = { (const char*)glGetString(GL_VENDOR), (const char*)glGetString(GL_RENDERER), (const char*)glGetString(GL_VERSION) };
+	driverKey = FileCache::Hash(&PROGRAM_VERSION, sizeof(PROGRAM_VERSION));
+	for (int i = 0; i < 3; i++)
+	{
+		if (strings[i] != NULL)
+			driverKey = FileCache::Hash(strings[i], strlen(strings[i]) + 1, driverKey);
+	}
+	driverKey = FileCache::Hash(&GLVersion, sizeof(GLVersion), driverKey);
+
+	if (shareWindow == NULL)
+		return;
+
+	// hidden 1x1 window with the same context version, sharing objects with the main one
+	glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+	glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+	glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+	glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+	compileWindow = glfwCreateWindow(1, 1, "HW1 shader compiler", NULL, shareWindow);
+	glfwDefaultWindowHints();
+	if (compileWindow == NULL)
+	{
+		std::cout << "Failed to create shared context, shaders are compiled on the main thread" << std::endl;
+		return;
+	}
+
+	// the lazy loader binds entry points on their first call, which must not happen
+	// on both threads at once: bind everything the compile thread calls up front
+	static const char* const WORKER_ENTRY_POINTS[] = {
+		"glCreateShader", "glShaderSource", "glCompileShader", "glGetShaderiv", "glGetShaderInfoLog", "glDeleteShader",
+		"glCreateProgram", "glProgramParameteri", "glAttachShader", "glLinkProgram", "glGetProgramiv", "glGetProgramInfoLog",
+		"glDeleteProgram", "glGetProgramBinary", "glFenceSync", "glFlush"
+	};
+	for (size_t i = 0; i < sizeof(WORKER_ENTRY_POINTS) / sizeof(WORKER_ENTRY_POINTS[0]); i++)
+		gladResolveLazy(WORKER_ENTRY_POINTS[i]);
+
+	stopping = false;
+	worker = std::thread(&ShaderManager::Run, this);
+}
+
+void ShaderManager::Release()
+{
+	if (worker.joinable())
+	{
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			stopping = true;
+			jobs.clear();
+		}
+		wake.notify_one();
+		worker.join();
+	}
+	if (compileWindow != NULL)
+	{
+		glfwDestroyWindow(compileWindow);
+		compileWindow = NULL;
+	}
+
+	// programs finished after the last Update never reach their Shader
+	for (size_t i = 0; i < results.size(); i++)
+	{
+		glDeleteSync(results[i].fence);
+		glDeleteProgram(results[i].program);
+	}
+	results.clear();
+	inFlight = 0;
+}
+
+uint64_t ShaderManager::Key(const char* vertexSource, const char* fragmentSource) const
+{
+	uint64_t key = FileCache::Hash(vertexSource, strlen(vertexSource) + 1, driverKey);
+	return FileCache::Hash(fragmentSource, strlen(fragmentSource) + 1, key);
+}
+
+GLuint ShaderManager::LoadBinary(uint64_t key)
+{
+	if (cacheDirectory.empty())
+		return 0;
+
+	std::vector<unsigned char> data;
+	ProgramHeader header;
+	if (!FileCache::Read(FileCache::EntryPath(cacheDirectory, "program", key, ".bin"), data) || data.size() < sizeof(header))
+		return 0;
+	memcpy(&header, data.data(), sizeof(header));
+	if (memcmp(header.magic, PROGRAM_MAGIC, sizeof(PROGRAM_MAGIC)) != 0 || header.version != PROGRAM_VERSION ||
+		data.size() != sizeof(header) + header.length)
+		return 0;
+
+	// the driver may still reject a binary, e.g. after an update that kept its version string
+	GLuint program = glCreateProgram();
+	glProgramBinary(program, header.format, data.data() + sizeof(header), (GLsizei)header.length);
+	GLint success = 0;
+	glGetProgramiv(program, GL_LINK_STATUS, &success);
+	if (!success)
+	{
+		glDeleteProgram(program);
+		return 0;
+	}
+	return program;
+}
+
+void ShaderManager::SaveBinary(uint64_t key, GLuint program)
+{
+	if (cacheDirectory.empty())
+		return;
+
+	GLint length = 0;
+	glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+	if (length <= 0)
+		return;
+
+	std::vector<unsigned char> data(sizeof(ProgramHeader) + length);
+	GLenum format = 0;
+	glGetProgramBinary(program, length, &length, &format, data.data() + sizeof(ProgramHeader));
+
+	ProgramHeader header;
+	memcpy(header.magic, PROGRAM_MAGIC, sizeof(PROGRAM_MAGIC));
+	header.version = PROGRAM_VERSION;
+	header.format = format;
+	header.length = (uint32_t)length;
+	memcpy(data.data(), &header, sizeof(header));
+	data.resize(sizeof(header) + length);
+
+	const std::string path = FileCache::EntryPath(cacheDirectory, "program", key, ".bin");
+	if (!FileCache::Write(path, data.data(), data.size()))
+		std::cout << "Failed to write " << path << std::endl;
+}
+
+bool ShaderManager::Build(Shader& shader, const char* vertexSource, const char* fragmentSource)
+{
+	shader.Release();
+	const uint64_t key = Key(vertexSource, fragmentSource);
+
+	const int64 start = cv::getTickCount();
+	const GLuint cached = LoadBinary(key);
+	if (cached != 0)
+	{
+		loadMs += (cv::getTickCount() - start) * 1000.0 / cv::getTickFrequency();
+		cacheHits++;
+		shader.Adopt(cached);
+		return true;
+	}
+	cacheMisses++;
+
+	if (!worker.joinable())
+	{
+		const GLuint program = Shader::Link(vertexSource, fragmentSource, !cacheDirectory.empty());
+		if (program == 0)
+			return false;
+		SaveBinary(key, program);
+		shader.Adopt(program);
+		return true;
+	}
+
+	Job job;
+	job.target = &shader;
+	job.vertexSource = vertexSource;
+	job.fragmentSource = fragmentSource;
+	job.key = key;
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		jobs.push_back(job);
+		inFlight++;
+	}
+	wake.notify_one();
+	return true;
+}
+
+void ShaderManager::Update()
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	for (size_t i = 0; i < results.size(); )
+	{
+		// the fence tells the program is complete as seen from this context too
+		const GLenum status = glClientWaitSync(results[i].fence, 0, 0);
+		if (status == GL_TIMEOUT_EXPIRED)
+		{
+			i++;
+			continue;
+		}
+		glDeleteSync(results[i].fence);
+		if (results[i].program != 0)
+			results[i].target->Adopt(results[i].program);
+		results.erase(results.begin() + i);
+		inFlight--;
+	}
+}
+
+bool ShaderManager::IsPending() const
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return inFlight > 0;
+}
+
+void ShaderManager::Run()
+{
+	Trace::SetThreadName("Shader compiler");
+	glfwMakeContextCurrent(compileWindow);
+
+	std::unique_lock<std::mutex> lock(mutex);
+	for (;;)
+	{
+		wake.wait(lock, [this]() { return !jobs.empty() || stopping; });
+		if (stopping)
+			break;
+
+		Job job = jobs.front();
+		jobs.pop_front();
+		lock.unlock();
+
+		TRACE_ZONE("Compile");
+		Result result;
+		result.target = job.target;
+		result.program = Shader::Link(job.vertexSource.c_str(), job.fragmentSource.c_str(), !cacheDirectory.empty());
+		if (result.program != 0)
+			SaveBinary(job.key, result.program);
+		result.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+		glFlush();
+
+		lock.lock();
+		results.push_back(result);
+		backgroundBuilds++;
+	}
+	lock.unlock();
+
+	glfwMakeContextCurrent(NULL);
+}
@@ -0,0 +1,198 @@
+#include "Trace.h"
+
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace
+{
+	struct Event
+	{
+		const char* name;
+		int64_t start;	// nanoseconds
+		int64_t end;
+	};
+
+	const size_t CHUNK_EVENTS = 4096;
+
+	struct Chunk
+	{
+		Event events[CHUNK_EVENTS];
+		std::atomic<Chunk*> next;
+
+		Chunk() : next(NULL) {}
+	};
+
+	// written by its thread only, read by Write() up to the published count
+	struct ThreadBuffer
+	{
+		int id;
+		std::atomic<const char*> name;
+		std::atomic<size_t> count;
+		std::atomic<size_t> dropped;
+		Chunk* head;
+		Chunk* tail;	// owner thread only
+
+		explicit ThreadBuffer(int id) : id(id), name(NULL), count(0), dropped(0), head(new Chunk()), tail(head) {}
+
+		~ThreadBuffer()
+		{
+			for (Chunk* c = head; c != NULL;)
+			{
+				Chunk* next = c->next.load();
+				delete c;
+				c = next;
+			}
+		}
+	};
+
+	// buffers outlive their threads, so zones of finished threads are still written
+	std::mutex registryMutex;
+	std::vector<std::unique_ptr<ThreadBuffer> > registry;
+	std::atomic<int64_t> epoch(0);
+
+	thread_local ThreadBuffer* threadBuffer = NULL;
+
+	ThreadBuffer* LocalBuffer()
+	{
+		if (threadBuffer == NULL)
+		{
+			std::lock_guard<std::mutex> lock(registryMutex);
+			registry.emplace_back(new ThreadBuffer((int)registry.size() + 1));
+			threadBuffer = registry.back().get();
+		}
+		return threadBuffer;
+	}
+
+	void WriteEscaped(FILE* file, const char* s)
+	{
+		for (; *s; s++)
+		{
+			if (*s == '"' || *s == '\\')
+				fputc('\\', file);
+			fputc(*s, file);
+		}
+	}
+}
+
+namespace Trace
+{
+	namespace detail
+	{
+		std::atomic<bool> enabled(false);
+
+		int64_t Now()
+		{
+			return std::chrono::duration_cast<std::chrono::nanoseconds>(
+				std::chrono::steady_clock::now().time_since_epoch()).count();
+		}
+
+		void Record(const char* name, int64_t start, int64_t end)
+		{
+			ThreadBuffer* buffer = LocalBuffer();
+			const size_t n = buffer->count.load(std::memory_order_relaxed);
+			if (n >= MAX_THREAD_EVENTS)
+			{
+				buffer->dropped.fetch_add(1, std::memory_order_relaxed);
+				return;
+			}
+
+			// a new chunk is linked before the count exposes any event in it
+			const size_t slot = n % CHUNK_EVENTS;
+			if (slot == 0 && n > 0)
+			{
+				Chunk* chunk = new Chunk();
+				buffer->tail->next.store(chunk, std::memory_order_release);
+				buffer->tail = chunk;
+			}
+			Event& e = buffer->tail->events[slot];
+			e.name = name;
+			e.start = start;
+			e.end = end;
+			buffer->count.store(n + 1, std::memory_order_release);
+		}
+	}
+
+	void Enable(bool enable)
+	{
+		int64_t unset = 0;
+		if (enable)
+			epoch.compare_exchange_strong(unset, detail::Now());
+		detail::enabled.store(enable);
+	}
+
+	void SetThreadName(const char* name)
+	{
+		LocalBuffer()->name.store(name, std::memory_order_release);
+	}
+
+	size_t EventCount()
+	{
+		std::lock_guard<std::mutex> lock(registryMutex);
+		size_t total = 0;
+		for (size_t i = 0; i < registry.size(); i++)
+			total += registry[i]->count.load(std::memory_order_acquire);
+		return total;
+	}
+
+	size_t DroppedCount()
+	{
+		std::lock_guard<std::mutex> lock(registryMutex);
+		size_t total = 0;
+		for (size_t i = 0; i < registry.size(); i++)
+			total += registry[i]->dropped.load(std::memory_order_relaxed);
+		return total;
+	}
+
+	bool Write(const std::string& path)
+	{
+		FILE* file = fopen(path.c_str(), "w");
+		if (file == NULL)
+		{
+			std::cout << "Failed to create trace " << path << std::endl;
+			return false;
+		}
+
+		const int64_t origin = epoch.load();
+		std::lock_guard<std::mutex> lock(registryMutex);
+		fprintf(file, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+		bool first = true;
+		for (size_t t = 0; t < registry.size(); t++)
+		{
+			const ThreadBuffer& buffer = *registry[t];
+			const char* name = buffer.name.load(std::memory_order_acquire);
+			if (name != NULL)
+			{
+				fprintf(file, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"", first ? "" : ",\n", buffer.id);
+				WriteEscaped(file, name);
+				fprintf(file, "\"}}");
+				first = false;
+			}
+
+			// events past 'count' may still be in the making and are left out
+			const size_t count = buffer.count.load(std::memory_order_acquire);
+			const Chunk* chunk = buffer.head;
+			for (size_t i = 0; i < count; i++)
+			{
+				if (i > 0 && i % CHUNK_EVENTS == 0)
+					chunk = chunk->next.load(std::memory_order_acquire);
+				const Event& e = chunk->events[i % CHUNK_EVENTS];
+				fprintf(file, "%s{\"name\":\"", first ? "" : ",\n");
+				WriteEscaped(file, e.name);
+				fprintf(file, "\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}",
+					buffer.id, (e.start - origin) / 1000.0, (e.end - e.start) / 1000.0);
+				first = false;
+			}
+		}
+		fprintf(file, "\n]}\n");
+
+		const bool ok = ferror(file) == 0;
+		fclose(file);
+		if (!ok)
+			std::cout << "Failed to write trace " << path << std::endl;
+		return ok;
+	}
+}
@@ -0,0 +1,169 @@
+#include "Undistorter.h"
+
+#include <opencv2/imgproc.hpp>
+#include <opencv2/calib3d.hpp>
+
+#include <cstring>
+#include <iostream>
+
+#include "FileCache.h"
+
+const float Undistorter::LOOKUP_OFFSET = -0.25f;
+const float Undistorter::LOOKUP_SCALE = 1.5f;
+
+// bump when the file layout or the map parameters change
+static const uint32_t MAPS_VERSION = 1;
+static const char MAPS_MAGIC[4] = { 'U', 'N', 'D', 'M' };
+
+struct MapsHeader
+{
+	char magic[4];
+	uint32_t version;
+	int32_t width;
+	int32_t height;
+};
+
+Undistorter::Undistorter()
+	: fromCache(false), lookupTexture(0)
+{
+}
+
+Undistorter::~Undistorter()
+{
+	// GL objects are released by Release() while the context is still current
+}
+
+uint64_t Undistorter::Key(const CameraCalibration& calibration)
+{
+	const cv::Mat k = calibration.cameraMatrix.clone();
+	const cv::Mat d = calibration.distCoeffs.clone();
+	uint64_t key = FileCache::Hash(&MAPS_VERSION, sizeof(MAPS_VERSION));
+	key = FileCache::Hash(k.data, k.total() * k.elemSize(), key);
+	key = FileCache::Hash(d.data, d.total() * d.elemSize(), key);
+	const int32_t dims[2] = { calibration.imageSize.width, calibration.imageSize.height };
+	return FileCache::Hash(dims, sizeof(dims), key);
+}
+
+bool Undistorter::Init(const CameraCalibration& calibration, const std::string& cacheDirectory)
+{
+	map1.release();
+	map2.release();
+	fromCache = false;
+	size = calibration.imageSize;
+	if (!calibration.IsValid() || size.area() == 0)
+		return false;
+
+	const std::string path = cacheDirectory.empty() ? std::string()
+		: FileCache::EntryPath(cacheDirectory, "undistort", Key(calibration), ".bin");
+	if (!path.empty() && LoadMaps(path))
+	{
+		fromCache = true;
+		return true;
+	}
+
+	// keep the original intrinsics, like cv::undistort does
+	cv::initUndistortRectifyMap(calibration.cameraMatrix, calibration.distCoeffs, cv::Mat(),
+		calibration.cameraMatrix, size, CV_16SC2, map1, map2);
+
+	if (!path.empty())
+	{
+		if (FileCache::EnsureDirectory(cacheDirectory))
+			SaveMaps(path);
+		else
+			std::cout << "Failed to create cache directory " << cacheDirectory << std::endl;
+	}
+	return true;
+}
+
+bool Undistorter::LoadMaps(const std::string& path)
+{
+	std::vector<unsigned char> data;
+	if (!FileCache::Read(path, data))
+		return false;
+
+	const size_t map1Bytes = (size_t)size.area() * 2 * sizeof(short);
+	const size_t map2Bytes = (size_t)size.area() * sizeof(ushort);
+	MapsHeader header;
+	if (data.size() != sizeof(header) + map1Bytes + map2Bytes)
+		return false;
+	memcpy(&header, data.data(), sizeof(header));
+	if (memcmp(header.magic, MAPS_MAGIC, sizeof(MAPS_MAGIC)) != 0 || header.version != MAPS_VERSION ||
+		header.width != size.width || header.height != size.height)
+		return false;
+
+	map1.create(size, CV_16SC2);
+	map2.create(size, CV_16UC1);
+	memcpy(map1.data, data.data() + sizeof(header), map1Bytes);
+	memcpy(map2.data, data.data() + sizeof(header) + map1Bytes, map2Bytes);
+	return true;
+}
+
+void Undistorter::SaveMaps(const std::string& path) const
+{
+	MapsHeader header;
+	memcpy(header.magic, MAPS_MAGIC, sizeof(MAPS_MAGIC));
+	header.version = MAPS_VERSION;
+	header.width = size.width;
+	header.height = size.height;
+
+	const size_t map1Bytes = map1.total() * map1.elemSize();
+	const size_t map2Bytes = map2.total() * map2.elemSize();
+	std::vector<unsigned char> data(sizeof(header) + map1Bytes + map2Bytes);
+	memcpy(data.data(), &header, sizeof(header));
+	memcpy(data.data() + sizeof(header), map1.data, map1Bytes);
+	memcpy(data.data() + sizeof(header) + map1Bytes, map2.data, map2Bytes);
+
+	if (!FileCache::Write(path, data.data(), data.size()))
+		std::cout << "Failed to write " << path << std::endl;
+}
+
+void Undistorter::Apply(const cv::Mat& src, cv::Mat& dst) const
+{
+	CV_Assert(IsReady() && src.size() == size);
+	cv::remap(src, dst, map1, map2, cv::INTER_LINEAR, cv::BORDER_CONSTANT);
+}
+
+GLuint Undistorter::LookupTexture()
+{
+	if (lookupTexture != 0 || !IsReady())
+		return lookupTexture;
+
+	// expand the fixed-point maps and normalize them to texel centers
+	cv::Mat coords;
+	cv::convertMaps(map1, map2, coords, cv::noArray(), CV_32FC2);
+
+	cv::Mat lookup(size, CV_16UC2);
+	for (int y = 0; y < size.height; y++)
+	{
+		const cv::Vec2f* src = coords.ptr<cv::Vec2f>(y);
+		cv::Vec2w* dst = lookup.ptr<cv::Vec2w>(y);
+		for (int x = 0; x < size.width; x++)
+		{
+			const float u = ((src[x][0] + 0.5f) / size.width - LOOKUP_OFFSET) / LOOKUP_SCALE;
+			const float v = ((src[x][1] + 0.5f) / size.height - LOOKUP_OFFSET) / LOOKUP_SCALE;
+			dst[x][0] = cv::saturate_cast<ushort>(u * 65535.0f);
+			dst[x][1] = cv::saturate_cast<ushort>(v * 65535.0f);
+		}
+	}
+
+	glGenTextures(1, &lookupTexture);
+	glBindTexture(GL_TEXTURE_2D, lookupTexture);
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_RG16, size.width, size.height, 0, GL_RG, GL_UNSIGNED_SHORT, lookup.data);
+	// the window rarely matches the frame size, so coordinates are interpolated too
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+	glBindTexture(GL_TEXTURE_2D, 0);
+	return lookupTexture;
+}
+
+void Undistorter::Release()
+{
+	if (lookupTexture != 0)
+	{
+		glDeleteTextures(1, &lookupTexture);
+		lookupTexture = 0;
+	}
+}
@@ -0,0 +1,194 @@
+#include "VideoRecorder.h"
+
+#include <algorithm>
+#include <iostream>
+
+#include "Trace.h"
+
+VideoRecorder::VideoRecorder()
+	: policy(OverflowPolicy::DropOldest), bottomUp(false), queueHead(0), queueCount(0), maxQueueCount(0), writing(-1),
+	stopping(false), written(0), dropped(0)
+{
+}
+
+VideoRecorder::~VideoRecorder()
+{
+	Close();
+}
+
+bool VideoRecorder::Open(const std::string& path, double fps, cv::Size size, OverflowPolicy policy, bool bottomUp, int queueSize)
+{
+	Close();
+	if (!sink.Open(path, fps, size))
+		return false;
+
+	this->size = size;
+	this->policy = policy;
+	this->bottomUp = bottomUp;
+
+	// every frame buffer is allocated here, none while recording
+	const int slots = std::max(1, queueSize) + 1;
+	pool.assign(slots, cv::Mat());
+	freeSlots.clear();
+	for (int i = slots - 1; i >= 0; i--)
+	{
+		pool[i].create(size, CV_8UC3);
+		freeSlots.push_back(i);
+	}
+	queue.assign(slots, -1);
+	queueHead = queueCount = maxQueueCount = 0;
+	writing = -1;
+	written.store(0);
+	dropped.store(0);
+
+	stopping = false;
+	worker = std::thread(&VideoRecorder::Run, this);
+	return true;
+}
+
+void VideoRecorder::Close()
+{
+	if (!worker.joinable())
+		return;
+
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		stopping = true;
+	}
+	queued.notify_one();
+	released.notify_all();
+	worker.join();
+
+	sink.Close();
+	pool.clear();
+	freeSlots.clear();
+	queue.clear();
+	queueCount = 0;
+	writing = -1;
+}
+
+bool VideoRecorder::Write(const cv::Mat& frame)
+{
+	if (frame.size() != size || frame.type() != CV_8UC3)
+	{
+		DropWrite();
+		return false;
+	}
+
+	cv::Mat* slot = BeginWrite();
+	if (slot == NULL)
+		return false;
+	frame.copyTo(*slot);
+	CommitWrite();
+	return true;
+}
+
+cv::Mat* VideoRecorder::BeginWrite()
+{
+	if (!IsOpen() || writing >= 0)
+		return NULL;
+
+	std::unique_lock<std::mutex> lock(mutex);
+	if (freeSlots.empty())
+	{
+		switch (policy)
+		{
+		case OverflowPolicy::Block:
+			released.wait(lock, [this]() { return !freeSlots.empty() || stopping; });
+			if (freeSlots.empty())
+				return NULL;
+			break;
+
+		case OverflowPolicy::DropOldest:
+			// the encoder only ever holds one slot, so with a pool of at least two
+			// there is always a queued frame to take back
+			if (queueCount == 0)
+			{
+				dropped.fetch_add(1, std::memory_order_relaxed);
+				return NULL;
+			}
+			freeSlots.push_back(queue[queueHead]);
+			queueHead = (queueHead + 1) % (int)queue.size();
+			queueCount--;
+			dropped.fetch_add(1, std::memory_order_relaxed);
+			break;
+
+		case OverflowPolicy::DropNewest:
+			dropped.fetch_add(1, std::memory_order_relaxed);
+			return NULL;
+		}
+	}
+
+	writing = freeSlots.back();
+	freeSlots.pop_back();
+	return &pool[writing];
+}
+
+void VideoRecorder::CommitWrite()
+{
+	if (writing < 0)
+		return;
+
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		queue[(queueHead + queueCount) % (int)queue.size()] = writing;
+		queueCount++;
+		maxQueueCount = std::max(maxQueueCount, queueCount);
+		writing = -1;
+	}
+	queued.notify_one();
+}
+
+void VideoRecorder::CancelWrite()
+{
+	if (writing < 0)
+		return;
+
+	std::lock_guard<std::mutex> lock(mutex);
+	freeSlots.push_back(writing);
+	writing = -1;
+}
+
+int VideoRecorder::QueueDepth() const
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return queueCount;
+}
+
+int VideoRecorder::MaxQueueDepth() const
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return maxQueueCount;
+}
+
+void VideoRecorder::Run()
+{
+	Trace::SetThreadName("Encoder");
+	std::unique_lock<std::mutex> lock(mutex);
+	for (;;)
+	{
+		queued.wait(lock, [this]() { return queueCount > 0 || stopping; });
+
+		// on Close, whatever is still queued gets encoded first
+		if (queueCount == 0)
+			break;
+
+		const int slot = queue[queueHead];
+		queueHead = (queueHead + 1) % (int)queue.size();
+		queueCount--;
+		lock.unlock();
+
+		{
+			TRACE_ZONE("Encode");
+			cv::Mat& frame = pool[slot];
+			if (bottomUp)
+				cv::flip(frame, frame, 0);
+			sink.Write(frame);
+			written.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		lock.lock();
+		freeSlots.push_back(slot);
+		released.notify_one();
+	}
+}
@@ -162,97 +162,160 @@ struct gladGLversionStruct GLVersion = { 0, 0 };
 static int max_loaded_major;
 static int max_loaded_minor;
 
-static const char *exts = NULL;
-static int num_exts_i = 0;
-static char **exts_i = NULL;
+/* Extension index: an open-addressing hash table and the extension names it points
+ * into, built once per load in a single allocation. has_ext() is then a hash and
+ * (almost always) one string compare instead of a scan over every extension. */
+struct ext_slot {
+    unsigned int hash;
+    unsigned int offset; /* 1 + offset of the name in ext_names, 0 = empty slot */
+};
 
-static int get_exts(void) {
-#ifdef _GLAD_IS_SOME_NEW_VERSION
-    if(max_loaded_major < 3) {
-#endif
-        exts = (const char *)glGetString(GL_EXTENSIONS);
-#ifdef _GLAD_IS_SOME_NEW_VERSION
-    } else {
-        unsigned int index;
-
-        num_exts_i = 0;
-        glGetIntegerv(GL_NUM_EXTENSIONS, &num_exts_i);
-        if (num_exts_i > 0) {
-            char **tmp_exts_i = (char **)realloc((void *)exts_i, (size_t)num_exts_i * (sizeof *exts_i));
-            if (tmp_exts_i == NULL) {
-                return 0;
-            }
-            exts_i = tmp_exts_i;
-        }
+static void *ext_arena = NULL;
+static struct ext_slot *ext_table = NULL;
+static unsigned int ext_mask = 0;
+static char *ext_names = NULL;
 
-        if (exts_i == NULL) {
-            return 0;
-        }
+/* FNV-1a over 'len' bytes, or up to the terminating zero if len is (size_t)-1 */
+static unsigned int hash_ext(const char *name, size_t len) {
+    unsigned int hash = 2166136261u;
+    size_t index;
+    for(index = 0; index != len && name[index] != '\0'; index++) {
+        hash = (hash ^ (unsigned char)name[index]) * 16777619u;
+    }
+    return hash;
+}
 
-        for(index = 0; index < (unsigned)num_exts_i; index++) {
-            const char *gl_str_tmp = (const char*)glGetStringi(GL_EXTENSIONS, index);
-            size_t len = strlen(gl_str_tmp);
+static void insert_ext(const char *name, size_t len, size_t *used) {
+    unsigned int hash = hash_ext(name, len);
+    unsigned int slot = hash & ext_mask;
+    char *dst = ext_names + *used;
 
-            char *local_str = (char*)malloc((len+1) * sizeof(char));
-            if(local_str != NULL) {
-                memcpy(local_str, gl_str_tmp, (len+1) * sizeof(char));
-            }
-            exts_i[index] = local_str;
+    while(ext_table[slot].offset != 0) {
+        if(ext_table[slot].hash == hash && strncmp(ext_names + ext_table[slot].offset - 1, name, len) == 0
+            && ext_names[ext_table[slot].offset - 1 + len] == '\0') {
+            return; /* duplicate */
         }
+        slot = (slot + 1) & ext_mask;
     }
-#endif
-    return 1;
+
+    memcpy(dst, name, len);
+    dst[len] = '\0';
+    ext_table[slot].hash = hash;
+    ext_table[slot].offset = (unsigned int)(*used + 1);
+    *used += len + 1;
 }
 
 static void free_exts(void) {
-    if (exts_i != NULL) {
-        int index;
-        for(index = 0; index < num_exts_i; index++) {
-            free((char *)exts_i[index]);
-        }
-        free((void *)exts_i);
-        exts_i = NULL;
+    free(ext_arena);
+    ext_arena = NULL;
+    ext_table = NULL;
+    ext_names = NULL;
+    ext_mask = 0;
+}
+
+/* size the table to at least twice the extension count and allocate it together with the names */
+static int alloc_exts(size_t count, size_t name_bytes) {
+    size_t slots = 16;
+    while(slots < count * 2) {
+        slots <<= 1;
+    }
+
+    ext_arena = calloc(1, slots * sizeof(struct ext_slot) + name_bytes);
+    if(ext_arena == NULL) {
+        return 0;
     }
+    ext_table = (struct ext_slot *)ext_arena;
+    ext_names = (char *)(ext_table + slots);
+    ext_mask = (unsigned int)(slots - 1);
+    return 1;
 }
 
-static int has_ext(const char *ext) {
+static int get_exts(void) {
+    size_t count = 0;
+    size_t name_bytes = 0;
+    size_t used = 0;
+
+    free_exts();
+
 #ifdef _GLAD_IS_SOME_NEW_VERSION
     if(max_loaded_major < 3) {
 #endif
-        const char *extensions;
-        const char *loc;
-        const char *terminator;
-        extensions = exts;
-        if(extensions == NULL || ext == NULL) {
+        const char *exts = (const char *)glGetString(GL_EXTENSIONS);
+        const char *cursor;
+        if(exts == NULL) {
             return 0;
         }
 
-        while(1) {
-            loc = strstr(extensions, ext);
-            if(loc == NULL) {
-                return 0;
+        /* one space separated string: count names, then copy them in place */
+        for(cursor = exts; *cursor != '\0'; cursor++) {
+            if(*cursor != ' ' && (cursor == exts || cursor[-1] == ' ')) {
+                count++;
             }
+        }
+        if(!alloc_exts(count, strlen(exts) + 1)) {
+            return 0;
+        }
 
-            terminator = loc + strlen(ext);
-            if((loc == extensions || *(loc - 1) == ' ') &&
-                (*terminator == ' ' || *terminator == '\0')) {
-                return 1;
+        cursor = exts;
+        while(*cursor != '\0') {
+            size_t len;
+            while(*cursor == ' ') {
+                cursor++;
             }
-            extensions = terminator;
+            len = strcspn(cursor, " ");
+            if(len > 0) {
+                insert_ext(cursor, len, &used);
+            }
+            cursor += len;
         }
 #ifdef _GLAD_IS_SOME_NEW_VERSION
     } else {
-        int index;
-        if(exts_i == NULL) return 0;
-        for(index = 0; index < num_exts_i; index++) {
-            const char *e = exts_i[index];
+        unsigned int index;
+        int num_exts_i = 0;
+
+        glGetIntegerv(GL_NUM_EXTENSIONS, &num_exts_i);
+        if(num_exts_i < 0) {
+            num_exts_i = 0;
+        }
+        count = (size_t)num_exts_i;
+
+        for(index = 0; index < (unsigned)num_exts_i; index++) {
+            const char *gl_str_tmp = (const char*)glGetStringi(GL_EXTENSIONS, index);
+            if(gl_str_tmp != NULL) {
+                name_bytes += strlen(gl_str_tmp) + 1;
+            }
+        }
+        if(!alloc_exts(count, name_bytes)) {
+            return 0;
+        }
 
-            if(exts_i[index] != NULL && strcmp(e, ext) == 0) {
-                return 1;
+        for(index = 0; index < (unsigned)num_exts_i; index++) {
+            const char *gl_str_tmp = (const char*)glGetStringi(GL_EXTENSIONS, index);
+            if(gl_str_tmp != NULL) {
+                insert_ext(gl_str_tmp, strlen(gl_str_tmp), &used);
             }
         }
     }
 #endif
+    return 1;
+}
+
+static int has_ext(const char *ext) {
+    unsigned int hash;
+    unsigned int slot;
+
+    if(ext_table == NULL || ext == NULL) {
+        return 0;
+    }
+
+    hash = hash_ext(ext, (size_t)-1);
+    slot = hash & ext_mask;
+    while(ext_table[slot].offset != 0) {
+        if(ext_table[slot].hash == hash && strcmp(ext_names + ext_table[slot].offset - 1, ext) == 0) {
+            return 1;
+        }
+        slot = (slot + 1) & ext_mask;
+    }
 
     return 0;
 }
@@ -2433,10 +2496,2135 @@ static void load_GL_VERSION_4_6(GLADloadproc load) {
 	glad_glMultiDrawElementsIndirectCount = (PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC)load("glMultiDrawElementsIndirectCount");
 	glad_glPolygonOffsetClamp = (PFNGLPOLYGONOFFSETCLAMPPROC)load("glPolygonOffsetClamp");
 }
+/* Lazy binding: every entry point starts out as a trampoline that resolves the real
+ * function on its first call, then forwards to it. Generated from the typedefs in glad.h. */
+static GLADloadproc glad_lazy_load = NULL;
+
+struct glad_lazy_entry {
+    const char *name;
+    void **slot;
+    void *trampoline;
+    int resolved;
+};
+
+#define GLAD_LAZY_COUNT 1048
+#define GLAD_LAZY_GETSTRING 358
+
+static void glad_lazy_resolve(int index);
+
+static void APIENTRY glad_lazy_glAccum(GLenum op, GLfloat value) { glad_lazy_resolve(0); glad_glAccum(op, value); }
+static void APIENTRY glad_lazy_glActiveShaderProgram(GLuint pipeline, GLuint program) { glad_lazy_resolve(1); glad_glActiveShaderProgram(pipeline, program); }
+static void APIENTRY glad_lazy_glActiveTexture(GLenum texture) { glad_lazy_resolve(2); glad_glActiveTexture(texture); }
+static void APIENTRY glad_lazy_glAlphaFunc(GLenum func, GLfloat ref) { glad_lazy_resolve(3); glad_glAlphaFunc(func, ref); }
+static GLboolean APIENTRY glad_lazy_glAreTexturesResident(GLsizei n, const GLuint *textures, GLboolean *residences) { glad_lazy_resolve(4); return glad_glAreTexturesResident(n, textures, residences); }
+static void APIENTRY glad_lazy_glArrayElement(GLint i) { glad_lazy_resolve(5); glad_glArrayElement(i); }
+static void APIENTRY glad_lazy_glAttachShader(GLuint program, GLuint shader) { glad_lazy_resolve(6); glad_glAttachShader(program, shader); }
+static void APIENTRY glad_lazy_glBegin(GLenum mode) { glad_lazy_resolve(7); glad_glBegin(mode); }
+static void APIENTRY glad_lazy_glBeginConditionalRender(GLuint id, GLenum mode) { glad_lazy_resolve(8); glad_glBeginConditionalRender(id, mode); }
+static void APIENTRY glad_lazy_glBeginQuery(GLenum target, GLuint id) { glad_lazy_resolve(9); glad_glBeginQuery(target, id); }
+static void APIENTRY glad_lazy_glBeginQueryIndexed(GLenum target, GLuint index, GLuint id) { glad_lazy_resolve(10); glad_glBeginQueryIndexed(target, index, id); }
+static void APIENTRY glad_lazy_glBeginTransformFeedback(GLenum primitiveMode) { glad_lazy_resolve(11); glad_glBeginTransformFeedback(primitiveMode); }
+static void APIENTRY glad_lazy_glBindAttribLocation(GLuint program, GLuint index, const GLchar *name) { glad_lazy_resolve(12); glad_glBindAttribLocation(program, index, name); }
+static void APIENTRY glad_lazy_glBindBuffer(GLenum target, GLuint buffer) { glad_lazy_resolve(13); glad_glBindBuffer(target, buffer); }
+static void APIENTRY glad_lazy_glBindBufferBase(GLenum target, GLuint index, GLuint buffer) { glad_lazy_resolve(14); glad_glBindBufferBase(target, index, buffer); }
+static void APIENTRY glad_lazy_glBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) { glad_lazy_resolve(15); glad_glBindBufferRange(target, index, buffer, offset, size); }
+static void APIENTRY glad_lazy_glBindBuffersBase(GLenum target, GLuint first, GLsizei count, const GLuint *buffers) { glad_lazy_resolve(16); glad_glBindBuffersBase(target, first, count, buffers); }
+static void APIENTRY glad_lazy_glBindBuffersRange(GLenum target, GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizeiptr *sizes) { glad_lazy_resolve(17); glad_glBindBuffersRange(target, first, count, buffers, offsets, sizes); }
+static void APIENTRY glad_lazy_glBindFragDataLocation(GLuint program, GLuint color, const GLchar *name) { glad_lazy_resolve(18); glad_glBindFragDataLocation(program, color, name); }
+static void APIENTRY glad_lazy_glBindFragDataLocationIndexed(GLuint program, GLuint colorNumber, GLuint index, const GLchar *name) { glad_lazy_resolve(19); glad_glBindFragDataLocationIndexed(program, colorNumber, index, name); }
+static void APIENTRY glad_lazy_glBindFramebuffer(GLenum target, GLuint framebuffer) { glad_lazy_resolve(20); glad_glBindFramebuffer(target, framebuffer); }
+static void APIENTRY glad_lazy_glBindImageTexture(GLuint unit, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLenum format) { glad_lazy_resolve(21); glad_glBindImageTexture(unit, texture, level, layered, layer, access, format); }
+static void APIENTRY glad_lazy_glBindImageTextures(GLuint first, GLsizei count, const GLuint *textures) { glad_lazy_resolve(22); glad_glBindImageTextures(first, count, textures); }
+static void APIENTRY glad_lazy_glBindProgramPipeline(GLuint pipeline) { glad_lazy_resolve(23); glad_glBindProgramPipeline(pipeline); }
+static void APIENTRY glad_lazy_glBindRenderbuffer(GLenum target, GLuint renderbuffer) { glad_lazy_resolve(24); glad_glBindRenderbuffer(target, renderbuffer); }
+static void APIENTRY glad_lazy_glBindSampler(GLuint unit, GLuint sampler) { glad_lazy_resolve(25); glad_glBindSampler(unit, sampler); }
+static void APIENTRY glad_lazy_glBindSamplers(GLuint first, GLsizei count, const GLuint *samplers) { glad_lazy_resolve(26); glad_glBindSamplers(first, count, samplers); }
+static void APIENTRY glad_lazy_glBindTexture(GLenum target, GLuint texture) { glad_lazy_resolve(27); glad_glBindTexture(target, texture); }
+static void APIENTRY glad_lazy_glBindTextureUnit(GLuint unit, GLuint texture) { glad_lazy_resolve(28); glad_glBindTextureUnit(unit, texture); }
+static void APIENTRY glad_lazy_glBindTextures(GLuint first, GLsizei count, const GLuint *textures) { glad_lazy_resolve(29); glad_glBindTextures(first, count, textures); }
+static void APIENTRY glad_lazy_glBindTransformFeedback(GLenum target, GLuint id) { glad_lazy_resolve(30); glad_glBindTransformFeedback(target, id); }
+static void APIENTRY glad_lazy_glBindVertexArray(GLuint array) { glad_lazy_resolve(31); glad_glBindVertexArray(array); }
+static void APIENTRY glad_lazy_glBindVertexBuffer(GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride) { glad_lazy_resolve(32); glad_glBindVertexBuffer(bindingindex, buffer, offset, stride); }
+static void APIENTRY glad_lazy_glBindVertexBuffers(GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizei *strides) { glad_lazy_resolve(33); glad_glBindVertexBuffers(first, count, buffers, offsets, strides); }
+static void APIENTRY glad_lazy_glBitmap(GLsizei width, GLsizei height, GLfloat xorig, GLfloat yorig, GLfloat xmove, GLfloat ymove, const GLubyte *bitmap) { glad_lazy_resolve(34); glad_glBitmap(width, height, xorig, yorig, xmove, ymove, bitmap); }
+static void APIENTRY glad_lazy_glBlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) { glad_lazy_resolve(35); glad_glBlendColor(red, green, blue, alpha); }
+static void APIENTRY glad_lazy_glBlendEquation(GLenum mode) { glad_lazy_resolve(36); glad_glBlendEquation(mode); }
+static void APIENTRY glad_lazy_glBlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha) { glad_lazy_resolve(37); glad_glBlendEquationSeparate(modeRGB, modeAlpha); }
+static void APIENTRY glad_lazy_glBlendEquationSeparatei(GLuint buf, GLenum modeRGB, GLenum modeAlpha) { glad_lazy_resolve(38); glad_glBlendEquationSeparatei(buf, modeRGB, modeAlpha); }
+static void APIENTRY glad_lazy_glBlendEquationi(GLuint buf, GLenum mode) { glad_lazy_resolve(39); glad_glBlendEquationi(buf, mode); }
+static void APIENTRY glad_lazy_glBlendFunc(GLenum sfactor, GLenum dfactor) { glad_lazy_resolve(40); glad_glBlendFunc(sfactor, dfactor); }
+static void APIENTRY glad_lazy_glBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha) { glad_lazy_resolve(41); glad_glBlendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha); }
+static void APIENTRY glad_lazy_glBlendFuncSeparatei(GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha) { glad_lazy_resolve(42); glad_glBlendFuncSeparatei(buf, srcRGB, dstRGB, srcAlpha, dstAlpha); }
+static void APIENTRY glad_lazy_glBlendFunci(GLuint buf, GLenum src, GLenum dst) { glad_lazy_resolve(43); glad_glBlendFunci(buf, src, dst); }
+static void APIENTRY glad_lazy_glBlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) { glad_lazy_resolve(44); glad_glBlitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter); }
+static void APIENTRY glad_lazy_glBlitNamedFramebuffer(GLuint readFramebuffer, GLuint drawFramebuffer, GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) { glad_lazy_resolve(45); glad_glBlitNamedFramebuffer(readFramebuffer, drawFramebuffer, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter); }
+static void APIENTRY glad_lazy_glBufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage) { glad_lazy_resolve(46); glad_glBufferData(target, size, data, usage); }
+static void APIENTRY glad_lazy_glBufferStorage(GLenum target, GLsizeiptr size, const void *data, GLbitfield flags) { glad_lazy_resolve(47); glad_glBufferStorage(target, size, data, flags); }
+static void APIENTRY glad_lazy_glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data) { glad_lazy_resolve(48); glad_glBufferSubData(target, offset, size, data); }
+static void APIENTRY glad_lazy_glCallList(GLuint list) { glad_lazy_resolve(49); glad_glCallList(list); }
+static void APIENTRY glad_lazy_glCallLists(GLsizei n, GLenum type, const void *lists) { glad_lazy_resolve(50); glad_glCallLists(n, type, lists); }
+static GLenum APIENTRY glad_lazy_glCheckFramebufferStatus(GLenum target) { glad_lazy_resolve(51); return glad_glCheckFramebufferStatus(target); }
+static GLenum APIENTRY glad_lazy_glCheckNamedFramebufferStatus(GLuint framebuffer, GLenum target) { glad_lazy_resolve(52); return glad_glCheckNamedFramebufferStatus(framebuffer, target); }
+static void APIENTRY glad_lazy_glClampColor(GLenum target, GLenum clamp) { glad_lazy_resolve(53); glad_glClampColor(target, clamp); }
+static void APIENTRY glad_lazy_glClear(GLbitfield mask) { glad_lazy_resolve(54); glad_glClear(mask); }
+static void APIENTRY glad_lazy_glClearAccum(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) { glad_lazy_resolve(55); glad_glClearAccum(red, green, blue, alpha); }
+static void APIENTRY glad_lazy_glClearBufferData(GLenum target, GLenum internalformat, GLenum format, GLenum type, const void *data) { glad_lazy_resolve(56); glad_glClearBufferData(target, internalformat, format, type, data); }
+static void APIENTRY glad_lazy_glClearBufferSubData(GLenum target, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data) { glad_lazy_resolve(57); glad_glClearBufferSubData(target, internalformat, offset, size, format, type, data); }
+static void APIENTRY glad_lazy_glClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil) { glad_lazy_resolve(58); glad_glClearBufferfi(buffer, drawbuffer, depth, stencil); }
+static void APIENTRY glad_lazy_glClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat *value) { glad_lazy_resolve(59); glad_glClearBufferfv(buffer, drawbuffer, value); }
+static void APIENTRY glad_lazy_glClearBufferiv(GLenum buffer, GLint drawbuffer, const GLint *value) { glad_lazy_resolve(60); glad_glClearBufferiv(buffer, drawbuffer, value); }
+static void APIENTRY glad_lazy_glClearBufferuiv(GLenum buffer, GLint drawbuffer, const GLuint *value) { glad_lazy_resolve(61); glad_glClearBufferuiv(buffer, drawbuffer, value); }
+static void APIENTRY glad_lazy_glClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) { glad_lazy_resolve(62); glad_glClearColor(red, green, blue, alpha); }
+static void APIENTRY glad_lazy_glClearDepth(GLdouble depth) { glad_lazy_resolve(63); glad_glClearDepth(depth); }
+static void APIENTRY glad_lazy_glClearDepthf(GLfloat d) { glad_lazy_resolve(64); glad_glClearDepthf(d); }
+static void APIENTRY glad_lazy_glClearIndex(GLfloat c) { glad_lazy_resolve(65); glad_glClearIndex(c); }
+static void APIENTRY glad_lazy_glClearNamedBufferData(GLuint buffer, GLenum internalformat, GLenum format, GLenum type, const void *data) { glad_lazy_resolve(66); glad_glClearNamedBufferData(buffer, internalformat, format, type, data); }
+static void APIENTRY glad_lazy_glClearNamedBufferSubData(GLuint buffer, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data) { glad_lazy_resolve(67); glad_glClearNamedBufferSubData(buffer, internalformat, offset, size, format, type, data); }
+static void APIENTRY glad_lazy_glClearNamedFramebufferfi(GLuint framebuffer, GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil) { glad_lazy_resolve(68); glad_glClearNamedFramebufferfi(framebuffer, buffer, drawbuffer, depth, stencil); }
+static void APIENTRY glad_lazy_glClearNamedFramebufferfv(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLfloat *value) { glad_lazy_resolve(69); glad_glClearNamedFramebufferfv(framebuffer, buffer, drawbuffer, value); }
+static void APIENTRY glad_lazy_glClearNamedFramebufferiv(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLint *value) { glad_lazy_resolve(70); glad_glClearNamedFramebufferiv(framebuffer, buffer, drawbuffer, value); }
+static void APIENTRY glad_lazy_glClearNamedFramebufferuiv(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLuint *value) { glad_lazy_resolve(71); glad_glClearNamedFramebufferuiv(framebuffer, buffer, drawbuffer, value); }
+static void APIENTRY glad_lazy_glClearStencil(GLint s) { glad_lazy_resolve(72); glad_glClearStencil(s); }
+static void APIENTRY glad_lazy_glClearTexImage(GLuint texture, GLint level, GLenum format, GLenum type, const void *data) { glad_lazy_resolve(73); glad_glClearTexImage(texture, level, format, type, data); }
+static void APIENTRY glad_lazy_glClearTexSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *data) { glad_lazy_resolve(74); glad_glClearTexSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, data); }
+static void APIENTRY glad_lazy_glClientActiveTexture(GLenum texture) { glad_lazy_resolve(75); glad_glClientActiveTexture(texture); }
+static GLenum APIENTRY glad_lazy_glClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) { glad_lazy_resolve(76); return glad_glClientWaitSync(sync, flags, timeout); }
+static void APIENTRY glad_lazy_glClipControl(GLenum origin, GLenum depth) { glad_lazy_resolve(77); glad_glClipControl(origin, depth); }
+static void APIENTRY glad_lazy_glClipPlane(GLenum plane, const GLdouble *equation) { glad_lazy_resolve(78); glad_glClipPlane(plane, equation); }
+static void APIENTRY glad_lazy_glColor3b(GLbyte red, GLbyte green, GLbyte blue) { glad_lazy_resolve(79); glad_glColor3b(red, green, blue); }
+static void APIENTRY glad_lazy_glColor3bv(const GLbyte *v) { glad_lazy_resolve(80); glad_glColor3bv(v); }
+static void APIENTRY glad_lazy_glColor3d(GLdouble red, GLdouble green, GLdouble blue) { glad_lazy_resolve(81); glad_glColor3d(red, green, blue); }
+static void APIENTRY glad_lazy_glColor3dv(const GLdouble *v) { glad_lazy_resolve(82); glad_glColor3dv(v); }
+static void APIENTRY glad_lazy_glColor3f(GLfloat red, GLfloat green, GLfloat blue) { glad_lazy_resolve(83); glad_glColor3f(red, green, blue); }
+static void APIENTRY glad_lazy_glColor3fv(const GLfloat *v) { glad_lazy_resolve(84); glad_glColor3fv(v); }
+static void APIENTRY glad_lazy_glColor3i(GLint red, GLint green, GLint blue) { glad_lazy_resolve(85); glad_glColor3i(red, green, blue); }
+static void APIENTRY glad_lazy_glColor3iv(const GLint *v) { glad_lazy_resolve(86); glad_glColor3iv(v); }
+static void APIENTRY glad_lazy_glColor3s(GLshort red, GLshort green, GLshort blue) { glad_lazy_resolve(87); glad_glColor3s(red, green, blue); }
+static void APIENTRY glad_lazy_glColor3sv(const GLshort *v) { glad_lazy_resolve(88); glad_glColor3sv(v); }
+static void APIENTRY glad_lazy_glColor3ub(GLubyte red, GLubyte green, GLubyte blue) { glad_lazy_resolve(89); glad_glColor3ub(red, green, blue); }
+static void APIENTRY glad_lazy_glColor3ubv(const GLubyte *v) { glad_lazy_resolve(90); glad_glColor3ubv(v); }
+static void APIENTRY glad_lazy_glColor3ui(GLuint red, GLuint green, GLuint blue) { glad_lazy_resolve(91); glad_glColor3ui(red, green, blue); }
+static void APIENTRY glad_lazy_glColor3uiv(const GLuint *v) { glad_lazy_resolve(92); glad_glColor3uiv(v); }
+static void APIENTRY glad_lazy_glColor3us(GLushort red, GLushort green, GLushort blue) { glad_lazy_resolve(93); glad_glColor3us(red, green, blue); }
+static void APIENTRY glad_lazy_glColor3usv(const GLushort *v) { glad_lazy_resolve(94); glad_glColor3usv(v); }
+static void APIENTRY glad_lazy_glColor4b(GLbyte red, GLbyte green, GLbyte blue, GLbyte alpha) { glad_lazy_resolve(95); glad_glColor4b(red, green, blue, alpha); }
+static void APIENTRY glad_lazy_glColor4bv(const GLbyte *v) { glad_lazy_resolve(96); glad_glColor4bv(v); }
+static void APIENTRY glad_lazy_glColor4d(GLdouble red, GLdouble green, GLdouble blue, GLdouble alpha) { glad_lazy_resolve(97); glad_glColor4d(red, green, blue, alpha); }
+static void APIENTRY glad_lazy_glColor4dv(const GLdouble *v) { glad_lazy_resolve(98); glad_glColor4dv(v); }
+static void APIENTRY glad_lazy_glColor4f(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) { glad_lazy_resolve(99); glad_glColor4f(red, green, blue, alpha); }
+static void APIENTRY glad_lazy_glColor4fv(const GLfloat *v) { glad_lazy_resolve(100); glad_glColor4fv(v); }
+static void APIENTRY glad_lazy_glColor4i(GLint red, GLint green, GLint blue, GLint alpha) { glad_lazy_resolve(101); glad_glColor4i(red, green, blue, alpha); }
+static void APIENTRY glad_lazy_glColor4iv(const GLint *v) { glad_lazy_resolve(102); glad_glColor4iv(v); }
+static void APIENTRY glad_lazy_glColor4s(GLshort red, GLshort green, GLshort blue, GLshort alpha) { glad_lazy_resolve(103); glad_glColor4s(red, green, blue, alpha); }
+static void APIENTRY glad_lazy_glColor4sv(const GLshort *v) { glad_lazy_resolve(104); glad_glColor4sv(v); }
+static void APIENTRY glad_lazy_glColor4ub(GLubyte red, GLubyte green, GLubyte blue, GLubyte alpha) { glad_lazy_resolve(105); glad_glColor4ub(red, green, blue, alpha); }
+static void APIENTRY glad_lazy_glColor4ubv(const GLubyte *v) { glad_lazy_resolve(106); glad_glColor4ubv(v); }
+static void APIENTRY glad_lazy_glColor4ui(GLuint red, GLuint green, GLuint blue, GLuint alpha) { glad_lazy_resolve(107); glad_glColor4ui(red, green, blue, alpha); }
+static void APIENTRY glad_lazy_glColor4uiv(const GLuint *v) { glad_lazy_resolve(108); glad_glColor4uiv(v); }
+static void APIENTRY glad_lazy_glColor4us(GLushort red, GLushort green, GLushort blue, GLushort alpha) { glad_lazy_resolve(109); glad_glColor4us(red, green, blue, alpha); }
+static void APIENTRY glad_lazy_glColor4usv(const GLushort *v) { glad_lazy_resolve(110); glad_glColor4usv(v); }
+static void APIENTRY glad_lazy_glColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha) { glad_lazy_resolve(111); glad_glColorMask(red, green, blue, alpha); }
+static void APIENTRY glad_lazy_glColorMaski(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a) { glad_lazy_resolve(112); glad_glColorMaski(index, r, g, b, a); }
+static void APIENTRY glad_lazy_glColorMaterial(GLenum face, GLenum mode) { glad_lazy_resolve(113); glad_glColorMaterial(face, mode); }
+static void APIENTRY glad_lazy_glColorP3ui(GLenum type, GLuint color) { glad_lazy_resolve(114); glad_glColorP3ui(type, color); }
+static void APIENTRY glad_lazy_glColorP3uiv(GLenum type, const GLuint *color) { glad_lazy_resolve(115); glad_glColorP3uiv(type, color); }
+static void APIENTRY glad_lazy_glColorP4ui(GLenum type, GLuint color) { glad_lazy_resolve(116); glad_glColorP4ui(type, color); }
+static void APIENTRY glad_lazy_glColorP4uiv(GLenum type, const GLuint *color) { glad_lazy_resolve(117); glad_glColorP4uiv(type, color); }
+static void APIENTRY glad_lazy_glColorPointer(GLint size, GLenum type, GLsizei stride, const void *pointer) { glad_lazy_resolve(118); glad_glColorPointer(size, type, stride, pointer); }
+static void APIENTRY glad_lazy_glCompileShader(GLuint shader) { glad_lazy_resolve(119); glad_glCompileShader(shader); }
+static void APIENTRY glad_lazy_glCompressedTexImage1D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data) { glad_lazy_resolve(120); glad_glCompressedTexImage1D(target, level, internalformat, width, border, imageSize, data); }
+static void APIENTRY glad_lazy_glCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data) { glad_lazy_resolve(121); glad_glCompressedTexImage2D(target, level, internalformat, width, height, border, imageSize, data); }
+static void APIENTRY glad_lazy_glCompressedTexImage3D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data) { glad_lazy_resolve(122); glad_glCompressedTexImage3D(target, level, internalformat, width, height, depth, border, imageSize, data); }
+static void APIENTRY glad_lazy_glCompressedTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data) { glad_lazy_resolve(123); glad_glCompressedTexSubImage1D(target, level, xoffset, width, format, imageSize, data); }
+static void APIENTRY glad_lazy_glCompressedTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data) { glad_lazy_resolve(124); glad_glCompressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format, imageSize, data); }
+static void APIENTRY glad_lazy_glCompressedTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data) { glad_lazy_resolve(125); glad_glCompressedTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data); }
+static void APIENTRY glad_lazy_glCompressedTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data) { glad_lazy_resolve(126); glad_glCompressedTextureSubImage1D(texture, level, xoffset, width, format, imageSize, data); }
+static void APIENTRY glad_lazy_glCompressedTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data) { glad_lazy_resolve(127); glad_glCompressedTextureSubImage2D(texture, level, xoffset, yoffset, width, height, format, imageSize, data); }
+static void APIENTRY glad_lazy_glCompressedTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data) { glad_lazy_resolve(128); glad_glCompressedTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data); }
+static void APIENTRY glad_lazy_glCopyBufferSubData(GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) { glad_lazy_resolve(129); glad_glCopyBufferSubData(readTarget, writeTarget, readOffset, writeOffset, size); }
+static void APIENTRY glad_lazy_glCopyImageSubData(GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth) { glad_lazy_resolve(130); glad_glCopyImageSubData(srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth); }
+static void APIENTRY glad_lazy_glCopyNamedBufferSubData(GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) { glad_lazy_resolve(131); glad_glCopyNamedBufferSubData(readBuffer, writeBuffer, readOffset, writeOffset, size); }
+static void APIENTRY glad_lazy_glCopyPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum type) { glad_lazy_resolve(132); glad_glCopyPixels(x, y, width, height, type); }
+static void APIENTRY glad_lazy_glCopyTexImage1D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border) { glad_lazy_resolve(133); glad_glCopyTexImage1D(target, level, internalformat, x, y, width, border); }
+static void APIENTRY glad_lazy_glCopyTexImage2D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border) { glad_lazy_resolve(134); glad_glCopyTexImage2D(target, level, internalformat, x, y, width, height, border); }
+static void APIENTRY glad_lazy_glCopyTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width) { glad_lazy_resolve(135); glad_glCopyTexSubImage1D(target, level, xoffset, x, y, width); }
+static void APIENTRY glad_lazy_glCopyTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) { glad_lazy_resolve(136); glad_glCopyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height); }
+static void APIENTRY glad_lazy_glCopyTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) { glad_lazy_resolve(137); glad_glCopyTexSubImage3D(target, level, xoffset, yoffset, zoffset, x, y, width, height); }
+static void APIENTRY glad_lazy_glCopyTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width) { glad_lazy_resolve(138); glad_glCopyTextureSubImage1D(texture, level, xoffset, x, y, width); }
+static void APIENTRY glad_lazy_glCopyTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) { glad_lazy_resolve(139); glad_glCopyTextureSubImage2D(texture, level, xoffset, yoffset, x, y, width, height); }
+static void APIENTRY glad_lazy_glCopyTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) { glad_lazy_resolve(140); glad_glCopyTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, x, y, width, height); }
+static void APIENTRY glad_lazy_glCreateBuffers(GLsizei n, GLuint *buffers) { glad_lazy_resolve(141); glad_glCreateBuffers(n, buffers); }
+static void APIENTRY glad_lazy_glCreateFramebuffers(GLsizei n, GLuint *framebuffers) { glad_lazy_resolve(142); glad_glCreateFramebuffers(n, framebuffers); }
+static GLuint APIENTRY glad_lazy_glCreateProgram(void) { glad_lazy_resolve(143); return glad_glCreateProgram(); }
+static void APIENTRY glad_lazy_glCreateProgramPipelines(GLsizei n, GLuint *pipelines) { glad_lazy_resolve(144); glad_glCreateProgramPipelines(n, pipelines); }
+static void APIENTRY glad_lazy_glCreateQueries(GLenum target, GLsizei n, GLuint *ids) { glad_lazy_resolve(145); glad_glCreateQueries(target, n, ids); }
+static void APIENTRY glad_lazy_glCreateRenderbuffers(GLsizei n, GLuint *renderbuffers) { glad_lazy_resolve(146); glad_glCreateRenderbuffers(n, renderbuffers); }
+static void APIENTRY glad_lazy_glCreateSamplers(GLsizei n, GLuint *samplers) { glad_lazy_resolve(147); glad_glCreateSamplers(n, samplers); }
+static GLuint APIENTRY glad_lazy_glCreateShader(GLenum type) { glad_lazy_resolve(148); return glad_glCreateShader(type); }
+static GLuint APIENTRY glad_lazy_glCreateShaderProgramv(GLenum type, GLsizei count, const GLchar *const*strings) { glad_lazy_resolve(149); return glad_glCreateShaderProgramv(type, count, strings); }
+static void APIENTRY glad_lazy_glCreateTextures(GLenum target, GLsizei n, GLuint *textures) { glad_lazy_resolve(150); glad_glCreateTextures(target, n, textures); }
+static void APIENTRY glad_lazy_glCreateTransformFeedbacks(GLsizei n, GLuint *ids) { glad_lazy_resolve(151); glad_glCreateTransformFeedbacks(n, ids); }
+static void APIENTRY glad_lazy_glCreateVertexArrays(GLsizei n, GLuint *arrays) { glad_lazy_resolve(152); glad_glCreateVertexArrays(n, arrays); }
+static void APIENTRY glad_lazy_glCullFace(GLenum mode) { glad_lazy_resolve(153); glad_glCullFace(mode); }
+static void APIENTRY glad_lazy_glDebugMessageCallback(GLDEBUGPROC callback, const void *userParam) { glad_lazy_resolve(154); glad_glDebugMessageCallback(callback, userParam); }
+static void APIENTRY glad_lazy_glDebugMessageControl(GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled) { glad_lazy_resolve(155); glad_glDebugMessageControl(source, type, severity, count, ids, enabled); }
+static void APIENTRY glad_lazy_glDebugMessageInsert(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *buf) { glad_lazy_resolve(156); glad_glDebugMessageInsert(source, type, id, severity, length, buf); }
+static void APIENTRY glad_lazy_glDeleteBuffers(GLsizei n, const GLuint *buffers) { glad_lazy_resolve(157); glad_glDeleteBuffers(n, buffers); }
+static void APIENTRY glad_lazy_glDeleteFramebuffers(GLsizei n, const GLuint *framebuffers) { glad_lazy_resolve(158); glad_glDeleteFramebuffers(n, framebuffers); }
+static void APIENTRY glad_lazy_glDeleteLists(GLuint list, GLsizei range) { glad_lazy_resolve(159); glad_glDeleteLists(list, range); }
+static void APIENTRY glad_lazy_glDeleteProgram(GLuint program) { glad_lazy_resolve(160); glad_glDeleteProgram(program); }
+static void APIENTRY glad_lazy_glDeleteProgramPipelines(GLsizei n, const GLuint *pipelines) { glad_lazy_resolve(161); glad_glDeleteProgramPipelines(n, pipelines); }
+static void APIENTRY glad_lazy_glDeleteQueries(GLsizei n, const GLuint *ids) { glad_lazy_resolve(162); glad_glDeleteQueries(n, ids); }
+static void APIENTRY glad_lazy_glDeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers) { glad_lazy_resolve(163); glad_glDeleteRenderbuffers(n, renderbuffers); }
+static void APIENTRY glad_lazy_glDeleteSamplers(GLsizei count, const GLuint *samplers) { glad_lazy_resolve(164); glad_glDeleteSamplers(count, samplers); }
+static void APIENTRY glad_lazy_glDeleteShader(GLuint shader) { glad_lazy_resolve(165); glad_glDeleteShader(shader); }
+static void APIENTRY glad_lazy_glDeleteSync(GLsync sync) { glad_lazy_resolve(166); glad_glDeleteSync(sync); }
+static void APIENTRY glad_lazy_glDeleteTextures(GLsizei n, const GLuint *textures) { glad_lazy_resolve(167); glad_glDeleteTextures(n, textures); }
+static void APIENTRY glad_lazy_glDeleteTransformFeedbacks(GLsizei n, const GLuint *ids) { glad_lazy_resolve(168); glad_glDeleteTransformFeedbacks(n, ids); }
+static void APIENTRY glad_lazy_glDeleteVertexArrays(GLsizei n, const GLuint *arrays) { glad_lazy_resolve(169); glad_glDeleteVertexArrays(n, arrays); }
+static void APIENTRY glad_lazy_glDepthFunc(GLenum func) { glad_lazy_resolve(170); glad_glDepthFunc(func); }
+static void APIENTRY glad_lazy_glDepthMask(GLboolean flag) { glad_lazy_resolve(171); glad_glDepthMask(flag); }
+static void APIENTRY glad_lazy_glDepthRange(GLdouble n, GLdouble f) { glad_lazy_resolve(172); glad_glDepthRange(n, f); }
+static void APIENTRY glad_lazy_glDepthRangeArrayv(GLuint first, GLsizei count, const GLdouble *v) { glad_lazy_resolve(173); glad_glDepthRangeArrayv(first, count, v); }
+static void APIENTRY glad_lazy_glDepthRangeIndexed(GLuint index, GLdouble n, GLdouble f) { glad_lazy_resolve(174); glad_glDepthRangeIndexed(index, n, f); }
+static void APIENTRY glad_lazy_glDepthRangef(GLfloat n, GLfloat f) { glad_lazy_resolve(175); glad_glDepthRangef(n, f); }
+static void APIENTRY glad_lazy_glDetachShader(GLuint program, GLuint shader) { glad_lazy_resolve(176); glad_glDetachShader(program, shader); }
+static void APIENTRY glad_lazy_glDisable(GLenum cap) { glad_lazy_resolve(177); glad_glDisable(cap); }
+static void APIENTRY glad_lazy_glDisableClientState(GLenum array) { glad_lazy_resolve(178); glad_glDisableClientState(array); }
+static void APIENTRY glad_lazy_glDisableVertexArrayAttrib(GLuint vaobj, GLuint index) { glad_lazy_resolve(179); glad_glDisableVertexArrayAttrib(vaobj, index); }
+static void APIENTRY glad_lazy_glDisableVertexAttribArray(GLuint index) { glad_lazy_resolve(180); glad_glDisableVertexAttribArray(index); }
+static void APIENTRY glad_lazy_glDisablei(GLenum target, GLuint index) { glad_lazy_resolve(181); glad_glDisablei(target, index); }
+static void APIENTRY glad_lazy_glDispatchCompute(GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z) { glad_lazy_resolve(182); glad_glDispatchCompute(num_groups_x, num_groups_y, num_groups_z); }
+static void APIENTRY glad_lazy_glDispatchComputeIndirect(GLintptr indirect) { glad_lazy_resolve(183); glad_glDispatchComputeIndirect(indirect); }
+static void APIENTRY glad_lazy_glDrawArrays(GLenum mode, GLint first, GLsizei count) { glad_lazy_resolve(184); glad_glDrawArrays(mode, first, count); }
+static void APIENTRY glad_lazy_glDrawArraysIndirect(GLenum mode, const void *indirect) { glad_lazy_resolve(185); glad_glDrawArraysIndirect(mode, indirect); }
+static void APIENTRY glad_lazy_glDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount) { glad_lazy_resolve(186); glad_glDrawArraysInstanced(mode, first, count, instancecount); }
+static void APIENTRY glad_lazy_glDrawArraysInstancedBaseInstance(GLenum mode, GLint first, GLsizei count, GLsizei instancecount, GLuint baseinstance) { glad_lazy_resolve(187); glad_glDrawArraysInstancedBaseInstance(mode, first, count, instancecount, baseinstance); }
+static void APIENTRY glad_lazy_glDrawBuffer(GLenum buf) { glad_lazy_resolve(188); glad_glDrawBuffer(buf); }
+static void APIENTRY glad_lazy_glDrawBuffers(GLsizei n, const GLenum *bufs) { glad_lazy_resolve(189); glad_glDrawBuffers(n, bufs); }
+static void APIENTRY glad_lazy_glDrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices) { glad_lazy_resolve(190); glad_glDrawElements(mode, count, type, indices); }
+static void APIENTRY glad_lazy_glDrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex) { glad_lazy_resolve(191); glad_glDrawElementsBaseVertex(mode, count, type, indices, basevertex); }
+static void APIENTRY glad_lazy_glDrawElementsIndirect(GLenum mode, GLenum type, const void *indirect) { glad_lazy_resolve(192); glad_glDrawElementsIndirect(mode, type, indirect); }
+static void APIENTRY glad_lazy_glDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount) { glad_lazy_resolve(193); glad_glDrawElementsInstanced(mode, count, type, indices, instancecount); }
+static void APIENTRY glad_lazy_glDrawElementsInstancedBaseInstance(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLuint baseinstance) { glad_lazy_resolve(194); glad_glDrawElementsInstancedBaseInstance(mode, count, type, indices, instancecount, baseinstance); }
+static void APIENTRY glad_lazy_glDrawElementsInstancedBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex) { glad_lazy_resolve(195); glad_glDrawElementsInstancedBaseVertex(mode, count, type, indices, instancecount, basevertex); }
+static void APIENTRY glad_lazy_glDrawElementsInstancedBaseVertexBaseInstance(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex, GLuint baseinstance) { glad_lazy_resolve(196); glad_glDrawElementsInstancedBaseVertexBaseInstance(mode, count, type, indices, instancecount, basevertex, baseinstance); }
+static void APIENTRY glad_lazy_glDrawPixels(GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) { glad_lazy_resolve(197); glad_glDrawPixels(width, height, format, type, pixels); }
+static void APIENTRY glad_lazy_glDrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices) { glad_lazy_resolve(198); glad_glDrawRangeElements(mode, start, end, count, type, indices); }
+static void APIENTRY glad_lazy_glDrawRangeElementsBaseVertex(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex) { glad_lazy_resolve(199); glad_glDrawRangeElementsBaseVertex(mode, start, end, count, type, indices, basevertex); }
+static void APIENTRY glad_lazy_glDrawTransformFeedback(GLenum mode, GLuint id) { glad_lazy_resolve(200); glad_glDrawTransformFeedback(mode, id); }
+static void APIENTRY glad_lazy_glDrawTransformFeedbackInstanced(GLenum mode, GLuint id, GLsizei instancecount) { glad_lazy_resolve(201); glad_glDrawTransformFeedbackInstanced(mode, id, instancecount); }
+static void APIENTRY glad_lazy_glDrawTransformFeedbackStream(GLenum mode, GLuint id, GLuint stream) { glad_lazy_resolve(202); glad_glDrawTransformFeedbackStream(mode, id, stream); }
+static void APIENTRY glad_lazy_glDrawTransformFeedbackStreamInstanced(GLenum mode, GLuint id, GLuint stream, GLsizei instancecount) { glad_lazy_resolve(203); glad_glDrawTransformFeedbackStreamInstanced(mode, id, stream, instancecount); }
+static void APIENTRY glad_lazy_glEdgeFlag(GLboolean flag) { glad_lazy_resolve(204); glad_glEdgeFlag(flag); }
+static void APIENTRY glad_lazy_glEdgeFlagPointer(GLsizei stride, const void *pointer) { glad_lazy_resolve(205); glad_glEdgeFlagPointer(stride, pointer); }
+static void APIENTRY glad_lazy_glEdgeFlagv(const GLboolean *flag) { glad_lazy_resolve(206); glad_glEdgeFlagv(flag); }
+static void APIENTRY glad_lazy_glEnable(GLenum cap) { glad_lazy_resolve(207); glad_glEnable(cap); }
+static void APIENTRY glad_lazy_glEnableClientState(GLenum array) { glad_lazy_resolve(208); glad_glEnableClientState(array); }
+static void APIENTRY glad_lazy_glEnableVertexArrayAttrib(GLuint vaobj, GLuint index) { glad_lazy_resolve(209); glad_glEnableVertexArrayAttrib(vaobj, index); }
+static void APIENTRY glad_lazy_glEnableVertexAttribArray(GLuint index) { glad_lazy_resolve(210); glad_glEnableVertexAttribArray(index); }
+static void APIENTRY glad_lazy_glEnablei(GLenum target, GLuint index) { glad_lazy_resolve(211); glad_glEnablei(target, index); }
+static void APIENTRY glad_lazy_glEnd(void) { glad_lazy_resolve(212); glad_glEnd(); }
+static void APIENTRY glad_lazy_glEndConditionalRender(void) { glad_lazy_resolve(213); glad_glEndConditionalRender(); }
+static void APIENTRY glad_lazy_glEndList(void) { glad_lazy_resolve(214); glad_glEndList(); }
+static void APIENTRY glad_lazy_glEndQuery(GLenum target) { glad_lazy_resolve(215); glad_glEndQuery(target); }
+static void APIENTRY glad_lazy_glEndQueryIndexed(GLenum target, GLuint index) { glad_lazy_resolve(216); glad_glEndQueryIndexed(target, index); }
+static void APIENTRY glad_lazy_glEndTransformFeedback(void) { glad_lazy_resolve(217); glad_glEndTransformFeedback(); }
+static void APIENTRY glad_lazy_glEvalCoord1d(GLdouble u) { glad_lazy_resolve(218); glad_glEvalCoord1d(u); }
+static void APIENTRY glad_lazy_glEvalCoord1dv(const GLdouble *u) { glad_lazy_resolve(219); glad_glEvalCoord1dv(u); }
+static void APIENTRY glad_lazy_glEvalCoord1f(GLfloat u) { glad_lazy_resolve(220); glad_glEvalCoord1f(u); }
+static void APIENTRY glad_lazy_glEvalCoord1fv(const GLfloat *u) { glad_lazy_resolve(221); glad_glEvalCoord1fv(u); }
+static void APIENTRY glad_lazy_glEvalCoord2d(GLdouble u, GLdouble v) { glad_lazy_resolve(222); glad_glEvalCoord2d(u, v); }
+static void APIENTRY glad_lazy_glEvalCoord2dv(const GLdouble *u) { glad_lazy_resolve(223); glad_glEvalCoord2dv(u); }
+static void APIENTRY glad_lazy_glEvalCoord2f(GLfloat u, GLfloat v) { glad_lazy_resolve(224); glad_glEvalCoord2f(u, v); }
+static void APIENTRY glad_lazy_glEvalCoord2fv(const GLfloat *u) { glad_lazy_resolve(225); glad_glEvalCoord2fv(u); }
+static void APIENTRY glad_lazy_glEvalMesh1(GLenum mode, GLint i1, GLint i2) { glad_lazy_resolve(226); glad_glEvalMesh1(mode, i1, i2); }
+static void APIENTRY glad_lazy_glEvalMesh2(GLenum mode, GLint i1, GLint i2, GLint j1, GLint j2) { glad_lazy_resolve(227); glad_glEvalMesh2(mode, i1, i2, j1, j2); }
+static void APIENTRY glad_lazy_glEvalPoint1(GLint i) { glad_lazy_resolve(228); glad_glEvalPoint1(i); }
+static void APIENTRY glad_lazy_glEvalPoint2(GLint i, GLint j) { glad_lazy_resolve(229); glad_glEvalPoint2(i, j); }
+static void APIENTRY glad_lazy_glFeedbackBuffer(GLsizei size, GLenum type, GLfloat *buffer) { glad_lazy_resolve(230); glad_glFeedbackBuffer(size, type, buffer); }
+static GLsync APIENTRY glad_lazy_glFenceSync(GLenum condition, GLbitfield flags) { glad_lazy_resolve(231); return glad_glFenceSync(condition, flags); }
+static void APIENTRY glad_lazy_glFinish(void) { glad_lazy_resolve(232); glad_glFinish(); }
+static void APIENTRY glad_lazy_glFlush(void) { glad_lazy_resolve(233); glad_glFlush(); }
+static void APIENTRY glad_lazy_glFlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length) { glad_lazy_resolve(234); glad_glFlushMappedBufferRange(target, offset, length); }
+static void APIENTRY glad_lazy_glFlushMappedNamedBufferRange(GLuint buffer, GLintptr offset, GLsizeiptr length) { glad_lazy_resolve(235); glad_glFlushMappedNamedBufferRange(buffer, offset, length); }
+static void APIENTRY glad_lazy_glFogCoordPointer(GLenum type, GLsizei stride, const void *pointer) { glad_lazy_resolve(236); glad_glFogCoordPointer(type, stride, pointer); }
+static void APIENTRY glad_lazy_glFogCoordd(GLdouble coord) { glad_lazy_resolve(237); glad_glFogCoordd(coord); }
+static void APIENTRY glad_lazy_glFogCoorddv(const GLdouble *coord) { glad_lazy_resolve(238); glad_glFogCoorddv(coord); }
+static void APIENTRY glad_lazy_glFogCoordf(GLfloat coord) { glad_lazy_resolve(239); glad_glFogCoordf(coord); }
+static void APIENTRY glad_lazy_glFogCoordfv(const GLfloat *coord) { glad_lazy_resolve(240); glad_glFogCoordfv(coord); }
+static void APIENTRY glad_lazy_glFogf(GLenum pname, GLfloat param) { glad_lazy_resolve(241); glad_glFogf(pname, param); }
+static void APIENTRY glad_lazy_glFogfv(GLenum pname, const GLfloat *params) { glad_lazy_resolve(242); glad_glFogfv(pname, params); }
+static void APIENTRY glad_lazy_glFogi(GLenum pname, GLint param) { glad_lazy_resolve(243); glad_glFogi(pname, param); }
+static void APIENTRY glad_lazy_glFogiv(GLenum pname, const GLint *params) { glad_lazy_resolve(244); glad_glFogiv(pname, params); }
+static void APIENTRY glad_lazy_glFramebufferParameteri(GLenum target, GLenum pname, GLint param) { glad_lazy_resolve(245); glad_glFramebufferParameteri(target, pname, param); }
+static void APIENTRY glad_lazy_glFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) { glad_lazy_resolve(246); glad_glFramebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer); }
+static void APIENTRY glad_lazy_glFramebufferTexture(GLenum target, GLenum attachment, GLuint texture, GLint level) { glad_lazy_resolve(247); glad_glFramebufferTexture(target, attachment, texture, level); }
+static void APIENTRY glad_lazy_glFramebufferTexture1D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) { glad_lazy_resolve(248); glad_glFramebufferTexture1D(target, attachment, textarget, texture, level); }
+static void APIENTRY glad_lazy_glFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) { glad_lazy_resolve(249); glad_glFramebufferTexture2D(target, attachment, textarget, texture, level); }
+static void APIENTRY glad_lazy_glFramebufferTexture3D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset) { glad_lazy_resolve(250); glad_glFramebufferTexture3D(target, attachment, textarget, texture, level, zoffset); }
+static void APIENTRY glad_lazy_glFramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer) { glad_lazy_resolve(251); glad_glFramebufferTextureLayer(target, attachment, texture, level, layer); }
+static void APIENTRY glad_lazy_glFrontFace(GLenum mode) { glad_lazy_resolve(252); glad_glFrontFace(mode); }
+static void APIENTRY glad_lazy_glFrustum(GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar) { glad_lazy_resolve(253); glad_glFrustum(left, right, bottom, top, zNear, zFar); }
+static void APIENTRY glad_lazy_glGenBuffers(GLsizei n, GLuint *buffers) { glad_lazy_resolve(254); glad_glGenBuffers(n, buffers); }
+static void APIENTRY glad_lazy_glGenFramebuffers(GLsizei n, GLuint *framebuffers) { glad_lazy_resolve(255); glad_glGenFramebuffers(n, framebuffers); }
+static GLuint APIENTRY glad_lazy_glGenLists(GLsizei range) { glad_lazy_resolve(256); return glad_glGenLists(range); }
+static void APIENTRY glad_lazy_glGenProgramPipelines(GLsizei n, GLuint *pipelines) { glad_lazy_resolve(257); glad_glGenProgramPipelines(n, pipelines); }
+static void APIENTRY glad_lazy_glGenQueries(GLsizei n, GLuint *ids) { glad_lazy_resolve(258); glad_glGenQueries(n, ids); }
+static void APIENTRY glad_lazy_glGenRenderbuffers(GLsizei n, GLuint *renderbuffers) { glad_lazy_resolve(259); glad_glGenRenderbuffers(n, renderbuffers); }
+static void APIENTRY glad_lazy_glGenSamplers(GLsizei count, GLuint *samplers) { glad_lazy_resolve(260); glad_glGenSamplers(count, samplers); }
+static void APIENTRY glad_lazy_glGenTextures(GLsizei n, GLuint *textures) { glad_lazy_resolve(261); glad_glGenTextures(n, textures); }
+static void APIENTRY glad_lazy_glGenTransformFeedbacks(GLsizei n, GLuint *ids) { glad_lazy_resolve(262); glad_glGenTransformFeedbacks(n, ids); }
+static void APIENTRY glad_lazy_glGenVertexArrays(GLsizei n, GLuint *arrays) { glad_lazy_resolve(263); glad_glGenVertexArrays(n, arrays); }
+static void APIENTRY glad_lazy_glGenerateMipmap(GLenum target) { glad_lazy_resolve(264); glad_glGenerateMipmap(target); }
+static void APIENTRY glad_lazy_glGenerateTextureMipmap(GLuint texture) { glad_lazy_resolve(265); glad_glGenerateTextureMipmap(texture); }
+static void APIENTRY glad_lazy_glGetActiveAtomicCounterBufferiv(GLuint program, GLuint bufferIndex, GLenum pname, GLint *params) { glad_lazy_resolve(266); glad_glGetActiveAtomicCounterBufferiv(program, bufferIndex, pname, params); }
+static void APIENTRY glad_lazy_glGetActiveAttrib(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) { glad_lazy_resolve(267); glad_glGetActiveAttrib(program, index, bufSize, length, size, type, name); }
+static void APIENTRY glad_lazy_glGetActiveSubroutineName(GLuint program, GLenum shadertype, GLuint index, GLsizei bufsize, GLsizei *length, GLchar *name) { glad_lazy_resolve(268); glad_glGetActiveSubroutineName(program, shadertype, index, bufsize, length, name); }
+static void APIENTRY glad_lazy_glGetActiveSubroutineUniformName(GLuint program, GLenum shadertype, GLuint index, GLsizei bufsize, GLsizei *length, GLchar *name) { glad_lazy_resolve(269); glad_glGetActiveSubroutineUniformName(program, shadertype, index, bufsize, length, name); }
+static void APIENTRY glad_lazy_glGetActiveSubroutineUniformiv(GLuint program, GLenum shadertype, GLuint index, GLenum pname, GLint *values) { glad_lazy_resolve(270); glad_glGetActiveSubroutineUniformiv(program, shadertype, index, pname, values); }
+static void APIENTRY glad_lazy_glGetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) { glad_lazy_resolve(271); glad_glGetActiveUniform(program, index, bufSize, length, size, type, name); }
+static void APIENTRY glad_lazy_glGetActiveUniformBlockName(GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName) { glad_lazy_resolve(272); glad_glGetActiveUniformBlockName(program, uniformBlockIndex, bufSize, length, uniformBlockName); }
+static void APIENTRY glad_lazy_glGetActiveUniformBlockiv(GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params) { glad_lazy_resolve(273); glad_glGetActiveUniformBlockiv(program, uniformBlockIndex, pname, params); }
+static void APIENTRY glad_lazy_glGetActiveUniformName(GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName) { glad_lazy_resolve(274); glad_glGetActiveUniformName(program, uniformIndex, bufSize, length, uniformName); }
+static void APIENTRY glad_lazy_glGetActiveUniformsiv(GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params) { glad_lazy_resolve(275); glad_glGetActiveUniformsiv(program, uniformCount, uniformIndices, pname, params); }
+static void APIENTRY glad_lazy_glGetAttachedShaders(GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders) { glad_lazy_resolve(276); glad_glGetAttachedShaders(program, maxCount, count, shaders); }
+static GLint APIENTRY glad_lazy_glGetAttribLocation(GLuint program, const GLchar *name) { glad_lazy_resolve(277); return glad_glGetAttribLocation(program, name); }
+static void APIENTRY glad_lazy_glGetBooleani_v(GLenum target, GLuint index, GLboolean *data) { glad_lazy_resolve(278); glad_glGetBooleani_v(target, index, data); }
+static void APIENTRY glad_lazy_glGetBooleanv(GLenum pname, GLboolean *data) { glad_lazy_resolve(279); glad_glGetBooleanv(pname, data); }
+static void APIENTRY glad_lazy_glGetBufferParameteri64v(GLenum target, GLenum pname, GLint64 *params) { glad_lazy_resolve(280); glad_glGetBufferParameteri64v(target, pname, params); }
+static void APIENTRY glad_lazy_glGetBufferParameteriv(GLenum target, GLenum pname, GLint *params) { glad_lazy_resolve(281); glad_glGetBufferParameteriv(target, pname, params); }
+static void APIENTRY glad_lazy_glGetBufferPointerv(GLenum target, GLenum pname, void **params) { glad_lazy_resolve(282); glad_glGetBufferPointerv(target, pname, params); }
+static void APIENTRY glad_lazy_glGetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, void *data) { glad_lazy_resolve(283); glad_glGetBufferSubData(target, offset, size, data); }
+static void APIENTRY glad_lazy_glGetClipPlane(GLenum plane, GLdouble *equation) { glad_lazy_resolve(284); glad_glGetClipPlane(plane, equation); }
+static void APIENTRY glad_lazy_glGetCompressedTexImage(GLenum target, GLint level, void *img) { glad_lazy_resolve(285); glad_glGetCompressedTexImage(target, level, img); }
+static void APIENTRY glad_lazy_glGetCompressedTextureImage(GLuint texture, GLint level, GLsizei bufSize, void *pixels) { glad_lazy_resolve(286); glad_glGetCompressedTextureImage(texture, level, bufSize, pixels); }
+static void APIENTRY glad_lazy_glGetCompressedTextureSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLsizei bufSize, void *pixels) { glad_lazy_resolve(287); glad_glGetCompressedTextureSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, bufSize, pixels); }
+static GLuint APIENTRY glad_lazy_glGetDebugMessageLog(GLuint count, GLsizei bufSize, GLenum *sources, GLenum *types, GLuint *ids, GLenum *severities, GLsizei *lengths, GLchar *messageLog) { glad_lazy_resolve(288); return glad_glGetDebugMessageLog(count, bufSize, sources, types, ids, severities, lengths, messageLog); }
+static void APIENTRY glad_lazy_glGetDoublei_v(GLenum target, GLuint index, GLdouble *data) { glad_lazy_resolve(289); glad_glGetDoublei_v(target, index, data); }
+static void APIENTRY glad_lazy_glGetDoublev(GLenum pname, GLdouble *data) { glad_lazy_resolve(290); glad_glGetDoublev(pname, data); }
+static GLenum APIENTRY glad_lazy_glGetError(void) { glad_lazy_resolve(291); return glad_glGetError(); }
+static void APIENTRY glad_lazy_glGetFloati_v(GLenum target, GLuint index, GLfloat *data) { glad_lazy_resolve(292); glad_glGetFloati_v(target, index, data); }
+static void APIENTRY glad_lazy_glGetFloatv(GLenum pname, GLfloat *data) { glad_lazy_resolve(293); glad_glGetFloatv(pname, data); }
+static GLint APIENTRY glad_lazy_glGetFragDataIndex(GLuint program, const GLchar *name) { glad_lazy_resolve(294); return glad_glGetFragDataIndex(program, name); }
+static GLint APIENTRY glad_lazy_glGetFragDataLocation(GLuint program, const GLchar *name) { glad_lazy_resolve(295); return glad_glGetFragDataLocation(program, name); }
+static void APIENTRY glad_lazy_glGetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint *params) { glad_lazy_resolve(296); glad_glGetFramebufferAttachmentParameteriv(target, attachment, pname, params); }
+static void APIENTRY glad_lazy_glGetFramebufferParameteriv(GLenum target, GLenum pname, GLint *params) { glad_lazy_resolve(297); glad_glGetFramebufferParameteriv(target, pname, params); }
+static GLenum APIENTRY glad_lazy_glGetGraphicsResetStatus(void) { glad_lazy_resolve(298); return glad_glGetGraphicsResetStatus(); }
+static void APIENTRY glad_lazy_glGetInteger64i_v(GLenum target, GLuint index, GLint64 *data) { glad_lazy_resolve(299); glad_glGetInteger64i_v(target, index, data); }
+static void APIENTRY glad_lazy_glGetInteger64v(GLenum pname, GLint64 *data) { glad_lazy_resolve(300); glad_glGetInteger64v(pname, data); }
+static void APIENTRY glad_lazy_glGetIntegeri_v(GLenum target, GLuint index, GLint *data) { glad_lazy_resolve(301); glad_glGetIntegeri_v(target, index, data); }
+static void APIENTRY glad_lazy_glGetIntegerv(GLenum pname, GLint *data) { glad_lazy_resolve(302); glad_glGetIntegerv(pname, data); }
+static void APIENTRY glad_lazy_glGetInternalformati64v(GLenum target, GLenum internalformat, GLenum pname, GLsizei bufSize, GLint64 *params) { glad_lazy_resolve(303); glad_glGetInternalformati64v(target, internalformat, pname, bufSize, params); }
+static void APIENTRY glad_lazy_glGetInternalformativ(GLenum target, GLenum internalformat, GLenum pname, GLsizei bufSize, GLint *params) { glad_lazy_resolve(304); glad_glGetInternalformativ(target, internalformat, pname, bufSize, params); }
+static void APIENTRY glad_lazy_glGetLightfv(GLenum light, GLenum pname, GLfloat *params) { glad_lazy_resolve(305); glad_glGetLightfv(light, pname, params); }
+static void APIENTRY glad_lazy_glGetLightiv(GLenum light, GLenum pname, GLint *params) { glad_lazy_resolve(306); glad_glGetLightiv(light, pname, params); }
+static void APIENTRY glad_lazy_glGetMapdv(GLenum target, GLenum query, GLdouble *v) { glad_lazy_resolve(307); glad_glGetMapdv(target, query, v); }
+static void APIENTRY glad_lazy_glGetMapfv(GLenum target, GLenum query, GLfloat *v) { glad_lazy_resolve(308); glad_glGetMapfv(target, query, v); }
+static void APIENTRY glad_lazy_glGetMapiv(GLenum target, GLenum query, GLint *v) { glad_lazy_resolve(309); glad_glGetMapiv(target, query, v); }
+static void APIENTRY glad_lazy_glGetMaterialfv(GLenum face, GLenum pname, GLfloat *params) { glad_lazy_resolve(310); glad_glGetMaterialfv(face, pname, params); }
+static void APIENTRY glad_lazy_glGetMaterialiv(GLenum face, GLenum pname, GLint *params) { glad_lazy_resolve(311); glad_glGetMaterialiv(face, pname, params); }
+static void APIENTRY glad_lazy_glGetMultisamplefv(GLenum pname, GLuint index, GLfloat *val) { glad_lazy_resolve(312); glad_glGetMultisamplefv(pname, index, val); }
+static void APIENTRY glad_lazy_glGetNamedBufferParameteri64v(GLuint buffer, GLenum pname, GLint64 *params) { glad_lazy_resolve(313); glad_glGetNamedBufferParameteri64v(buffer, pname, params); }
+static void APIENTRY glad_lazy_glGetNamedBufferParameteriv(GLuint buffer, GLenum pname, GLint *params) { glad_lazy_resolve(314); glad_glGetNamedBufferParameteriv(buffer, pname, params); }
+static void APIENTRY glad_lazy_glGetNamedBufferPointerv(GLuint buffer, GLenum pname, void **params) { glad_lazy_resolve(315); glad_glGetNamedBufferPointerv(buffer, pname, params); }
+static void APIENTRY glad_lazy_glGetNamedBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr size, void *data) { glad_lazy_resolve(316); glad_glGetNamedBufferSubData(buffer, offset, size, data); }
+static void APIENTRY glad_lazy_glGetNamedFramebufferAttachmentParameteriv(GLuint framebuffer, GLenum attachment, GLenum pname, GLint *params) { glad_lazy_resolve(317); glad_glGetNamedFramebufferAttachmentParameteriv(framebuffer, attachment, pname, params); }
+static void APIENTRY glad_lazy_glGetNamedFramebufferParameteriv(GLuint framebuffer, GLenum pname, GLint *param) { glad_lazy_resolve(318); glad_glGetNamedFramebufferParameteriv(framebuffer, pname, param); }
+static void APIENTRY glad_lazy_glGetNamedRenderbufferParameteriv(GLuint renderbuffer, GLenum pname, GLint *params) { glad_lazy_resolve(319); glad_glGetNamedRenderbufferParameteriv(renderbuffer, pname, params); }
+static void APIENTRY glad_lazy_glGetObjectLabel(GLenum identifier, GLuint name, GLsizei bufSize, GLsizei *length, GLchar *label) { glad_lazy_resolve(320); glad_glGetObjectLabel(identifier, name, bufSize, length, label); }
+static void APIENTRY glad_lazy_glGetObjectPtrLabel(const void *ptr, GLsizei bufSize, GLsizei *length, GLchar *label) { glad_lazy_resolve(321); glad_glGetObjectPtrLabel(ptr, bufSize, length, label); }
+static void APIENTRY glad_lazy_glGetPixelMapfv(GLenum map, GLfloat *values) { glad_lazy_resolve(322); glad_glGetPixelMapfv(map, values); }
+static void APIENTRY glad_lazy_glGetPixelMapuiv(GLenum map, GLuint *values) { glad_lazy_resolve(323); glad_glGetPixelMapuiv(map, values); }
+static void APIENTRY glad_lazy_glGetPixelMapusv(GLenum map, GLushort *values) { glad_lazy_resolve(324); glad_glGetPixelMapusv(map, values); }
+static void APIENTRY glad_lazy_glGetPointerv(GLenum pname, void **params) { glad_lazy_resolve(325); glad_glGetPointerv(pname, params); }
+static void APIENTRY glad_lazy_glGetPolygonStipple(GLubyte *mask) { glad_lazy_resolve(326); glad_glGetPolygonStipple(mask); }
+static void APIENTRY glad_lazy_glGetProgramBinary(GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary) { glad_lazy_resolve(327); glad_glGetProgramBinary(program, bufSize, length, binaryFormat, binary); }
+static void APIENTRY glad_lazy_glGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog) { glad_lazy_resolve(328); glad_glGetProgramInfoLog(program, bufSize, length, infoLog); }
+static void APIENTRY glad_lazy_glGetProgramInterfaceiv(GLuint program, GLenum programInterface, GLenum pname, GLint *params) { glad_lazy_resolve(329); glad_glGetProgramInterfaceiv(program, programInterface, pname, params); }
+static void APIENTRY glad_lazy_glGetProgramPipelineInfoLog(GLuint pipeline, GLsizei bufSize, GLsizei *length, GLchar *infoLog) { glad_lazy_resolve(330); glad_glGetProgramPipelineInfoLog(pipeline, bufSize, length, infoLog); }
+static void APIENTRY glad_lazy_glGetProgramPipelineiv(GLuint pipeline, GLenum pname, GLint *params) { glad_lazy_resolve(331); glad_glGetProgramPipelineiv(pipeline, pname, params); }
+static GLuint APIENTRY glad_lazy_glGetProgramResourceIndex(GLuint program, GLenum programInterface, const GLchar *name) { glad_lazy_resolve(332); return glad_glGetProgramResourceIndex(program, programInterface, name); }
+static GLint APIENTRY glad_lazy_glGetProgramResourceLocation(GLuint program, GLenum programInterface, const GLchar *name) { glad_lazy_resolve(333); return glad_glGetProgramResourceLocation(program, programInterface, name); }
+static GLint APIENTRY glad_lazy_glGetProgramResourceLocationIndex(GLuint program, GLenum programInterface, const GLchar *name) { glad_lazy_resolve(334); return glad_glGetProgramResourceLocationIndex(program, programInterface, name); }
+static void APIENTRY glad_lazy_glGetProgramResourceName(GLuint program, GLenum programInterface, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name) { glad_lazy_resolve(335); glad_glGetProgramResourceName(program, programInterface, index, bufSize, length, name); }
+static void APIENTRY glad_lazy_glGetProgramResourceiv(GLuint program, GLenum programInterface, GLuint index, GLsizei propCount, const GLenum *props, GLsizei bufSize, GLsizei *length, GLint *params) { glad_lazy_resolve(336); glad_glGetProgramResourceiv(program, programInterface, index, propCount, props, bufSize, length, params); }
+static void APIENTRY glad_lazy_glGetProgramStageiv(GLuint program, GLenum shadertype, GLenum pname, GLint *values) { glad_lazy_resolve(337); glad_glGetProgramStageiv(program, shadertype, pname, values); }
+static void APIENTRY glad_lazy_glGetProgramiv(GLuint program, GLenum pname, GLint *params) { glad_lazy_resolve(338); glad_glGetProgramiv(program, pname, params); }
+static void APIENTRY glad_lazy_glGetQueryBufferObjecti64v(GLuint id, GLuint buffer, GLenum pname, GLintptr offset) { glad_lazy_resolve(339); glad_glGetQueryBufferObjecti64v(id, buffer, pname, offset); }
+static void APIENTRY glad_lazy_glGetQueryBufferObjectiv(GLuint id, GLuint buffer, GLenum pname, GLintptr offset) { glad_lazy_resolve(340); glad_glGetQueryBufferObjectiv(id, buffer, pname, offset); }
+static void APIENTRY glad_lazy_glGetQueryBufferObjectui64v(GLuint id, GLuint buffer, GLenum pname, GLintptr offset) { glad_lazy_resolve(341); glad_glGetQueryBufferObjectui64v(id, buffer, pname, offset); }
+static void APIENTRY glad_lazy_glGetQueryBufferObjectuiv(GLuint id, GLuint buffer, GLenum pname, GLintptr offset) { glad_lazy_resolve(342); glad_glGetQueryBufferObjectuiv(id, buffer, pname, offset); }
+static void APIENTRY glad_lazy_glGetQueryIndexediv(GLenum target, GLuint index, GLenum pname, GLint *params) { glad_lazy_resolve(343); glad_glGetQueryIndexediv(target, index, pname, params); }
+static void APIENTRY glad_lazy_glGetQueryObjecti64v(GLuint id, GLenum pname, GLint64 *params) { glad_lazy_resolve(344); glad_glGetQueryObjecti64v(id, pname, params); }
+static void APIENTRY glad_lazy_glGetQueryObjectiv(GLuint id, GLenum pname, GLint *params) { glad_lazy_resolve(345); glad_glGetQueryObjectiv(id, pname, params); }
+static void APIENTRY glad_lazy_glGetQueryObjectui64v(GLuint id, GLenum pname, GLuint64 *params) { glad_lazy_resolve(346); glad_glGetQueryObjectui64v(id, pname, params); }
+static void APIENTRY glad_lazy_glGetQueryObjectuiv(GLuint id, GLenum pname, GLuint *params) { glad_lazy_resolve(347); glad_glGetQueryObjectuiv(id, pname, params); }
+static void APIENTRY glad_lazy_glGetQueryiv(GLenum target, GLenum pname, GLint *params) { glad_lazy_resolve(348); glad_glGetQueryiv(target, pname, params); }
+static void APIENTRY glad_lazy_glGetRenderbufferParameteriv(GLenum target, GLenum pname, GLint *params) { glad_lazy_resolve(349); glad_glGetRenderbufferParameteriv(target, pname, params); }
+static void APIENTRY glad_lazy_glGetSamplerParameterIiv(GLuint sampler, GLenum pname, GLint *params) { glad_lazy_resolve(350); glad_glGetSamplerParameterIiv(sampler, pname, params); }
+static void APIENTRY glad_lazy_glGetSamplerParameterIuiv(GLuint sampler, GLenum pname, GLuint *params) { glad_lazy_resolve(351); glad_glGetSamplerParameterIuiv(sampler, pname, params); }
+static void APIENTRY glad_lazy_glGetSamplerParameterfv(GLuint sampler, GLenum pname, GLfloat *params) { glad_lazy_resolve(352); glad_glGetSamplerParameterfv(sampler, pname, params); }
+static void APIENTRY glad_lazy_glGetSamplerParameteriv(GLuint sampler, GLenum pname, GLint *params) { glad_lazy_resolve(353); glad_glGetSamplerParameteriv(sampler, pname, params); }
+static void APIENTRY glad_lazy_glGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog) { glad_lazy_resolve(354); glad_glGetShaderInfoLog(shader, bufSize, length, infoLog); }
+static void APIENTRY glad_lazy_glGetShaderPrecisionFormat(GLenum shadertype, GLenum precisiontype, GLint *range, GLint *precision) { glad_lazy_resolve(355); glad_glGetShaderPrecisionFormat(shadertype, precisiontype, range, precision); }
+static void APIENTRY glad_lazy_glGetShaderSource(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source) { glad_lazy_resolve(356); glad_glGetShaderSource(shader, bufSize, length, source); }
+static void APIENTRY glad_lazy_glGetShaderiv(GLuint shader, GLenum pname, GLint *params) { glad_lazy_resolve(357); glad_glGetShaderiv(shader, pname, params); }
+static const GLubyte * APIENTRY glad_lazy_glGetString(GLenum name) { glad_lazy_resolve(358); return glad_glGetString(name); }
+static const GLubyte * APIENTRY glad_lazy_glGetStringi(GLenum name, GLuint index) { glad_lazy_resolve(359); return glad_glGetStringi(name, index); }
+static GLuint APIENTRY glad_lazy_glGetSubroutineIndex(GLuint program, GLenum shadertype, const GLchar *name) { glad_lazy_resolve(360); return glad_glGetSubroutineIndex(program, shadertype, name); }
+static GLint APIENTRY glad_lazy_glGetSubroutineUniformLocation(GLuint program, GLenum shadertype, const GLchar *name) { glad_lazy_resolve(361); return glad_glGetSubroutineUniformLocation(program, shadertype, name); }
+static void APIENTRY glad_lazy_glGetSynciv(GLsync sync, GLenum pname, GLsizei bufSize, GLsizei *length, GLint *values) { glad_lazy_resolve(362); glad_glGetSynciv(sync, pname, bufSize, length, values); }
+static void APIENTRY glad_lazy_glGetTexEnvfv(GLenum target, GLenum pname, GLfloat *params) { glad_lazy_resolve(363); glad_glGetTexEnvfv(target, pname, params); }
+static void APIENTRY glad_lazy_glGetTexEnviv(GLenum target, GLenum pname, GLint *params) { glad_lazy_resolve(364); glad_glGetTexEnviv(target, pname, params); }
+static void APIENTRY glad_lazy_glGetTexGendv(GLenum coord, GLenum pname, GLdouble *params) { glad_lazy_resolve(365); glad_glGetTexGendv(coord, pname, params); }
+static void APIENTRY glad_lazy_glGetTexGenfv(GLenum coord, GLenum pname, GLfloat *params) { glad_lazy_resolve(366); glad_glGetTexGenfv(coord, pname, params); }
+static void APIENTRY glad_lazy_glGetTexGeniv(GLenum coord, GLenum pname, GLint *params) { glad_lazy_resolve(367); glad_glGetTexGeniv(coord, pname, params); }
+static void APIENTRY glad_lazy_glGetTexImage(GLenum target, GLint level, GLenum format, GLenum type, void *pixels) { glad_lazy_resolve(368); glad_glGetTexImage(target, level, format, type, pixels); }
+static void APIENTRY glad_lazy_glGetTexLevelParameterfv(GLenum target, GLint level, GLenum pname, GLfloat *params) { glad_lazy_resolve(369); glad_glGetTexLevelParameterfv(target, level, pname, params); }
+static void APIENTRY glad_lazy_glGetTexLevelParameteriv(GLenum target, GLint level, GLenum pname, GLint *params) { glad_lazy_resolve(370); glad_glGetTexLevelParameteriv(target, level, pname, params); }
+static void APIENTRY glad_lazy_glGetTexParameterIiv(GLenum target, GLenum pname, GLint *params) { glad_lazy_resolve(371); glad_glGetTexParameterIiv(target, pname, params); }
+static void APIENTRY glad_lazy_glGetTexParameterIuiv(GLenum target, GLenum pname, GLuint *params) { glad_lazy_resolve(372); glad_glGetTexParameterIuiv(target, pname, params); }
+static void APIENTRY glad_lazy_glGetTexParameterfv(GLenum target, GLenum pname, GLfloat *params) { glad_lazy_resolve(373); glad_glGetTexParameterfv(target, pname, params); }
+static void APIENTRY glad_lazy_glGetTexParameteriv(GLenum target, GLenum pname, GLint *params) { glad_lazy_resolve(374); glad_glGetTexParameteriv(target, pname, params); }
+static void APIENTRY glad_lazy_glGetTextureImage(GLuint texture, GLint level, GLenum format, GLenum type, GLsizei bufSize, void *pixels) { glad_lazy_resolve(375); glad_glGetTextureImage(texture, level, format, type, bufSize, pixels); }
+static void APIENTRY glad_lazy_glGetTextureLevelParameterfv(GLuint texture, GLint level, GLenum pname, GLfloat *params) { glad_lazy_resolve(376); glad_glGetTextureLevelParameterfv(texture, level, pname, params); }
+static void APIENTRY glad_lazy_glGetTextureLevelParameteriv(GLuint texture, GLint level, GLenum pname, GLint *params) { glad_lazy_resolve(377); glad_glGetTextureLevelParameteriv(texture, level, pname, params); }
+static void APIENTRY glad_lazy_glGetTextureParameterIiv(GLuint texture, GLenum pname, GLint *params) { glad_lazy_resolve(378); glad_glGetTextureParameterIiv(texture, pname, params); }
+static void APIENTRY glad_lazy_glGetTextureParameterIuiv(GLuint texture, GLenum pname, GLuint *params) { glad_lazy_resolve(379); glad_glGetTextureParameterIuiv(texture, pname, params); }
+static void APIENTRY glad_lazy_glGetTextureParameterfv(GLuint texture, GLenum pname, GLfloat *params) { glad_lazy_resolve(380); glad_glGetTextureParameterfv(texture, pname, params); }
+static void APIENTRY glad_lazy_glGetTextureParameteriv(GLuint texture, GLenum pname, GLint *params) { glad_lazy_resolve(381); glad_glGetTextureParameteriv(texture, pname, params); }
+static void APIENTRY glad_lazy_glGetTextureSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, GLsizei bufSize, void *pixels) { glad_lazy_resolve(382); glad_glGetTextureSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, bufSize, pixels); }
+static void APIENTRY glad_lazy_glGetTransformFeedbackVarying(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name) { glad_lazy_resolve(383); glad_glGetTransformFeedbackVarying(program, index, bufSize, length, size, type, name); }
+static void APIENTRY glad_lazy_glGetTransformFeedbacki64_v(GLuint xfb, GLenum pname, GLuint index, GLint64 *param) { glad_lazy_resolve(384); glad_glGetTransformFeedbacki64_v(xfb, pname, index, param); }
+static void APIENTRY glad_lazy_glGetTransformFeedbacki_v(GLuint xfb, GLenum pname, GLuint index, GLint *param) { glad_lazy_resolve(385); glad_glGetTransformFeedbacki_v(xfb, pname, index, param); }
+static void APIENTRY glad_lazy_glGetTransformFeedbackiv(GLuint xfb, GLenum pname, GLint *param) { glad_lazy_resolve(386); glad_glGetTransformFeedbackiv(xfb, pname, param); }
+static GLuint APIENTRY glad_lazy_glGetUniformBlockIndex(GLuint program, const GLchar *uniformBlockName) { glad_lazy_resolve(387); return glad_glGetUniformBlockIndex(program, uniformBlockName); }
+static void APIENTRY glad_lazy_glGetUniformIndices(GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices) { glad_lazy_resolve(388); glad_glGetUniformIndices(program, uniformCount, uniformNames, uniformIndices); }
+static GLint APIENTRY glad_lazy_glGetUniformLocation(GLuint program, const GLchar *name) { glad_lazy_resolve(389); return glad_glGetUniformLocation(program, name); }
+static void APIENTRY glad_lazy_glGetUniformSubroutineuiv(GLenum shadertype, GLint location, GLuint *params) { glad_lazy_resolve(390); glad_glGetUniformSubroutineuiv(shadertype, location, params); }
+static void APIENTRY glad_lazy_glGetUniformdv(GLuint program, GLint location, GLdouble *params) { glad_lazy_resolve(391); glad_glGetUniformdv(program, location, params); }
+static void APIENTRY glad_lazy_glGetUniformfv(GLuint program, GLint location, GLfloat *params) { glad_lazy_resolve(392); glad_glGetUniformfv(program, location, params); }
+static void APIENTRY glad_lazy_glGetUniformiv(GLuint program, GLint location, GLint *params) { glad_lazy_resolve(393); glad_glGetUniformiv(program, location, params); }
+static void APIENTRY glad_lazy_glGetUniformuiv(GLuint program, GLint location, GLuint *params) { glad_lazy_resolve(394); glad_glGetUniformuiv(program, location, params); }
+static void APIENTRY glad_lazy_glGetVertexArrayIndexed64iv(GLuint vaobj, GLuint index, GLenum pname, GLint64 *param) { glad_lazy_resolve(395); glad_glGetVertexArrayIndexed64iv(vaobj, index, pname, param); }
+static void APIENTRY glad_lazy_glGetVertexArrayIndexediv(GLuint vaobj, GLuint index, GLenum pname, GLint *param) { glad_lazy_resolve(396); glad_glGetVertexArrayIndexediv(vaobj, index, pname, param); }
+static void APIENTRY glad_lazy_glGetVertexArrayiv(GLuint vaobj, GLenum pname, GLint *param) { glad_lazy_resolve(397); glad_glGetVertexArrayiv(vaobj, pname, param); }
+static void APIENTRY glad_lazy_glGetVertexAttribIiv(GLuint index, GLenum pname, GLint *params) { glad_lazy_resolve(398); glad_glGetVertexAttribIiv(index, pname, params); }
+static void APIENTRY glad_lazy_glGetVertexAttribIuiv(GLuint index, GLenum pname, GLuint *params) { glad_lazy_resolve(399); glad_glGetVertexAttribIuiv(index, pname, params); }
+static void APIENTRY glad_lazy_glGetVertexAttribLdv(GLuint index, GLenum pname, GLdouble *params) { glad_lazy_resolve(400); glad_glGetVertexAttribLdv(index, pname, params); }
+static void APIENTRY glad_lazy_glGetVertexAttribPointerv(GLuint index, GLenum pname, void **pointer) { glad_lazy_resolve(401); glad_glGetVertexAttribPointerv(index, pname, pointer); }
+static void APIENTRY glad_lazy_glGetVertexAttribdv(GLuint index, GLenum pname, GLdouble *params) { glad_lazy_resolve(402); glad_glGetVertexAttribdv(index, pname, params); }
+static void APIENTRY glad_lazy_glGetVertexAttribfv(GLuint index, GLenum pname, GLfloat *params) { glad_lazy_resolve(403); glad_glGetVertexAttribfv(index, pname, params); }
+static void APIENTRY glad_lazy_glGetVertexAttribiv(GLuint index, GLenum pname, GLint *params) { glad_lazy_resolve(404); glad_glGetVertexAttribiv(index, pname, params); }
+static void APIENTRY glad_lazy_glGetnColorTable(GLenum target, GLenum format, GLenum type, GLsizei bufSize, void *table) { glad_lazy_resolve(405); glad_glGetnColorTable(target, format, type, bufSize, table); }
+static void APIENTRY glad_lazy_glGetnCompressedTexImage(GLenum target, GLint lod, GLsizei bufSize, void *pixels) { glad_lazy_resolve(406); glad_glGetnCompressedTexImage(target, lod, bufSize, pixels); }
+static void APIENTRY glad_lazy_glGetnConvolutionFilter(GLenum target, GLenum format, GLenum type, GLsizei bufSize, void *image) { glad_lazy_resolve(407); glad_glGetnConvolutionFilter(target, format, type, bufSize, image); }
+static void APIENTRY glad_lazy_glGetnHistogram(GLenum target, GLboolean reset, GLenum format, GLenum type, GLsizei bufSize, void *values) { glad_lazy_resolve(408); glad_glGetnHistogram(target, reset, format, type, bufSize, values); }
+static void APIENTRY glad_lazy_glGetnMapdv(GLenum target, GLenum query, GLsizei bufSize, GLdouble *v) { glad_lazy_resolve(409); glad_glGetnMapdv(target, query, bufSize, v); }
+static void APIENTRY glad_lazy_glGetnMapfv(GLenum target, GLenum query, GLsizei bufSize, GLfloat *v) { glad_lazy_resolve(410); glad_glGetnMapfv(target, query, bufSize, v); }
+static void APIENTRY glad_lazy_glGetnMapiv(GLenum target, GLenum query, GLsizei bufSize, GLint *v) { glad_lazy_resolve(411); glad_glGetnMapiv(target, query, bufSize, v); }
+static void APIENTRY glad_lazy_glGetnMinmax(GLenum target, GLboolean reset, GLenum format, GLenum type, GLsizei bufSize, void *values) { glad_lazy_resolve(412); glad_glGetnMinmax(target, reset, format, type, bufSize, values); }
+static void APIENTRY glad_lazy_glGetnPixelMapfv(GLenum map, GLsizei bufSize, GLfloat *values) { glad_lazy_resolve(413); glad_glGetnPixelMapfv(map, bufSize, values); }
+static void APIENTRY glad_lazy_glGetnPixelMapuiv(GLenum map, GLsizei bufSize, GLuint *values) { glad_lazy_resolve(414); glad_glGetnPixelMapuiv(map, bufSize, values); }
+static void APIENTRY glad_lazy_glGetnPixelMapusv(GLenum map, GLsizei bufSize, GLushort *values) { glad_lazy_resolve(415); glad_glGetnPixelMapusv(map, bufSize, values); }
+static void APIENTRY glad_lazy_glGetnPolygonStipple(GLsizei bufSize, GLubyte *pattern) { glad_lazy_resolve(416); glad_glGetnPolygonStipple(bufSize, pattern); }
+static void APIENTRY glad_lazy_glGetnSeparableFilter(GLenum target, GLenum format, GLenum type, GLsizei rowBufSize, void *row, GLsizei columnBufSize, void *column, void *span) { glad_lazy_resolve(417); glad_glGetnSeparableFilter(target, format, type, rowBufSize, row, columnBufSize, column, span); }
+static void APIENTRY glad_lazy_glGetnTexImage(GLenum target, GLint level, GLenum format, GLenum type, GLsizei bufSize, void *pixels) { glad_lazy_resolve(418); glad_glGetnTexImage(target, level, format, type, bufSize, pixels); }
+static void APIENTRY glad_lazy_glGetnUniformdv(GLuint program, GLint location, GLsizei bufSize, GLdouble *params) { glad_lazy_resolve(419); glad_glGetnUniformdv(program, location, bufSize, params); }
+static void APIENTRY glad_lazy_glGetnUniformfv(GLuint program, GLint location, GLsizei bufSize, GLfloat *params) { glad_lazy_resolve(420); glad_glGetnUniformfv(program, location, bufSize, params); }
+static void APIENTRY glad_lazy_glGetnUniformiv(GLuint program, GLint location, GLsizei bufSize, GLint *params) { glad_lazy_resolve(421); glad_glGetnUniformiv(program, location, bufSize, params); }
+static void APIENTRY glad_lazy_glGetnUniformuiv(GLuint program, GLint location, GLsizei bufSize, GLuint *params) { glad_lazy_resolve(422); glad_glGetnUniformuiv(program, location, bufSize, params); }
+static void APIENTRY glad_lazy_glHint(GLenum target, GLenum mode) { glad_lazy_resolve(423); glad_glHint(target, mode); }
+static void APIENTRY glad_lazy_glIndexMask(GLuint mask) { glad_lazy_resolve(424); glad_glIndexMask(mask); }
+static void APIENTRY glad_lazy_glIndexPointer(GLenum type, GLsizei stride, const void *pointer) { glad_lazy_resolve(425); glad_glIndexPointer(type, stride, pointer); }
+static void APIENTRY glad_lazy_glIndexd(GLdouble c) { glad_lazy_resolve(426); glad_glIndexd(c); }
+static void APIENTRY glad_lazy_glIndexdv(const GLdouble *c) { glad_lazy_resolve(427); glad_glIndexdv(c); }
+static void APIENTRY glad_lazy_glIndexf(GLfloat c) { glad_lazy_resolve(428); glad_glIndexf(c); }
+static void APIENTRY glad_lazy_glIndexfv(const GLfloat *c) { glad_lazy_resolve(429); glad_glIndexfv(c); }
+static void APIENTRY glad_lazy_glIndexi(GLint c) { glad_lazy_resolve(430); glad_glIndexi(c); }
+static void APIENTRY glad_lazy_glIndexiv(const GLint *c) { glad_lazy_resolve(431); glad_glIndexiv(c); }
+static void APIENTRY glad_lazy_glIndexs(GLshort c) { glad_lazy_resolve(432); glad_glIndexs(c); }
+static void APIENTRY glad_lazy_glIndexsv(const GLshort *c) { glad_lazy_resolve(433); glad_glIndexsv(c); }
+static void APIENTRY glad_lazy_glIndexub(GLubyte c) { glad_lazy_resolve(434); glad_glIndexub(c); }
+static void APIENTRY glad_lazy_glIndexubv(const GLubyte *c) { glad_lazy_resolve(435); glad_glIndexubv(c); }
+static void APIENTRY glad_lazy_glInitNames(void) { glad_lazy_resolve(436); glad_glInitNames(); }
+static void APIENTRY glad_lazy_glInterleavedArrays(GLenum format, GLsizei stride, const void *pointer) { glad_lazy_resolve(437); glad_glInterleavedArrays(format, stride, pointer); }
+static void APIENTRY glad_lazy_glInvalidateBufferData(GLuint buffer) { glad_lazy_resolve(438); glad_glInvalidateBufferData(buffer); }
+static void APIENTRY glad_lazy_glInvalidateBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr length) { glad_lazy_resolve(439); glad_glInvalidateBufferSubData(buffer, offset, length); }
+static void APIENTRY glad_lazy_glInvalidateFramebuffer(GLenum target, GLsizei numAttachments, const GLenum *attachments) { glad_lazy_resolve(440); glad_glInvalidateFramebuffer(target, numAttachments, attachments); }
+static void APIENTRY glad_lazy_glInvalidateNamedFramebufferData(GLuint framebuffer, GLsizei numAttachments, const GLenum *attachments) { glad_lazy_resolve(441); glad_glInvalidateNamedFramebufferData(framebuffer, numAttachments, attachments); }
+static void APIENTRY glad_lazy_glInvalidateNamedFramebufferSubData(GLuint framebuffer, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height) { glad_lazy_resolve(442); glad_glInvalidateNamedFramebufferSubData(framebuffer, numAttachments, attachments, x, y, width, height); }
+static void APIENTRY glad_lazy_glInvalidateSubFramebuffer(GLenum target, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height) { glad_lazy_resolve(443); glad_glInvalidateSubFramebuffer(target, numAttachments, attachments, x, y, width, height); }
+static void APIENTRY glad_lazy_glInvalidateTexImage(GLuint texture, GLint level) { glad_lazy_resolve(444); glad_glInvalidateTexImage(texture, level); }
+static void APIENTRY glad_lazy_glInvalidateTexSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth) { glad_lazy_resolve(445); glad_glInvalidateTexSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth); }
+static GLboolean APIENTRY glad_lazy_glIsBuffer(GLuint buffer) { glad_lazy_resolve(446); return glad_glIsBuffer(buffer); }
+static GLboolean APIENTRY glad_lazy_glIsEnabled(GLenum cap) { glad_lazy_resolve(447); return glad_glIsEnabled(cap); }
+static GLboolean APIENTRY glad_lazy_glIsEnabledi(GLenum target, GLuint index) { glad_lazy_resolve(448); return glad_glIsEnabledi(target, index); }
+static GLboolean APIENTRY glad_lazy_glIsFramebuffer(GLuint framebuffer) { glad_lazy_resolve(449); return glad_glIsFramebuffer(framebuffer); }
+static GLboolean APIENTRY glad_lazy_glIsList(GLuint list) { glad_lazy_resolve(450); return glad_glIsList(list); }
+static GLboolean APIENTRY glad_lazy_glIsProgram(GLuint program) { glad_lazy_resolve(451); return glad_glIsProgram(program); }
+static GLboolean APIENTRY glad_lazy_glIsProgramPipeline(GLuint pipeline) { glad_lazy_resolve(452); return glad_glIsProgramPipeline(pipeline); }
+static GLboolean APIENTRY glad_lazy_glIsQuery(GLuint id) { glad_lazy_resolve(453); return glad_glIsQuery(id); }
+static GLboolean APIENTRY glad_lazy_glIsRenderbuffer(GLuint renderbuffer) { glad_lazy_resolve(454); return glad_glIsRenderbuffer(renderbuffer); }
+static GLboolean APIENTRY glad_lazy_glIsSampler(GLuint sampler) { glad_lazy_resolve(455); return glad_glIsSampler(sampler); }
+static GLboolean APIENTRY glad_lazy_glIsShader(GLuint shader) { glad_lazy_resolve(456); return glad_glIsShader(shader); }
+static GLboolean APIENTRY glad_lazy_glIsSync(GLsync sync) { glad_lazy_resolve(457); return glad_glIsSync(sync); }
+static GLboolean APIENTRY glad_lazy_glIsTexture(GLuint texture) { glad_lazy_resolve(458); return glad_glIsTexture(texture); }
+static GLboolean APIENTRY glad_lazy_glIsTransformFeedback(GLuint id) { glad_lazy_resolve(459); return glad_glIsTransformFeedback(id); }
+static GLboolean APIENTRY glad_lazy_glIsVertexArray(GLuint array) { glad_lazy_resolve(460); return glad_glIsVertexArray(array); }
+static void APIENTRY glad_lazy_glLightModelf(GLenum pname, GLfloat param) { glad_lazy_resolve(461); glad_glLightModelf(pname, param); }
+static void APIENTRY glad_lazy_glLightModelfv(GLenum pname, const GLfloat *params) { glad_lazy_resolve(462); glad_glLightModelfv(pname, params); }
+static void APIENTRY glad_lazy_glLightModeli(GLenum pname, GLint param) { glad_lazy_resolve(463); glad_glLightModeli(pname, param); }
+static void APIENTRY glad_lazy_glLightModeliv(GLenum pname, const GLint *params) { glad_lazy_resolve(464); glad_glLightModeliv(pname, params); }
+static void APIENTRY glad_lazy_glLightf(GLenum light, GLenum pname, GLfloat param) { glad_lazy_resolve(465); glad_glLightf(light, pname, param); }
+static void APIENTRY glad_lazy_glLightfv(GLenum light, GLenum pname, const GLfloat *params) { glad_lazy_resolve(466); glad_glLightfv(light, pname, params); }
+static void APIENTRY glad_lazy_glLighti(GLenum light, GLenum pname, GLint param) { glad_lazy_resolve(467); glad_glLighti(light, pname, param); }
+static void APIENTRY glad_lazy_glLightiv(GLenum light, GLenum pname, const GLint *params) { glad_lazy_resolve(468); glad_glLightiv(light, pname, params); }
+static void APIENTRY glad_lazy_glLineStipple(GLint factor, GLushort pattern) { glad_lazy_resolve(469); glad_glLineStipple(factor, pattern); }
+static void APIENTRY glad_lazy_glLineWidth(GLfloat width) { glad_lazy_resolve(470); glad_glLineWidth(width); }
+static void APIENTRY glad_lazy_glLinkProgram(GLuint program) { glad_lazy_resolve(471); glad_glLinkProgram(program); }
+static void APIENTRY glad_lazy_glListBase(GLuint base) { glad_lazy_resolve(472); glad_glListBase(base); }
+static void APIENTRY glad_lazy_glLoadIdentity(void) { glad_lazy_resolve(473); glad_glLoadIdentity(); }
+static void APIENTRY glad_lazy_glLoadMatrixd(const GLdouble *m) { glad_lazy_resolve(474); glad_glLoadMatrixd(m); }
+static void APIENTRY glad_lazy_glLoadMatrixf(const GLfloat *m) { glad_lazy_resolve(475); glad_glLoadMatrixf(m); }
+static void APIENTRY glad_lazy_glLoadName(GLuint name) { glad_lazy_resolve(476); glad_glLoadName(name); }
+static void APIENTRY glad_lazy_glLoadTransposeMatrixd(const GLdouble *m) { glad_lazy_resolve(477); glad_glLoadTransposeMatrixd(m); }
+static void APIENTRY glad_lazy_glLoadTransposeMatrixf(const GLfloat *m) { glad_lazy_resolve(478); glad_glLoadTransposeMatrixf(m); }
+static void APIENTRY glad_lazy_glLogicOp(GLenum opcode) { glad_lazy_resolve(479); glad_glLogicOp(opcode); }
+static void APIENTRY glad_lazy_glMap1d(GLenum target, GLdouble u1, GLdouble u2, GLint stride, GLint order, const GLdouble *points) { glad_lazy_resolve(480); glad_glMap1d(target, u1, u2, stride, order, points); }
+static void APIENTRY glad_lazy_glMap1f(GLenum target, GLfloat u1, GLfloat u2, GLint stride, GLint order, const GLfloat *points) { glad_lazy_resolve(481); glad_glMap1f(target, u1, u2, stride, order, points); }
+static void APIENTRY glad_lazy_glMap2d(GLenum target, GLdouble u1, GLdouble u2, GLint ustride, GLint uorder, GLdouble v1, GLdouble v2, GLint vstride, GLint vorder, const GLdouble *points) { glad_lazy_resolve(482); glad_glMap2d(target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points); }
+static void APIENTRY glad_lazy_glMap2f(GLenum target, GLfloat u1, GLfloat u2, GLint ustride, GLint uorder, GLfloat v1, GLfloat v2, GLint vstride, GLint vorder, const GLfloat *points) { glad_lazy_resolve(483); glad_glMap2f(target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points); }
+static void * APIENTRY glad_lazy_glMapBuffer(GLenum target, GLenum access) { glad_lazy_resolve(484); return glad_glMapBuffer(target, access); }
+static void * APIENTRY glad_lazy_glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) { glad_lazy_resolve(485); return glad_glMapBufferRange(target, offset, length, access); }
+static void APIENTRY glad_lazy_glMapGrid1d(GLint un, GLdouble u1, GLdouble u2) { glad_lazy_resolve(486); glad_glMapGrid1d(un, u1, u2); }
+static void APIENTRY glad_lazy_glMapGrid1f(GLint un, GLfloat u1, GLfloat u2) { glad_lazy_resolve(487); glad_glMapGrid1f(un, u1, u2); }
+static void APIENTRY glad_lazy_glMapGrid2d(GLint un, GLdouble u1, GLdouble u2, GLint vn, GLdouble v1, GLdouble v2) { glad_lazy_resolve(488); glad_glMapGrid2d(un, u1, u2, vn, v1, v2); }
+static void APIENTRY glad_lazy_glMapGrid2f(GLint un, GLfloat u1, GLfloat u2, GLint vn, GLfloat v1, GLfloat v2) { glad_lazy_resolve(489); glad_glMapGrid2f(un, u1, u2, vn, v1, v2); }
+static void * APIENTRY glad_lazy_glMapNamedBuffer(GLuint buffer, GLenum access) { glad_lazy_resolve(490); return glad_glMapNamedBuffer(buffer, access); }
+static void * APIENTRY glad_lazy_glMapNamedBufferRange(GLuint buffer, GLintptr offset, GLsizeiptr length, GLbitfield access) { glad_lazy_resolve(491); return glad_glMapNamedBufferRange(buffer, offset, length, access); }
+static void APIENTRY glad_lazy_glMaterialf(GLenum face, GLenum pname, GLfloat param) { glad_lazy_resolve(492); glad_glMaterialf(face, pname, param); }
+static void APIENTRY glad_lazy_glMaterialfv(GLenum face, GLenum pname, const GLfloat *params) { glad_lazy_resolve(493); glad_glMaterialfv(face, pname, params); }
+static void APIENTRY glad_lazy_glMateriali(GLenum face, GLenum pname, GLint param) { glad_lazy_resolve(494); glad_glMateriali(face, pname, param); }
+static void APIENTRY glad_lazy_glMaterialiv(GLenum face, GLenum pname, const GLint *params) { glad_lazy_resolve(495); glad_glMaterialiv(face, pname, params); }
+static void APIENTRY glad_lazy_glMatrixMode(GLenum mode) { glad_lazy_resolve(496); glad_glMatrixMode(mode); }
+static void APIENTRY glad_lazy_glMemoryBarrier(GLbitfield barriers) { glad_lazy_resolve(497); glad_glMemoryBarrier(barriers); }
+static void APIENTRY glad_lazy_glMemoryBarrierByRegion(GLbitfield barriers) { glad_lazy_resolve(498); glad_glMemoryBarrierByRegion(barriers); }
+static void APIENTRY glad_lazy_glMinSampleShading(GLfloat value) { glad_lazy_resolve(499); glad_glMinSampleShading(value); }
+static void APIENTRY glad_lazy_glMultMatrixd(const GLdouble *m) { glad_lazy_resolve(500); glad_glMultMatrixd(m); }
+static void APIENTRY glad_lazy_glMultMatrixf(const GLfloat *m) { glad_lazy_resolve(501); glad_glMultMatrixf(m); }
+static void APIENTRY glad_lazy_glMultTransposeMatrixd(const GLdouble *m) { glad_lazy_resolve(502); glad_glMultTransposeMatrixd(m); }
+static void APIENTRY glad_lazy_glMultTransposeMatrixf(const GLfloat *m) { glad_lazy_resolve(503); glad_glMultTransposeMatrixf(m); }
+static void APIENTRY glad_lazy_glMultiDrawArrays(GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount) { glad_lazy_resolve(504); glad_glMultiDrawArrays(mode, first, count, drawcount); }
+static void APIENTRY glad_lazy_glMultiDrawArraysIndirect(GLenum mode, const void *indirect, GLsizei drawcount, GLsizei stride) { glad_lazy_resolve(505); glad_glMultiDrawArraysIndirect(mode, indirect, drawcount, stride); }
+static void APIENTRY glad_lazy_glMultiDrawArraysIndirectCount(GLenum mode, const void *indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride) { glad_lazy_resolve(506); glad_glMultiDrawArraysIndirectCount(mode, indirect, drawcount, maxdrawcount, stride); }
+static void APIENTRY glad_lazy_glMultiDrawElements(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount) { glad_lazy_resolve(507); glad_glMultiDrawElements(mode, count, type, indices, drawcount); }
+static void APIENTRY glad_lazy_glMultiDrawElementsBaseVertex(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex) { glad_lazy_resolve(508); glad_glMultiDrawElementsBaseVertex(mode, count, type, indices, drawcount, basevertex); }
+static void APIENTRY glad_lazy_glMultiDrawElementsIndirect(GLenum mode, GLenum type, const void *indirect, GLsizei drawcount, GLsizei stride) { glad_lazy_resolve(509); glad_glMultiDrawElementsIndirect(mode, type, indirect, drawcount, stride); }
+static void APIENTRY glad_lazy_glMultiDrawElementsIndirectCount(GLenum mode, GLenum type, const void *indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride) { glad_lazy_resolve(510); glad_glMultiDrawElementsIndirectCount(mode, type, indirect, drawcount, maxdrawcount, stride); }
+static void APIENTRY glad_lazy_glMultiTexCoord1d(GLenum target, GLdouble s) { glad_lazy_resolve(511); glad_glMultiTexCoord1d(target, s); }
+static void APIENTRY glad_lazy_glMultiTexCoord1dv(GLenum target, const GLdouble *v) { glad_lazy_resolve(512); glad_glMultiTexCoord1dv(target, v); }
+static void APIENTRY glad_lazy_glMultiTexCoord1f(GLenum target, GLfloat s) { glad_lazy_resolve(513); glad_glMultiTexCoord1f(target, s); }
+static void APIENTRY glad_lazy_glMultiTexCoord1fv(GLenum target, const GLfloat *v) { glad_lazy_resolve(514); glad_glMultiTexCoord1fv(target, v); }
+static void APIENTRY glad_lazy_glMultiTexCoord1i(GLenum target, GLint s) { glad_lazy_resolve(515); glad_glMultiTexCoord1i(target, s); }
+static void APIENTRY glad_lazy_glMultiTexCoord1iv(GLenum target, const GLint *v) { glad_lazy_resolve(516); glad_glMultiTexCoord1iv(target, v); }
+static void APIENTRY glad_lazy_glMultiTexCoord1s(GLenum target, GLshort s) { glad_lazy_resolve(517); glad_glMultiTexCoord1s(target, s); }
+static void APIENTRY glad_lazy_glMultiTexCoord1sv(GLenum target, const GLshort *v) { glad_lazy_resolve(518); glad_glMultiTexCoord1sv(target, v); }
+static void APIENTRY glad_lazy_glMultiTexCoord2d(GLenum target, GLdouble s, GLdouble t) { glad_lazy_resolve(519); glad_glMultiTexCoord2d(target, s, t); }
+static void APIENTRY glad_lazy_glMultiTexCoord2dv(GLenum target, const GLdouble *v) { glad_lazy_resolve(520); glad_glMultiTexCoord2dv(target, v); }
+static void APIENTRY glad_lazy_glMultiTexCoord2f(GLenum target, GLfloat s, GLfloat t) { glad_lazy_resolve(521); glad_glMultiTexCoord2f(target, s, t); }
+static void APIENTRY glad_lazy_glMultiTexCoord2fv(GLenum target, const GLfloat *v) { glad_lazy_resolve(522); glad_glMultiTexCoord2fv(target, v); }
+static void APIENTRY glad_lazy_glMultiTexCoord2i(GLenum target, GLint s, GLint t) { glad_lazy_resolve(523); glad_glMultiTexCoord2i(target, s, t); }
+static void APIENTRY glad_lazy_glMultiTexCoord2iv(GLenum target, const GLint *v) { glad_lazy_resolve(524); glad_glMultiTexCoord2iv(target, v); }
+static void APIENTRY glad_lazy_glMultiTexCoord2s(GLenum target, GLshort s, GLshort t) { glad_lazy_resolve(525); glad_glMultiTexCoord2s(target, s, t); }
+static void APIENTRY glad_lazy_glMultiTexCoord2sv(GLenum target, const GLshort *v) { glad_lazy_resolve(526); glad_glMultiTexCoord2sv(target, v); }
+static void APIENTRY glad_lazy_glMultiTexCoord3d(GLenum target, GLdouble s, GLdouble t, GLdouble r) { glad_lazy_resolve(527); glad_glMultiTexCoord3d(target, s, t, r); }
+static void APIENTRY glad_lazy_glMultiTexCoord3dv(GLenum target, const GLdouble *v) { glad_lazy_resolve(528); glad_glMultiTexCoord3dv(target, v); }
+static void APIENTRY glad_lazy_glMultiTexCoord3f(GLenum target, GLfloat s, GLfloat t, GLfloat r) { glad_lazy_resolve(529); glad_glMultiTexCoord3f(target, s, t, r); }
+static void APIENTRY glad_lazy_glMultiTexCoord3fv(GLenum target, const GLfloat *v) { glad_lazy_resolve(530); glad_glMultiTexCoord3fv(target, v); }
+static void APIENTRY glad_lazy_glMultiTexCoord3i(GLenum target, GLint s, GLint t, GLint r) { glad_lazy_resolve(531); glad_glMultiTexCoord3i(target, s, t, r); }
+static void APIENTRY glad_lazy_glMultiTexCoord3iv(GLenum target, const GLint *v) { glad_lazy_resolve(532); glad_glMultiTexCoord3iv(target, v); }
+static void APIENTRY glad_lazy_glMultiTexCoord3s(GLenum target, GLshort s, GLshort t, GLshort r) { glad_lazy_resolve(533); glad_glMultiTexCoord3s(target, s, t, r); }
+static void APIENTRY glad_lazy_glMultiTexCoord3sv(GLenum target, const GLshort *v) { glad_lazy_resolve(534); glad_glMultiTexCoord3sv(target, v); }
+static void APIENTRY glad_lazy_glMultiTexCoord4d(GLenum target, GLdouble s, GLdouble t, GLdouble r, GLdouble q) { glad_lazy_resolve(535); glad_glMultiTexCoord4d(target, s, t, r, q); }
+static void APIENTRY glad_lazy_glMultiTexCoord4dv(GLenum target, const GLdouble *v) { glad_lazy_resolve(536); glad_glMultiTexCoord4dv(target, v); }
+static void APIENTRY glad_lazy_glMultiTexCoord4f(GLenum target, GLfloat s, GLfloat t, GLfloat r, GLfloat q) { glad_lazy_resolve(537); glad_glMultiTexCoord4f(target, s, t, r, q); }
+static void APIENTRY glad_lazy_glMultiTexCoord4fv(GLenum target, const GLfloat *v) { glad_lazy_resolve(538); glad_glMultiTexCoord4fv(target, v); }
+static void APIENTRY glad_lazy_glMultiTexCoord4i(GLenum target, GLint s, GLint t, GLint r, GLint q) { glad_lazy_resolve(539); glad_glMultiTexCoord4i(target, s, t, r, q); }
+static void APIENTRY glad_lazy_glMultiTexCoord4iv(GLenum target, const GLint *v) { glad_lazy_resolve(540); glad_glMultiTexCoord4iv(target, v); }
+static void APIENTRY glad_lazy_glMultiTexCoord4s(GLenum target, GLshort s, GLshort t, GLshort r, GLshort q) { glad_lazy_resolve(541); glad_glMultiTexCoord4s(target, s, t, r, q); }
+static void APIENTRY glad_lazy_glMultiTexCoord4sv(GLenum target, const GLshort *v) { glad_lazy_resolve(542); glad_glMultiTexCoord4sv(target, v); }
+static void APIENTRY glad_lazy_glMultiTexCoordP1ui(GLenum texture, GLenum type, GLuint coords) { glad_lazy_resolve(543); glad_glMultiTexCoordP1ui(texture, type, coords); }
+static void APIENTRY glad_lazy_glMultiTexCoordP1uiv(GLenum texture, GLenum type, const GLuint *coords) { glad_lazy_resolve(544); glad_glMultiTexCoordP1uiv(texture, type, coords); }
+static void APIENTRY glad_lazy_glMultiTexCoordP2ui(GLenum texture, GLenum type, GLuint coords) { glad_lazy_resolve(545); glad_glMultiTexCoordP2ui(texture, type, coords); }
+static void APIENTRY glad_lazy_glMultiTexCoordP2uiv(GLenum texture, GLenum type, const GLuint *coords) { glad_lazy_resolve(546); glad_glMultiTexCoordP2uiv(texture, type, coords); }
+static void APIENTRY glad_lazy_glMultiTexCoordP3ui(GLenum texture, GLenum type, GLuint coords) { glad_lazy_resolve(547); glad_glMultiTexCoordP3ui(texture, type, coords); }
+static void APIENTRY glad_lazy_glMultiTexCoordP3uiv(GLenum texture, GLenum type, const GLuint *coords) { glad_lazy_resolve(548); glad_glMultiTexCoordP3uiv(texture, type, coords); }
+static void APIENTRY glad_lazy_glMultiTexCoordP4ui(GLenum texture, GLenum type, GLuint coords) { glad_lazy_resolve(549); glad_glMultiTexCoordP4ui(texture, type, coords); }
+static void APIENTRY glad_lazy_glMultiTexCoordP4uiv(GLenum texture, GLenum type, const GLuint *coords) { glad_lazy_resolve(550); glad_glMultiTexCoordP4uiv(texture, type, coords); }
+static void APIENTRY glad_lazy_glNamedBufferData(GLuint buffer, GLsizeiptr size, const void *data, GLenum usage) { glad_lazy_resolve(551); glad_glNamedBufferData(buffer, size, data, usage); }
+static void APIENTRY glad_lazy_glNamedBufferStorage(GLuint buffer, GLsizeiptr size, const void *data, GLbitfield flags) { glad_lazy_resolve(552); glad_glNamedBufferStorage(buffer, size, data, flags); }
+static void APIENTRY glad_lazy_glNamedBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr size, const void *data) { glad_lazy_resolve(553); glad_glNamedBufferSubData(buffer, offset, size, data); }
+static void APIENTRY glad_lazy_glNamedFramebufferDrawBuffer(GLuint framebuffer, GLenum buf) { glad_lazy_resolve(554); glad_glNamedFramebufferDrawBuffer(framebuffer, buf); }
+static void APIENTRY glad_lazy_glNamedFramebufferDrawBuffers(GLuint framebuffer, GLsizei n, const GLenum *bufs) { glad_lazy_resolve(555); glad_glNamedFramebufferDrawBuffers(framebuffer, n, bufs); }
+static void APIENTRY glad_lazy_glNamedFramebufferParameteri(GLuint framebuffer, GLenum pname, GLint param) { glad_lazy_resolve(556); glad_glNamedFramebufferParameteri(framebuffer, pname, param); }
+static void APIENTRY glad_lazy_glNamedFramebufferReadBuffer(GLuint framebuffer, GLenum src) { glad_lazy_resolve(557); glad_glNamedFramebufferReadBuffer(framebuffer, src); }
+static void APIENTRY glad_lazy_glNamedFramebufferRenderbuffer(GLuint framebuffer, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) { glad_lazy_resolve(558); glad_glNamedFramebufferRenderbuffer(framebuffer, attachment, renderbuffertarget, renderbuffer); }
+static void APIENTRY glad_lazy_glNamedFramebufferTexture(GLuint framebuffer, GLenum attachment, GLuint texture, GLint level) { glad_lazy_resolve(559); glad_glNamedFramebufferTexture(framebuffer, attachment, texture, level); }
+static void APIENTRY glad_lazy_glNamedFramebufferTextureLayer(GLuint framebuffer, GLenum attachment, GLuint texture, GLint level, GLint layer) { glad_lazy_resolve(560); glad_glNamedFramebufferTextureLayer(framebuffer, attachment, texture, level, layer); }
+static void APIENTRY glad_lazy_glNamedRenderbufferStorage(GLuint renderbuffer, GLenum internalformat, GLsizei width, GLsizei height) { glad_lazy_resolve(561); glad_glNamedRenderbufferStorage(renderbuffer, internalformat, width, height); }
+static void APIENTRY glad_lazy_glNamedRenderbufferStorageMultisample(GLuint renderbuffer, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) { glad_lazy_resolve(562); glad_glNamedRenderbufferStorageMultisample(renderbuffer, samples, internalformat, width, height); }
+static void APIENTRY glad_lazy_glNewList(GLuint list, GLenum mode) { glad_lazy_resolve(563); glad_glNewList(list, mode); }
+static void APIENTRY glad_lazy_glNormal3b(GLbyte nx, GLbyte ny, GLbyte nz) { glad_lazy_resolve(564); glad_glNormal3b(nx, ny, nz); }
+static void APIENTRY glad_lazy_glNormal3bv(const GLbyte *v) { glad_lazy_resolve(565); glad_glNormal3bv(v); }
+static void APIENTRY glad_lazy_glNormal3d(GLdouble nx, GLdouble ny, GLdouble nz) { glad_lazy_resolve(566); glad_glNormal3d(nx, ny, nz); }
+static void APIENTRY glad_lazy_glNormal3dv(const GLdouble *v) { glad_lazy_resolve(567); glad_glNormal3dv(v); }
+static void APIENTRY glad_lazy_glNormal3f(GLfloat nx, GLfloat ny, GLfloat nz) { glad_lazy_resolve(568); glad_glNormal3f(nx, ny, nz); }
+static void APIENTRY glad_lazy_glNormal3fv(const GLfloat *v) { glad_lazy_resolve(569); glad_glNormal3fv(v); }
+static void APIENTRY glad_lazy_glNormal3i(GLint nx, GLint ny, GLint nz) { glad_lazy_resolve(570); glad_glNormal3i(nx, ny, nz); }
+static void APIENTRY glad_lazy_glNormal3iv(const GLint *v) { glad_lazy_resolve(571); glad_glNormal3iv(v); }
+static void APIENTRY glad_lazy_glNormal3s(GLshort nx, GLshort ny, GLshort nz) { glad_lazy_resolve(572); glad_glNormal3s(nx, ny, nz); }
+static void APIENTRY glad_lazy_glNormal3sv(const GLshort *v) { glad_lazy_resolve(573); glad_glNormal3sv(v); }
+static void APIENTRY glad_lazy_glNormalP3ui(GLenum type, GLuint coords) { glad_lazy_resolve(574); glad_glNormalP3ui(type, coords); }
+static void APIENTRY glad_lazy_glNormalP3uiv(GLenum type, const GLuint *coords) { glad_lazy_resolve(575); glad_glNormalP3uiv(type, coords); }
+static void APIENTRY glad_lazy_glNormalPointer(GLenum type, GLsizei stride, const void *pointer) { glad_lazy_resolve(576); glad_glNormalPointer(type, stride, pointer); }
+static void APIENTRY glad_lazy_glObjectLabel(GLenum identifier, GLuint name, GLsizei length, const GLchar *label) { glad_lazy_resolve(577); glad_glObjectLabel(identifier, name, length, label); }
+static void APIENTRY glad_lazy_glObjectPtrLabel(const void *ptr, GLsizei length, const GLchar *label) { glad_lazy_resolve(578); glad_glObjectPtrLabel(ptr, length, label); }
+static void APIENTRY glad_lazy_glOrtho(GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar) { glad_lazy_resolve(579); glad_glOrtho(left, right, bottom, top, zNear, zFar); }
+static void APIENTRY glad_lazy_glPassThrough(GLfloat token) { glad_lazy_resolve(580); glad_glPassThrough(token); }
+static void APIENTRY glad_lazy_glPatchParameterfv(GLenum pname, const GLfloat *values) { glad_lazy_resolve(581); glad_glPatchParameterfv(pname, values); }
+static void APIENTRY glad_lazy_glPatchParameteri(GLenum pname, GLint value) { glad_lazy_resolve(582); glad_glPatchParameteri(pname, value); }
+static void APIENTRY glad_lazy_glPauseTransformFeedback(void) { glad_lazy_resolve(583); glad_glPauseTransformFeedback(); }
+static void APIENTRY glad_lazy_glPixelMapfv(GLenum map, GLsizei mapsize, const GLfloat *values) { glad_lazy_resolve(584); glad_glPixelMapfv(map, mapsize, values); }
+static void APIENTRY glad_lazy_glPixelMapuiv(GLenum map, GLsizei mapsize, const GLuint *values) { glad_lazy_resolve(585); glad_glPixelMapuiv(map, mapsize, values); }
+static void APIENTRY glad_lazy_glPixelMapusv(GLenum map, GLsizei mapsize, const GLushort *values) { glad_lazy_resolve(586); glad_glPixelMapusv(map, mapsize, values); }
+static void APIENTRY glad_lazy_glPixelStoref(GLenum pname, GLfloat param) { glad_lazy_resolve(587); glad_glPixelStoref(pname, param); }
+static void APIENTRY glad_lazy_glPixelStorei(GLenum pname, GLint param) { glad_lazy_resolve(588); glad_glPixelStorei(pname, param); }
+static void APIENTRY glad_lazy_glPixelTransferf(GLenum pname, GLfloat param) { glad_lazy_resolve(589); glad_glPixelTransferf(pname, param); }
+static void APIENTRY glad_lazy_glPixelTransferi(GLenum pname, GLint param) { glad_lazy_resolve(590); glad_glPixelTransferi(pname, param); }
+static void APIENTRY glad_lazy_glPixelZoom(GLfloat xfactor, GLfloat yfactor) { glad_lazy_resolve(591); glad_glPixelZoom(xfactor, yfactor); }
+static void APIENTRY glad_lazy_glPointParameterf(GLenum pname, GLfloat param) { glad_lazy_resolve(592); glad_glPointParameterf(pname, param); }
+static void APIENTRY glad_lazy_glPointParameterfv(GLenum pname, const GLfloat *params) { glad_lazy_resolve(593); glad_glPointParameterfv(pname, params); }
+static void APIENTRY glad_lazy_glPointParameteri(GLenum pname, GLint param) { glad_lazy_resolve(594); glad_glPointParameteri(pname, param); }
+static void APIENTRY glad_lazy_glPointParameteriv(GLenum pname, const GLint *params) { glad_lazy_resolve(595); glad_glPointParameteriv(pname, params); }
+static void APIENTRY glad_lazy_glPointSize(GLfloat size) { glad_lazy_resolve(596); glad_glPointSize(size); }
+static void APIENTRY glad_lazy_glPolygonMode(GLenum face, GLenum mode) { glad_lazy_resolve(597); glad_glPolygonMode(face, mode); }
+static void APIENTRY glad_lazy_glPolygonOffset(GLfloat factor, GLfloat units) { glad_lazy_resolve(598); glad_glPolygonOffset(factor, units); }
+static void APIENTRY glad_lazy_glPolygonOffsetClamp(GLfloat factor, GLfloat units, GLfloat clamp) { glad_lazy_resolve(599); glad_glPolygonOffsetClamp(factor, units, clamp); }
+static void APIENTRY glad_lazy_glPolygonStipple(const GLubyte *mask) { glad_lazy_resolve(600); glad_glPolygonStipple(mask); }
+static void APIENTRY glad_lazy_glPopAttrib(void) { glad_lazy_resolve(601); glad_glPopAttrib(); }
+static void APIENTRY glad_lazy_glPopClientAttrib(void) { glad_lazy_resolve(602); glad_glPopClientAttrib(); }
+static void APIENTRY glad_lazy_glPopDebugGroup(void) { glad_lazy_resolve(603); glad_glPopDebugGroup(); }
+static void APIENTRY glad_lazy_glPopMatrix(void) { glad_lazy_resolve(604); glad_glPopMatrix(); }
+static void APIENTRY glad_lazy_glPopName(void) { glad_lazy_resolve(605); glad_glPopName(); }
+static void APIENTRY glad_lazy_glPrimitiveRestartIndex(GLuint index) { glad_lazy_resolve(606); glad_glPrimitiveRestartIndex(index); }
+static void APIENTRY glad_lazy_glPrioritizeTextures(GLsizei n, const GLuint *textures, const GLfloat *priorities) { glad_lazy_resolve(607); glad_glPrioritizeTextures(n, textures, priorities); }
+static void APIENTRY glad_lazy_glProgramBinary(GLuint program, GLenum binaryFormat, const void *binary, GLsizei length) { glad_lazy_resolve(608); glad_glProgramBinary(program, binaryFormat, binary, length); }
+static void APIENTRY glad_lazy_glProgramParameteri(GLuint program, GLenum pname, GLint value) { glad_lazy_resolve(609); glad_glProgramParameteri(program, pname, value); }
+static void APIENTRY glad_lazy_glProgramUniform1d(GLuint program, GLint location, GLdouble v0) { glad_lazy_resolve(610); glad_glProgramUniform1d(program, location, v0); }
+static void APIENTRY glad_lazy_glProgramUniform1dv(GLuint program, GLint location, GLsizei count, const GLdouble *value) { glad_lazy_resolve(611); glad_glProgramUniform1dv(program, location, count, value); }
+static void APIENTRY glad_lazy_glProgramUniform1f(GLuint program, GLint location, GLfloat v0) { glad_lazy_resolve(612); glad_glProgramUniform1f(program, location, v0); }
+static void APIENTRY glad_lazy_glProgramUniform1fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) { glad_lazy_resolve(613); glad_glProgramUniform1fv(program, location, count, value); }
+static void APIENTRY glad_lazy_glProgramUniform1i(GLuint program, GLint location, GLint v0) { glad_lazy_resolve(614); glad_glProgramUniform1i(program, location, v0); }
+static void APIENTRY glad_lazy_glProgramUniform1iv(GLuint program, GLint location, GLsizei count, const GLint *value) { glad_lazy_resolve(615); glad_glProgramUniform1iv(program, location, count, value); }
+static void APIENTRY glad_lazy_glProgramUniform1ui(GLuint program, GLint location, GLuint v0) { glad_lazy_resolve(616); glad_glProgramUniform1ui(program, location, v0); }
+static void APIENTRY glad_lazy_glProgramUniform1uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) { glad_lazy_resolve(617); glad_glProgramUniform1uiv(program, location, count, value); }
+static void APIENTRY glad_lazy_glProgramUniform2d(GLuint program, GLint location, GLdouble v0, GLdouble v1) { glad_lazy_resolve(618); glad_glProgramUniform2d(program, location, v0, v1); }
+static void APIENTRY glad_lazy_glProgramUniform2dv(GLuint program, GLint location, GLsizei count, const GLdouble *value) { glad_lazy_resolve(619); glad_glProgramUniform2dv(program, location, count, value); }
+static void APIENTRY glad_lazy_glProgramUniform2f(GLuint program, GLint location, GLfloat v0, GLfloat v1) { glad_lazy_resolve(620); glad_glProgramUniform2f(program, location, v0, v1); }
+static void APIENTRY glad_lazy_glProgramUniform2fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) { glad_lazy_resolve(621); glad_glProgramUniform2fv(program, location, count, value); }
+static void APIENTRY glad_lazy_glProgramUniform2i(GLuint program, GLint location, GLint v0, GLint v1) { glad_lazy_resolve(622); glad_glProgramUniform2i(program, location, v0, v1); }
+static void APIENTRY glad_lazy_glProgramUniform2iv(GLuint program, GLint location, GLsizei count, const GLint *value) { glad_lazy_resolve(623); glad_glProgramUniform2iv(program, location, count, value); }
+static void APIENTRY glad_lazy_glProgramUniform2ui(GLuint program, GLint location, GLuint v0, GLuint v1) { glad_lazy_resolve(624); glad_glProgramUniform2ui(program, location, v0, v1); }
+static void APIENTRY glad_lazy_glProgramUniform2uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) { glad_lazy_resolve(625); glad_glProgramUniform2uiv(program, location, count, value); }
+static void APIENTRY glad_lazy_glProgramUniform3d(GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2) { glad_lazy_resolve(626); glad_glProgramUniform3d(program, location, v0, v1, v2); }
+static void APIENTRY glad_lazy_glProgramUniform3dv(GLuint program, GLint location, GLsizei count, const GLdouble *value) { glad_lazy_resolve(627); glad_glProgramUniform3dv(program, location, count, value); }
+static void APIENTRY glad_lazy_glProgramUniform3f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2) { glad_lazy_resolve(628); glad_glProgramUniform3f(program, location, v0, v1, v2); }
+static void APIENTRY glad_lazy_glProgramUniform3fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) { glad_lazy_resolve(629); glad_glProgramUniform3fv(program, location, count, value); }
+static void APIENTRY glad_lazy_glProgramUniform3i(GLuint program, GLint location, GLint v0, GLint v1, GLint v2) { glad_lazy_resolve(630); glad_glProgramUniform3i(program, location, v0, v1, v2); }
+static void APIENTRY glad_lazy_glProgramUniform3iv(GLuint program, GLint location, GLsizei count, const GLint *value) { glad_lazy_resolve(631); glad_glProgramUniform3iv(program, location, count, value); }
+static void APIENTRY glad_lazy_glProgramUniform3ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2) { glad_lazy_resolve(632); glad_glProgramUniform3ui(program, location, v0, v1, v2); }
+static void APIENTRY glad_lazy_glProgramUniform3uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) { glad_lazy_resolve(633); glad_glProgramUniform3uiv(program, location, count, value); }
+static void APIENTRY glad_lazy_glProgramUniform4d(GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2, GLdouble v3) { glad_lazy_resolve(634); glad_glProgramUniform4d(program, location, v0, v1, v2, v3); }
+static void APIENTRY glad_lazy_glProgramUniform4dv(GLuint program, GLint location, GLsizei count, const GLdouble *value) { glad_lazy_resolve(635); glad_glProgramUniform4dv(program, location, count, value); }
+static void APIENTRY glad_lazy_glProgramUniform4f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) { glad_lazy_resolve(636); glad_glProgramUniform4f(program, location, v0, v1, v2, v3); }
+static void APIENTRY glad_lazy_glProgramUniform4fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) { glad_lazy_resolve(637); glad_glProgramUniform4fv(program, location, count, value); }
+static void APIENTRY glad_lazy_glProgramUniform4i(GLuint program, GLint location, GLint v0, GLint v1, GLint v2, GLint v3) { glad_lazy_resolve(638); glad_glProgramUniform4i(program, location, v0, v1, v2, v3); }
+static void APIENTRY glad_lazy_glProgramUniform4iv(GLuint program, GLint location, GLsizei count, const GLint *value) { glad_lazy_resolve(639); glad_glProgramUniform4iv(program, location, count, value); }
+static void APIENTRY glad_lazy_glProgramUniform4ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) { glad_lazy_resolve(640); glad_glProgramUniform4ui(program, location, v0, v1, v2, v3); }
+static void APIENTRY glad_lazy_glProgramUniform4uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) { glad_lazy_resolve(641); glad_glProgramUniform4uiv(program, location, count, value); }
+static void APIENTRY glad_lazy_glProgramUniformMatrix2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) { glad_lazy_resolve(642); glad_glProgramUniformMatrix2dv(program, location, count, transpose, value); }
+static void APIENTRY glad_lazy_glProgramUniformMatrix2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { glad_lazy_resolve(643); glad_glProgramUniformMatrix2fv(program, location, count, transpose, value); }
+static void APIENTRY glad_lazy_glProgramUniformMatrix2x3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) { glad_lazy_resolve(644); glad_glProgramUniformMatrix2x3dv(program, location, count, transpose, value); }
+static void APIENTRY glad_lazy_glProgramUniformMatrix2x3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { glad_lazy_resolve(645); glad_glProgramUniformMatrix2x3fv(program, location, count, transpose, value); }
+static void APIENTRY glad_lazy_glProgramUniformMatrix2x4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) { glad_lazy_resolve(646); glad_glProgramUniformMatrix2x4dv(program, location, count, transpose, value); }
+static void APIENTRY glad_lazy_glProgramUniformMatrix2x4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { glad_lazy_resolve(647); glad_glProgramUniformMatrix2x4fv(program, location, count, transpose, value); }
+static void APIENTRY glad_lazy_glProgramUniformMatrix3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) { glad_lazy_resolve(648); glad_glProgramUniformMatrix3dv(program, location, count, transpose, value); }
+static void APIENTRY glad_lazy_glProgramUniformMatrix3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { glad_lazy_resolve(649); glad_glProgramUniformMatrix3fv(program, location, count, transpose, value); }
+static void APIENTRY glad_lazy_glProgramUniformMatrix3x2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) { glad_lazy_resolve(650); glad_glProgramUniformMatrix3x2dv(program, location, count, transpose, value); }
+static void APIENTRY glad_lazy_glProgramUniformMatrix3x2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { glad_lazy_resolve(651); glad_glProgramUniformMatrix3x2fv(program, location, count, transpose, value); }
+static void APIENTRY glad_lazy_glProgramUniformMatrix3x4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) { glad_lazy_resolve(652); glad_glProgramUniformMatrix3x4dv(program, location, count, transpose, value); }
+static void APIENTRY glad_lazy_glProgramUniformMatrix3x4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { glad_lazy_resolve(653); glad_glProgramUniformMatrix3x4fv(program, location, count, transpose, value); }
+static void APIENTRY glad_lazy_glProgramUniformMatrix4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) { glad_lazy_resolve(654); glad_glProgramUniformMatrix4dv(program, location, count, transpose, value); }
+static void APIENTRY glad_lazy_glProgramUniformMatrix4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { glad_lazy_resolve(655); glad_glProgramUniformMatrix4fv(program, location, count, transpose, value); }
+static void APIENTRY glad_lazy_glProgramUniformMatrix4x2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) { glad_lazy_resolve(656); glad_glProgramUniformMatrix4x2dv(program, location, count, transpose, value); }
+static void APIENTRY glad_lazy_glProgramUniformMatrix4x2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { glad_lazy_resolve(657); glad_glProgramUniformMatrix4x2fv(program, location, count, transpose, value); }
+static void APIENTRY glad_lazy_glProgramUniformMatrix4x3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) { glad_lazy_resolve(658); glad_glProgramUniformMatrix4x3dv(program, location, count, transpose, value); }
+static void APIENTRY glad_lazy_glProgramUniformMatrix4x3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { glad_lazy_resolve(659); glad_glProgramUniformMatrix4x3fv(program, location, count, transpose, value); }
+static void APIENTRY glad_lazy_glProvokingVertex(GLenum mode) { glad_lazy_resolve(660); glad_glProvokingVertex(mode); }
+static void APIENTRY glad_lazy_glPushAttrib(GLbitfield mask) { glad_lazy_resolve(661); glad_glPushAttrib(mask); }
+static void APIENTRY glad_lazy_glPushClientAttrib(GLbitfield mask) { glad_lazy_resolve(662); glad_glPushClientAttrib(mask); }
+static void APIENTRY glad_lazy_glPushDebugGroup(GLenum source, GLuint id, GLsizei length, const GLchar *message) { glad_lazy_resolve(663); glad_glPushDebugGroup(source, id, length, message); }
+static void APIENTRY glad_lazy_glPushMatrix(void) { glad_lazy_resolve(664); glad_glPushMatrix(); }
+static void APIENTRY glad_lazy_glPushName(GLuint name) { glad_lazy_resolve(665); glad_glPushName(name); }
+static void APIENTRY glad_lazy_glQueryCounter(GLuint id, GLenum target) { glad_lazy_resolve(666); glad_glQueryCounter(id, target); }
+static void APIENTRY glad_lazy_glRasterPos2d(GLdouble x, GLdouble y) { glad_lazy_resolve(667); glad_glRasterPos2d(x, y); }
+static void APIENTRY glad_lazy_glRasterPos2dv(const GLdouble *v) { glad_lazy_resolve(668); glad_glRasterPos2dv(v); }
+static void APIENTRY glad_lazy_glRasterPos2f(GLfloat x, GLfloat y) { glad_lazy_resolve(669); glad_glRasterPos2f(x, y); }
+static void APIENTRY glad_lazy_glRasterPos2fv(const GLfloat *v) { glad_lazy_resolve(670); glad_glRasterPos2fv(v); }
+static void APIENTRY glad_lazy_glRasterPos2i(GLint x, GLint y) { glad_lazy_resolve(671); glad_glRasterPos2i(x, y); }
+static void APIENTRY glad_lazy_glRasterPos2iv(const GLint *v) { glad_lazy_resolve(672); glad_glRasterPos2iv(v); }
+static void APIENTRY glad_lazy_glRasterPos2s(GLshort x, GLshort y) { glad_lazy_resolve(673); glad_glRasterPos2s(x, y); }
+static void APIENTRY glad_lazy_glRasterPos2sv(const GLshort *v) { glad_lazy_resolve(674); glad_glRasterPos2sv(v); }
+static void APIENTRY glad_lazy_glRasterPos3d(GLdouble x, GLdouble y, GLdouble z) { glad_lazy_resolve(675); glad_glRasterPos3d(x, y, z); }
+static void APIENTRY glad_lazy_glRasterPos3dv(const GLdouble *v) { glad_lazy_resolve(676); glad_glRasterPos3dv(v); }
+static void APIENTRY glad_lazy_glRasterPos3f(GLfloat x, GLfloat y, GLfloat z) { glad_lazy_resolve(677); glad_glRasterPos3f(x, y, z); }
+static void APIENTRY glad_lazy_glRasterPos3fv(const GLfloat *v) { glad_lazy_resolve(678); glad_glRasterPos3fv(v); }
+static void APIENTRY glad_lazy_glRasterPos3i(GLint x, GLint y, GLint z) { glad_lazy_resolve(679); glad_glRasterPos3i(x, y, z); }
+static void APIENTRY glad_lazy_glRasterPos3iv(const GLint *v) { glad_lazy_resolve(680); glad_glRasterPos3iv(v); }
+static void APIENTRY glad_lazy_glRasterPos3s(GLshort x, GLshort y, GLshort z) { glad_lazy_resolve(681); glad_glRasterPos3s(x, y, z); }
+static void APIENTRY glad_lazy_glRasterPos3sv(const GLshort *v) { glad_lazy_resolve(682); glad_glRasterPos3sv(v); }
+static void APIENTRY glad_lazy_glRasterPos4d(GLdouble x, GLdouble y, GLdouble z, GLdouble w) { glad_lazy_resolve(683); glad_glRasterPos4d(x, y, z, w); }
+static void APIENTRY glad_lazy_glRasterPos4dv(const GLdouble *v) { glad_lazy_resolve(684); glad_glRasterPos4dv(v); }
+static void APIENTRY glad_lazy_glRasterPos4f(GLfloat x, GLfloat y, GLfloat z, GLfloat w) { glad_lazy_resolve(685); glad_glRasterPos4f(x, y, z, w); }
+static void APIENTRY glad_lazy_glRasterPos4fv(const GLfloat *v) { glad_lazy_resolve(686); glad_glRasterPos4fv(v); }
+static void APIENTRY glad_lazy_glRasterPos4i(GLint x, GLint y, GLint z, GLint w) { glad_lazy_resolve(687); glad_glRasterPos4i(x, y, z, w); }
+static void APIENTRY glad_lazy_glRasterPos4iv(const GLint *v) { glad_lazy_resolve(688); glad_glRasterPos4iv(v); }
+static void APIENTRY glad_lazy_glRasterPos4s(GLshort x, GLshort y, GLshort z, GLshort w) { glad_lazy_resolve(689); glad_glRasterPos4s(x, y, z, w); }
+static void APIENTRY glad_lazy_glRasterPos4sv(const GLshort *v) { glad_lazy_resolve(690); glad_glRasterPos4sv(v); }
+static void APIENTRY glad_lazy_glReadBuffer(GLenum src) { glad_lazy_resolve(691); glad_glReadBuffer(src); }
+static void APIENTRY glad_lazy_glReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels) { glad_lazy_resolve(692); glad_glReadPixels(x, y, width, height, format, type, pixels); }
+static void APIENTRY glad_lazy_glReadnPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLsizei bufSize, void *data) { glad_lazy_resolve(693); glad_glReadnPixels(x, y, width, height, format, type, bufSize, data); }
+static void APIENTRY glad_lazy_glRectd(GLdouble x1, GLdouble y1, GLdouble x2, GLdouble y2) { glad_lazy_resolve(694); glad_glRectd(x1, y1, x2, y2); }
+static void APIENTRY glad_lazy_glRectdv(const GLdouble *v1, const GLdouble *v2) { glad_lazy_resolve(695); glad_glRectdv(v1, v2); }
+static void APIENTRY glad_lazy_glRectf(GLfloat x1, GLfloat y1, GLfloat x2, GLfloat y2) { glad_lazy_resolve(696); glad_glRectf(x1, y1, x2, y2); }
+static void APIENTRY glad_lazy_glRectfv(const GLfloat *v1, const GLfloat *v2) { glad_lazy_resolve(697); glad_glRectfv(v1, v2); }
+static void APIENTRY glad_lazy_glRecti(GLint x1, GLint y1, GLint x2, GLint y2) { glad_lazy_resolve(698); glad_glRecti(x1, y1, x2, y2); }
+static void APIENTRY glad_lazy_glRectiv(const GLint *v1, const GLint *v2) { glad_lazy_resolve(699); glad_glRectiv(v1, v2); }
+static void APIENTRY glad_lazy_glRects(GLshort x1, GLshort y1, GLshort x2, GLshort y2) { glad_lazy_resolve(700); glad_glRects(x1, y1, x2, y2); }
+static void APIENTRY glad_lazy_glRectsv(const GLshort *v1, const GLshort *v2) { glad_lazy_resolve(701); glad_glRectsv(v1, v2); }
+static void APIENTRY glad_lazy_glReleaseShaderCompiler(void) { glad_lazy_resolve(702); glad_glReleaseShaderCompiler(); }
+static GLint APIENTRY glad_lazy_glRenderMode(GLenum mode) { glad_lazy_resolve(703); return glad_glRenderMode(mode); }
+static void APIENTRY glad_lazy_glRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height) { glad_lazy_resolve(704); glad_glRenderbufferStorage(target, internalformat, width, height); }
+static void APIENTRY glad_lazy_glRenderbufferStorageMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) { glad_lazy_resolve(705); glad_glRenderbufferStorageMultisample(target, samples, internalformat, width, height); }
+static void APIENTRY glad_lazy_glResumeTransformFeedback(void) { glad_lazy_resolve(706); glad_glResumeTransformFeedback(); }
+static void APIENTRY glad_lazy_glRotated(GLdouble angle, GLdouble x, GLdouble y, GLdouble z) { glad_lazy_resolve(707); glad_glRotated(angle, x, y, z); }
+static void APIENTRY glad_lazy_glRotatef(GLfloat angle, GLfloat x, GLfloat y, GLfloat z) { glad_lazy_resolve(708); glad_glRotatef(angle, x, y, z); }
+static void APIENTRY glad_lazy_glSampleCoverage(GLfloat value, GLboolean invert) { glad_lazy_resolve(709); glad_glSampleCoverage(value, invert); }
+static void APIENTRY glad_lazy_glSampleMaski(GLuint maskNumber, GLbitfield mask) { glad_lazy_resolve(710); glad_glSampleMaski(maskNumber, mask); }
+static void APIENTRY glad_lazy_glSamplerParameterIiv(GLuint sampler, GLenum pname, const GLint *param) { glad_lazy_resolve(711); glad_glSamplerParameterIiv(sampler, pname, param); }
+static void APIENTRY glad_lazy_glSamplerParameterIuiv(GLuint sampler, GLenum pname, const GLuint *param) { glad_lazy_resolve(712); glad_glSamplerParameterIuiv(sampler, pname, param); }
+static void APIENTRY glad_lazy_glSamplerParameterf(GLuint sampler, GLenum pname, GLfloat param) { glad_lazy_resolve(713); glad_glSamplerParameterf(sampler, pname, param); }
+static void APIENTRY glad_lazy_glSamplerParameterfv(GLuint sampler, GLenum pname, const GLfloat *param) { glad_lazy_resolve(714); glad_glSamplerParameterfv(sampler, pname, param); }
+static void APIENTRY glad_lazy_glSamplerParameteri(GLuint sampler, GLenum pname, GLint param) { glad_lazy_resolve(715); glad_glSamplerParameteri(sampler, pname, param); }
+static void APIENTRY glad_lazy_glSamplerParameteriv(GLuint sampler, GLenum pname, const GLint *param) { glad_lazy_resolve(716); glad_glSamplerParameteriv(sampler, pname, param); }
+static void APIENTRY glad_lazy_glScaled(GLdouble x, GLdouble y, GLdouble z) { glad_lazy_resolve(717); glad_glScaled(x, y, z); }
+static void APIENTRY glad_lazy_glScalef(GLfloat x, GLfloat y, GLfloat z) { glad_lazy_resolve(718); glad_glScalef(x, y, z); }
+static void APIENTRY glad_lazy_glScissor(GLint x, GLint y, GLsizei width, GLsizei height) { glad_lazy_resolve(719); glad_glScissor(x, y, width, height); }
+static void APIENTRY glad_lazy_glScissorArrayv(GLuint first, GLsizei count, const GLint *v) { glad_lazy_resolve(720); glad_glScissorArrayv(first, count, v); }
+static void APIENTRY glad_lazy_glScissorIndexed(GLuint index, GLint left, GLint bottom, GLsizei width, GLsizei height) { glad_lazy_resolve(721); glad_glScissorIndexed(index, left, bottom, width, height); }
+static void APIENTRY glad_lazy_glScissorIndexedv(GLuint index, const GLint *v) { glad_lazy_resolve(722); glad_glScissorIndexedv(index, v); }
+static void APIENTRY glad_lazy_glSecondaryColor3b(GLbyte red, GLbyte green, GLbyte blue) { glad_lazy_resolve(723); glad_glSecondaryColor3b(red, green, blue); }
+static void APIENTRY glad_lazy_glSecondaryColor3bv(const GLbyte *v) { glad_lazy_resolve(724); glad_glSecondaryColor3bv(v); }
+static void APIENTRY glad_lazy_glSecondaryColor3d(GLdouble red, GLdouble green, GLdouble blue) { glad_lazy_resolve(725); glad_glSecondaryColor3d(red, green, blue); }
+static void APIENTRY glad_lazy_glSecondaryColor3dv(const GLdouble *v) { glad_lazy_resolve(726); glad_glSecondaryColor3dv(v); }
+static void APIENTRY glad_lazy_glSecondaryColor3f(GLfloat red, GLfloat green, GLfloat blue) { glad_lazy_resolve(727); glad_glSecondaryColor3f(red, green, blue); }
+static void APIENTRY glad_lazy_glSecondaryColor3fv(const GLfloat *v) { glad_lazy_resolve(728); glad_glSecondaryColor3fv(v); }
+static void APIENTRY glad_lazy_glSecondaryColor3i(GLint red, GLint green, GLint blue) { glad_lazy_resolve(729); glad_glSecondaryColor3i(red, green, blue); }
+static void APIENTRY glad_lazy_glSecondaryColor3iv(const GLint *v) { glad_lazy_resolve(730); glad_glSecondaryColor3iv(v); }
+static void APIENTRY glad_lazy_glSecondaryColor3s(GLshort red, GLshort green, GLshort blue) { glad_lazy_resolve(731); glad_glSecondaryColor3s(red, green, blue); }
+static void APIENTRY glad_lazy_glSecondaryColor3sv(const GLshort *v) { glad_lazy_resolve(732); glad_glSecondaryColor3sv(v); }
+static void APIENTRY glad_lazy_glSecondaryColor3ub(GLubyte red, GLubyte green, GLubyte blue) { glad_lazy_resolve(733); glad_glSecondaryColor3ub(red, green, blue); }
+static void APIENTRY glad_lazy_glSecondaryColor3ubv(const GLubyte *v) { glad_lazy_resolve(734); glad_glSecondaryColor3ubv(v); }
+static void APIENTRY glad_lazy_glSecondaryColor3ui(GLuint red, GLuint green, GLuint blue) { glad_lazy_resolve(735); glad_glSecondaryColor3ui(red, green, blue); }
+static void APIENTRY glad_lazy_glSecondaryColor3uiv(const GLuint *v) { glad_lazy_resolve(736); glad_glSecondaryColor3uiv(v); }
+static void APIENTRY glad_lazy_glSecondaryColor3us(GLushort red, GLushort green, GLushort blue) { glad_lazy_resolve(737); glad_glSecondaryColor3us(red, green, blue); }
+static void APIENTRY glad_lazy_glSecondaryColor3usv(const GLushort *v) { glad_lazy_resolve(738); glad_glSecondaryColor3usv(v); }
+static void APIENTRY glad_lazy_glSecondaryColorP3ui(GLenum type, GLuint color) { glad_lazy_resolve(739); glad_glSecondaryColorP3ui(type, color); }
+static void APIENTRY glad_lazy_glSecondaryColorP3uiv(GLenum type, const GLuint *color) { glad_lazy_resolve(740); glad_glSecondaryColorP3uiv(type, color); }
+static void APIENTRY glad_lazy_glSecondaryColorPointer(GLint size, GLenum type, GLsizei stride, const void *pointer) { glad_lazy_resolve(741); glad_glSecondaryColorPointer(size, type, stride, pointer); }
+static void APIENTRY glad_lazy_glSelectBuffer(GLsizei size, GLuint *buffer) { glad_lazy_resolve(742); glad_glSelectBuffer(size, buffer); }
+static void APIENTRY glad_lazy_glShadeModel(GLenum mode) { glad_lazy_resolve(743); glad_glShadeModel(mode); }
+static void APIENTRY glad_lazy_glShaderBinary(GLsizei count, const GLuint *shaders, GLenum binaryformat, const void *binary, GLsizei length) { glad_lazy_resolve(744); glad_glShaderBinary(count, shaders, binaryformat, binary, length); }
+static void APIENTRY glad_lazy_glShaderSource(GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length) { glad_lazy_resolve(745); glad_glShaderSource(shader, count, string, length); }
+static void APIENTRY glad_lazy_glShaderStorageBlockBinding(GLuint program, GLuint storageBlockIndex, GLuint storageBlockBinding) { glad_lazy_resolve(746); glad_glShaderStorageBlockBinding(program, storageBlockIndex, storageBlockBinding); }
+static void APIENTRY glad_lazy_glSpecializeShader(GLuint shader, const GLchar *pEntryPoint, GLuint numSpecializationConstants, const GLuint *pConstantIndex, const GLuint *pConstantValue) { glad_lazy_resolve(747); glad_glSpecializeShader(shader, pEntryPoint, numSpecializationConstants, pConstantIndex, pConstantValue); }
+static void APIENTRY glad_lazy_glStencilFunc(GLenum func, GLint ref, GLuint mask) { glad_lazy_resolve(748); glad_glStencilFunc(func, ref, mask); }
+static void APIENTRY glad_lazy_glStencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint mask) { glad_lazy_resolve(749); glad_glStencilFuncSeparate(face, func, ref, mask); }
+static void APIENTRY glad_lazy_glStencilMask(GLuint mask) { glad_lazy_resolve(750); glad_glStencilMask(mask); }
+static void APIENTRY glad_lazy_glStencilMaskSeparate(GLenum face, GLuint mask) { glad_lazy_resolve(751); glad_glStencilMaskSeparate(face, mask); }
+static void APIENTRY glad_lazy_glStencilOp(GLenum fail, GLenum zfail, GLenum zpass) { glad_lazy_resolve(752); glad_glStencilOp(fail, zfail, zpass); }
+static void APIENTRY glad_lazy_glStencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass) { glad_lazy_resolve(753); glad_glStencilOpSeparate(face, sfail, dpfail, dppass); }
+static void APIENTRY glad_lazy_glTexBuffer(GLenum target, GLenum internalformat, GLuint buffer) { glad_lazy_resolve(754); glad_glTexBuffer(target, internalformat, buffer); }
+static void APIENTRY glad_lazy_glTexBufferRange(GLenum target, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size) { glad_lazy_resolve(755); glad_glTexBufferRange(target, internalformat, buffer, offset, size); }
+static void APIENTRY glad_lazy_glTexCoord1d(GLdouble s) { glad_lazy_resolve(756); glad_glTexCoord1d(s); }
+static void APIENTRY glad_lazy_glTexCoord1dv(const GLdouble *v) { glad_lazy_resolve(757); glad_glTexCoord1dv(v); }
+static void APIENTRY glad_lazy_glTexCoord1f(GLfloat s) { glad_lazy_resolve(758); glad_glTexCoord1f(s); }
+static void APIENTRY glad_lazy_glTexCoord1fv(const GLfloat *v) { glad_lazy_resolve(759); glad_glTexCoord1fv(v); }
+static void APIENTRY glad_lazy_glTexCoord1i(GLint s) { glad_lazy_resolve(760); glad_glTexCoord1i(s); }
+static void APIENTRY glad_lazy_glTexCoord1iv(const GLint *v) { glad_lazy_resolve(761); glad_glTexCoord1iv(v); }
+static void APIENTRY glad_lazy_glTexCoord1s(GLshort s) { glad_lazy_resolve(762); glad_glTexCoord1s(s); }
+static void APIENTRY glad_lazy_glTexCoord1sv(const GLshort *v) { glad_lazy_resolve(763); glad_glTexCoord1sv(v); }
+static void APIENTRY glad_lazy_glTexCoord2d(GLdouble s, GLdouble t) { glad_lazy_resolve(764); glad_glTexCoord2d(s, t); }
+static void APIENTRY glad_lazy_glTexCoord2dv(const GLdouble *v) { glad_lazy_resolve(765); glad_glTexCoord2dv(v); }
+static void APIENTRY glad_lazy_glTexCoord2f(GLfloat s, GLfloat t) { glad_lazy_resolve(766); glad_glTexCoord2f(s, t); }
+static void APIENTRY glad_lazy_glTexCoord2fv(const GLfloat *v) { glad_lazy_resolve(767); glad_glTexCoord2fv(v); }
+static void APIENTRY glad_lazy_glTexCoord2i(GLint s, GLint t) { glad_lazy_resolve(768); glad_glTexCoord2i(s, t); }
+static void APIENTRY glad_lazy_glTexCoord2iv(const GLint *v) { glad_lazy_resolve(769); glad_glTexCoord2iv(v); }
+static void APIENTRY glad_lazy_glTexCoord2s(GLshort s, GLshort t) { glad_lazy_resolve(770); glad_glTexCoord2s(s, t); }
+static void APIENTRY glad_lazy_glTexCoord2sv(const GLshort *v) { glad_lazy_resolve(771); glad_glTexCoord2sv(v); }
+static void APIENTRY glad_lazy_glTexCoord3d(GLdouble s, GLdouble t, GLdouble r) { glad_lazy_resolve(772); glad_glTexCoord3d(s, t, r); }
+static void APIENTRY glad_lazy_glTexCoord3dv(const GLdouble *v) { glad_lazy_resolve(773); glad_glTexCoord3dv(v); }
+static void APIENTRY glad_lazy_glTexCoord3f(GLfloat s, GLfloat t, GLfloat r) { glad_lazy_resolve(774); glad_glTexCoord3f(s, t, r); }
+static void APIENTRY glad_lazy_glTexCoord3fv(const GLfloat *v) { glad_lazy_resolve(775); glad_glTexCoord3fv(v); }
+static void APIENTRY glad_lazy_glTexCoord3i(GLint s, GLint t, GLint r) { glad_lazy_resolve(776); glad_glTexCoord3i(s, t, r); }
+static void APIENTRY glad_lazy_glTexCoord3iv(const GLint *v) { glad_lazy_resolve(777); glad_glTexCoord3iv(v); }
+static void APIENTRY glad_lazy_glTexCoord3s(GLshort s, GLshort t, GLshort r) { glad_lazy_resolve(778); glad_glTexCoord3s(s, t, r); }
+static void APIENTRY glad_lazy_glTexCoord3sv(const GLshort *v) { glad_lazy_resolve(779); glad_glTexCoord3sv(v); }
+static void APIENTRY glad_lazy_glTexCoord4d(GLdouble s, GLdouble t, GLdouble r, GLdouble q) { glad_lazy_resolve(780); glad_glTexCoord4d(s, t, r, q); }
+static void APIENTRY glad_lazy_glTexCoord4dv(const GLdouble *v) { glad_lazy_resolve(781); glad_glTexCoord4dv(v); }
+static void APIENTRY glad_lazy_glTexCoord4f(GLfloat s, GLfloat t, GLfloat r, GLfloat q) { glad_lazy_resolve(782); glad_glTexCoord4f(s, t, r, q); }
+static void APIENTRY glad_lazy_glTexCoord4fv(const GLfloat *v) { glad_lazy_resolve(783); glad_glTexCoord4fv(v); }
+static void APIENTRY glad_lazy_glTexCoord4i(GLint s, GLint t, GLint r, GLint q) { glad_lazy_resolve(784); glad_glTexCoord4i(s, t, r, q); }
+static void APIENTRY glad_lazy_glTexCoord4iv(const GLint *v) { glad_lazy_resolve(785); glad_glTexCoord4iv(v); }
+static void APIENTRY glad_lazy_glTexCoord4s(GLshort s, GLshort t, GLshort r, GLshort q) { glad_lazy_resolve(786); glad_glTexCoord4s(s, t, r, q); }
+static void APIENTRY glad_lazy_glTexCoord4sv(const GLshort *v) { glad_lazy_resolve(787); glad_glTexCoord4sv(v); }
+static void APIENTRY glad_lazy_glTexCoordP1ui(GLenum type, GLuint coords) { glad_lazy_resolve(788); glad_glTexCoordP1ui(type, coords); }
+static void APIENTRY glad_lazy_glTexCoordP1uiv(GLenum type, const GLuint *coords) { glad_lazy_resolve(789); glad_glTexCoordP1uiv(type, coords); }
+static void APIENTRY glad_lazy_glTexCoordP2ui(GLenum type, GLuint coords) { glad_lazy_resolve(790); glad_glTexCoordP2ui(type, coords); }
+static void APIENTRY glad_lazy_glTexCoordP2uiv(GLenum type, const GLuint *coords) { glad_lazy_resolve(791); glad_glTexCoordP2uiv(type, coords); }
+static void APIENTRY glad_lazy_glTexCoordP3ui(GLenum type, GLuint coords) { glad_lazy_resolve(792); glad_glTexCoordP3ui(type, coords); }
+static void APIENTRY glad_lazy_glTexCoordP3uiv(GLenum type, const GLuint *coords) { glad_lazy_resolve(793); glad_glTexCoordP3uiv(type, coords); }
+static void APIENTRY glad_lazy_glTexCoordP4ui(GLenum type, GLuint coords) { glad_lazy_resolve(794); glad_glTexCoordP4ui(type, coords); }
+static void APIENTRY glad_lazy_glTexCoordP4uiv(GLenum type, const GLuint *coords) { glad_lazy_resolve(795); glad_glTexCoordP4uiv(type, coords); }
+static void APIENTRY glad_lazy_glTexCoordPointer(GLint size, GLenum type, GLsizei stride, const void *pointer) { glad_lazy_resolve(796); glad_glTexCoordPointer(size, type, stride, pointer); }
+static void APIENTRY glad_lazy_glTexEnvf(GLenum target, GLenum pname, GLfloat param) { glad_lazy_resolve(797); glad_glTexEnvf(target, pname, param); }
+static void APIENTRY glad_lazy_glTexEnvfv(GLenum target, GLenum pname, const GLfloat *params) { glad_lazy_resolve(798); glad_glTexEnvfv(target, pname, params); }
+static void APIENTRY glad_lazy_glTexEnvi(GLenum target, GLenum pname, GLint param) { glad_lazy_resolve(799); glad_glTexEnvi(target, pname, param); }
+static void APIENTRY glad_lazy_glTexEnviv(GLenum target, GLenum pname, const GLint *params) { glad_lazy_resolve(800); glad_glTexEnviv(target, pname, params); }
+static void APIENTRY glad_lazy_glTexGend(GLenum coord, GLenum pname, GLdouble param) { glad_lazy_resolve(801); glad_glTexGend(coord, pname, param); }
+static void APIENTRY glad_lazy_glTexGendv(GLenum coord, GLenum pname, const GLdouble *params) { glad_lazy_resolve(802); glad_glTexGendv(coord, pname, params); }
+static void APIENTRY glad_lazy_glTexGenf(GLenum coord, GLenum pname, GLfloat param) { glad_lazy_resolve(803); glad_glTexGenf(coord, pname, param); }
+static void APIENTRY glad_lazy_glTexGenfv(GLenum coord, GLenum pname, const GLfloat *params) { glad_lazy_resolve(804); glad_glTexGenfv(coord, pname, params); }
+static void APIENTRY glad_lazy_glTexGeni(GLenum coord, GLenum pname, GLint param) { glad_lazy_resolve(805); glad_glTexGeni(coord, pname, param); }
+static void APIENTRY glad_lazy_glTexGeniv(GLenum coord, GLenum pname, const GLint *params) { glad_lazy_resolve(806); glad_glTexGeniv(coord, pname, params); }
+static void APIENTRY glad_lazy_glTexImage1D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels) { glad_lazy_resolve(807); glad_glTexImage1D(target, level, internalformat, width, border, format, type, pixels); }
+static void APIENTRY glad_lazy_glTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels) { glad_lazy_resolve(808); glad_glTexImage2D(target, level, internalformat, width, height, border, format, type, pixels); }
+static void APIENTRY glad_lazy_glTexImage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) { glad_lazy_resolve(809); glad_glTexImage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations); }
+static void APIENTRY glad_lazy_glTexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels) { glad_lazy_resolve(810); glad_glTexImage3D(target, level, internalformat, width, height, depth, border, format, type, pixels); }
+static void APIENTRY glad_lazy_glTexImage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) { glad_lazy_resolve(811); glad_glTexImage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations); }
+static void APIENTRY glad_lazy_glTexParameterIiv(GLenum target, GLenum pname, const GLint *params) { glad_lazy_resolve(812); glad_glTexParameterIiv(target, pname, params); }
+static void APIENTRY glad_lazy_glTexParameterIuiv(GLenum target, GLenum pname, const GLuint *params) { glad_lazy_resolve(813); glad_glTexParameterIuiv(target, pname, params); }
+static void APIENTRY glad_lazy_glTexParameterf(GLenum target, GLenum pname, GLfloat param) { glad_lazy_resolve(814); glad_glTexParameterf(target, pname, param); }
+static void APIENTRY glad_lazy_glTexParameterfv(GLenum target, GLenum pname, const GLfloat *params) { glad_lazy_resolve(815); glad_glTexParameterfv(target, pname, params); }
+static void APIENTRY glad_lazy_glTexParameteri(GLenum target, GLenum pname, GLint param) { glad_lazy_resolve(816); glad_glTexParameteri(target, pname, param); }
+static void APIENTRY glad_lazy_glTexParameteriv(GLenum target, GLenum pname, const GLint *params) { glad_lazy_resolve(817); glad_glTexParameteriv(target, pname, params); }
+static void APIENTRY glad_lazy_glTexStorage1D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width) { glad_lazy_resolve(818); glad_glTexStorage1D(target, levels, internalformat, width); }
+static void APIENTRY glad_lazy_glTexStorage2D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height) { glad_lazy_resolve(819); glad_glTexStorage2D(target, levels, internalformat, width, height); }
+static void APIENTRY glad_lazy_glTexStorage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) { glad_lazy_resolve(820); glad_glTexStorage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations); }
+static void APIENTRY glad_lazy_glTexStorage3D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth) { glad_lazy_resolve(821); glad_glTexStorage3D(target, levels, internalformat, width, height, depth); }
+static void APIENTRY glad_lazy_glTexStorage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) { glad_lazy_resolve(822); glad_glTexStorage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations); }
+static void APIENTRY glad_lazy_glTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels) { glad_lazy_resolve(823); glad_glTexSubImage1D(target, level, xoffset, width, format, type, pixels); }
+static void APIENTRY glad_lazy_glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) { glad_lazy_resolve(824); glad_glTexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels); }
+static void APIENTRY glad_lazy_glTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels) { glad_lazy_resolve(825); glad_glTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels); }
+static void APIENTRY glad_lazy_glTextureBarrier(void) { glad_lazy_resolve(826); glad_glTextureBarrier(); }
+static void APIENTRY glad_lazy_glTextureBuffer(GLuint texture, GLenum internalformat, GLuint buffer) { glad_lazy_resolve(827); glad_glTextureBuffer(texture, internalformat, buffer); }
+static void APIENTRY glad_lazy_glTextureBufferRange(GLuint texture, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size) { glad_lazy_resolve(828); glad_glTextureBufferRange(texture, internalformat, buffer, offset, size); }
+static void APIENTRY glad_lazy_glTextureParameterIiv(GLuint texture, GLenum pname, const GLint *params) { glad_lazy_resolve(829); glad_glTextureParameterIiv(texture, pname, params); }
+static void APIENTRY glad_lazy_glTextureParameterIuiv(GLuint texture, GLenum pname, const GLuint *params) { glad_lazy_resolve(830); glad_glTextureParameterIuiv(texture, pname, params); }
+static void APIENTRY glad_lazy_glTextureParameterf(GLuint texture, GLenum pname, GLfloat param) { glad_lazy_resolve(831); glad_glTextureParameterf(texture, pname, param); }
+static void APIENTRY glad_lazy_glTextureParameterfv(GLuint texture, GLenum pname, const GLfloat *param) { glad_lazy_resolve(832); glad_glTextureParameterfv(texture, pname, param); }
+static void APIENTRY glad_lazy_glTextureParameteri(GLuint texture, GLenum pname, GLint param) { glad_lazy_resolve(833); glad_glTextureParameteri(texture, pname, param); }
+static void APIENTRY glad_lazy_glTextureParameteriv(GLuint texture, GLenum pname, const GLint *param) { glad_lazy_resolve(834); glad_glTextureParameteriv(texture, pname, param); }
+static void APIENTRY glad_lazy_glTextureStorage1D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width) { glad_lazy_resolve(835); glad_glTextureStorage1D(texture, levels, internalformat, width); }
+static void APIENTRY glad_lazy_glTextureStorage2D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height) { glad_lazy_resolve(836); glad_glTextureStorage2D(texture, levels, internalformat, width, height); }
+static void APIENTRY glad_lazy_glTextureStorage2DMultisample(GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) { glad_lazy_resolve(837); glad_glTextureStorage2DMultisample(texture, samples, internalformat, width, height, fixedsamplelocations); }
+static void APIENTRY glad_lazy_glTextureStorage3D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth) { glad_lazy_resolve(838); glad_glTextureStorage3D(texture, levels, internalformat, width, height, depth); }
+static void APIENTRY glad_lazy_glTextureStorage3DMultisample(GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) { glad_lazy_resolve(839); glad_glTextureStorage3DMultisample(texture, samples, internalformat, width, height, depth, fixedsamplelocations); }
+static void APIENTRY glad_lazy_glTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels) { glad_lazy_resolve(840); glad_glTextureSubImage1D(texture, level, xoffset, width, format, type, pixels); }
+static void APIENTRY glad_lazy_glTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) { glad_lazy_resolve(841); glad_glTextureSubImage2D(texture, level, xoffset, yoffset, width, height, format, type, pixels); }
+static void APIENTRY glad_lazy_glTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels) { glad_lazy_resolve(842); glad_glTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels); }
+static void APIENTRY glad_lazy_glTextureView(GLuint texture, GLenum target, GLuint origtexture, GLenum internalformat, GLuint minlevel, GLuint numlevels, GLuint minlayer, GLuint numlayers) { glad_lazy_resolve(843); glad_glTextureView(texture, target, origtexture, internalformat, minlevel, numlevels, minlayer, numlayers); }
+static void APIENTRY glad_lazy_glTransformFeedbackBufferBase(GLuint xfb, GLuint index, GLuint buffer) { glad_lazy_resolve(844); glad_glTransformFeedbackBufferBase(xfb, index, buffer); }
+static void APIENTRY glad_lazy_glTransformFeedbackBufferRange(GLuint xfb, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) { glad_lazy_resolve(845); glad_glTransformFeedbackBufferRange(xfb, index, buffer, offset, size); }
+static void APIENTRY glad_lazy_glTransformFeedbackVaryings(GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode) { glad_lazy_resolve(846); glad_glTransformFeedbackVaryings(program, count, varyings, bufferMode); }
+static void APIENTRY glad_lazy_glTranslated(GLdouble x, GLdouble y, GLdouble z) { glad_lazy_resolve(847); glad_glTranslated(x, y, z); }
+static void APIENTRY glad_lazy_glTranslatef(GLfloat x, GLfloat y, GLfloat z) { glad_lazy_resolve(848); glad_glTranslatef(x, y, z); }
+static void APIENTRY glad_lazy_glUniform1d(GLint location, GLdouble x) { glad_lazy_resolve(849); glad_glUniform1d(location, x); }
+static void APIENTRY glad_lazy_glUniform1dv(GLint location, GLsizei count, const GLdouble *value) { glad_lazy_resolve(850); glad_glUniform1dv(location, count, value); }
+static void APIENTRY glad_lazy_glUniform1f(GLint location, GLfloat v0) { glad_lazy_resolve(851); glad_glUniform1f(location, v0); }
+static void APIENTRY glad_lazy_glUniform1fv(GLint location, GLsizei count, const GLfloat *value) { glad_lazy_resolve(852); glad_glUniform1fv(location, count, value); }
+static void APIENTRY glad_lazy_glUniform1i(GLint location, GLint v0) { glad_lazy_resolve(853); glad_glUniform1i(location, v0); }
+static void APIENTRY glad_lazy_glUniform1iv(GLint location, GLsizei count, const GLint *value) { glad_lazy_resolve(854); glad_glUniform1iv(location, count, value); }
+static void APIENTRY glad_lazy_glUniform1ui(GLint location, GLuint v0) { glad_lazy_resolve(855); glad_glUniform1ui(location, v0); }
+static void APIENTRY glad_lazy_glUniform1uiv(GLint location, GLsizei count, const GLuint *value) { glad_lazy_resolve(856); glad_glUniform1uiv(location, count, value); }
+static void APIENTRY glad_lazy_glUniform2d(GLint location, GLdouble x, GLdouble y) { glad_lazy_resolve(857); glad_glUniform2d(location, x, y); }
+static void APIENTRY glad_lazy_glUniform2dv(GLint location, GLsizei count, const GLdouble *value) { glad_lazy_resolve(858); glad_glUniform2dv(location, count, value); }
+static void APIENTRY glad_lazy_glUniform2f(GLint location, GLfloat v0, GLfloat v1) { glad_lazy_resolve(859); glad_glUniform2f(location, v0, v1); }
+static void APIENTRY glad_lazy_glUniform2fv(GLint location, GLsizei count, const GLfloat *value) { glad_lazy_resolve(860); glad_glUniform2fv(location, count, value); }
+static void APIENTRY glad_lazy_glUniform2i(GLint location, GLint v0, GLint v1) { glad_lazy_resolve(861); glad_glUniform2i(location, v0, v1); }
+static void APIENTRY glad_lazy_glUniform2iv(GLint location, GLsizei count, const GLint *value) { glad_lazy_resolve(862); glad_glUniform2iv(location, count, value); }
+static void APIENTRY glad_lazy_glUniform2ui(GLint location, GLuint v0, GLuint v1) { glad_lazy_resolve(863); glad_glUniform2ui(location, v0, v1); }
+static void APIENTRY glad_lazy_glUniform2uiv(GLint location, GLsizei count, const GLuint *value) { glad_lazy_resolve(864); glad_glUniform2uiv(location, count, value); }
+static void APIENTRY glad_lazy_glUniform3d(GLint location, GLdouble x, GLdouble y, GLdouble z) { glad_lazy_resolve(865); glad_glUniform3d(location, x, y, z); }
+static void APIENTRY glad_lazy_glUniform3dv(GLint location, GLsizei count, const GLdouble *value) { glad_lazy_resolve(866); glad_glUniform3dv(location, count, value); }
+static void APIENTRY glad_lazy_glUniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2) { glad_lazy_resolve(867); glad_glUniform3f(location, v0, v1, v2); }
+static void APIENTRY glad_lazy_glUniform3fv(GLint location, GLsizei count, const GLfloat *value) { glad_lazy_resolve(868); glad_glUniform3fv(location, count, value); }
+static void APIENTRY glad_lazy_glUniform3i(GLint location, GLint v0, GLint v1, GLint v2) { glad_lazy_resolve(869); glad_glUniform3i(location, v0, v1, v2); }
+static void APIENTRY glad_lazy_glUniform3iv(GLint location, GLsizei count, const GLint *value) { glad_lazy_resolve(870); glad_glUniform3iv(location, count, value); }
+static void APIENTRY glad_lazy_glUniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2) { glad_lazy_resolve(871); glad_glUniform3ui(location, v0, v1, v2); }
+static void APIENTRY glad_lazy_glUniform3uiv(GLint location, GLsizei count, const GLuint *value) { glad_lazy_resolve(872); glad_glUniform3uiv(location, count, value); }
+static void APIENTRY glad_lazy_glUniform4d(GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w) { glad_lazy_resolve(873); glad_glUniform4d(location, x, y, z, w); }
+static void APIENTRY glad_lazy_glUniform4dv(GLint location, GLsizei count, const GLdouble *value) { glad_lazy_resolve(874); glad_glUniform4dv(location, count, value); }
+static void APIENTRY glad_lazy_glUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) { glad_lazy_resolve(875); glad_glUniform4f(location, v0, v1, v2, v3); }
+static void APIENTRY glad_lazy_glUniform4fv(GLint location, GLsizei count, const GLfloat *value) { glad_lazy_resolve(876); glad_glUniform4fv(location, count, value); }
+static void APIENTRY glad_lazy_glUniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3) { glad_lazy_resolve(877); glad_glUniform4i(location, v0, v1, v2, v3); }
+static void APIENTRY glad_lazy_glUniform4iv(GLint location, GLsizei count, const GLint *value) { glad_lazy_resolve(878); glad_glUniform4iv(location, count, value); }
+static void APIENTRY glad_lazy_glUniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) { glad_lazy_resolve(879); glad_glUniform4ui(location, v0, v1, v2, v3); }
+static void APIENTRY glad_lazy_glUniform4uiv(GLint location, GLsizei count, const GLuint *value) { glad_lazy_resolve(880); glad_glUniform4uiv(location, count, value); }
+static void APIENTRY glad_lazy_glUniformBlockBinding(GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding) { glad_lazy_resolve(881); glad_glUniformBlockBinding(program, uniformBlockIndex, uniformBlockBinding); }
+static void APIENTRY glad_lazy_glUniformMatrix2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) { glad_lazy_resolve(882); glad_glUniformMatrix2dv(location, count, transpose, value); }
+static void APIENTRY glad_lazy_glUniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { glad_lazy_resolve(883); glad_glUniformMatrix2fv(location, count, transpose, value); }
+static void APIENTRY glad_lazy_glUniformMatrix2x3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) { glad_lazy_resolve(884); glad_glUniformMatrix2x3dv(location, count, transpose, value); }
+static void APIENTRY glad_lazy_glUniformMatrix2x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { glad_lazy_resolve(885); glad_glUniformMatrix2x3fv(location, count, transpose, value); }
+static void APIENTRY glad_lazy_glUniformMatrix2x4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) { glad_lazy_resolve(886); glad_glUniformMatrix2x4dv(location, count, transpose, value); }
+static void APIENTRY glad_lazy_glUniformMatrix2x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { glad_lazy_resolve(887); glad_glUniformMatrix2x4fv(location, count, transpose, value); }
+static void APIENTRY glad_lazy_glUniformMatrix3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) { glad_lazy_resolve(888); glad_glUniformMatrix3dv(location, count, transpose, value); }
+static void APIENTRY glad_lazy_glUniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { glad_lazy_resolve(889); glad_glUniformMatrix3fv(location, count, transpose, value); }
+static void APIENTRY glad_lazy_glUniformMatrix3x2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) { glad_lazy_resolve(890); glad_glUniformMatrix3x2dv(location, count, transpose, value); }
+static void APIENTRY glad_lazy_glUniformMatrix3x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { glad_lazy_resolve(891); glad_glUniformMatrix3x2fv(location, count, transpose, value); }
+static void APIENTRY glad_lazy_glUniformMatrix3x4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) { glad_lazy_resolve(892); glad_glUniformMatrix3x4dv(location, count, transpose, value); }
+static void APIENTRY glad_lazy_glUniformMatrix3x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { glad_lazy_resolve(893); glad_glUniformMatrix3x4fv(location, count, transpose, value); }
+static void APIENTRY glad_lazy_glUniformMatrix4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) { glad_lazy_resolve(894); glad_glUniformMatrix4dv(location, count, transpose, value); }
+static void APIENTRY glad_lazy_glUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { glad_lazy_resolve(895); glad_glUniformMatrix4fv(location, count, transpose, value); }
+static void APIENTRY glad_lazy_glUniformMatrix4x2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) { glad_lazy_resolve(896); glad_glUniformMatrix4x2dv(location, count, transpose, value); }
+static void APIENTRY glad_lazy_glUniformMatrix4x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { glad_lazy_resolve(897); glad_glUniformMatrix4x2fv(location, count, transpose, value); }
+static void APIENTRY glad_lazy_glUniformMatrix4x3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) { glad_lazy_resolve(898); glad_glUniformMatrix4x3dv(location, count, transpose, value); }
+static void APIENTRY glad_lazy_glUniformMatrix4x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { glad_lazy_resolve(899); glad_glUniformMatrix4x3fv(location, count, transpose, value); }
+static void APIENTRY glad_lazy_glUniformSubroutinesuiv(GLenum shadertype, GLsizei count, const GLuint *indices) { glad_lazy_resolve(900); glad_glUniformSubroutinesuiv(shadertype, count, indices); }
+static GLboolean APIENTRY glad_lazy_glUnmapBuffer(GLenum target) { glad_lazy_resolve(901); return glad_glUnmapBuffer(target); }
+static GLboolean APIENTRY glad_lazy_glUnmapNamedBuffer(GLuint buffer) { glad_lazy_resolve(902); return glad_glUnmapNamedBuffer(buffer); }
+static void APIENTRY glad_lazy_glUseProgram(GLuint program) { glad_lazy_resolve(903); glad_glUseProgram(program); }
+static void APIENTRY glad_lazy_glUseProgramStages(GLuint pipeline, GLbitfield stages, GLuint program) { glad_lazy_resolve(904); glad_glUseProgramStages(pipeline, stages, program); }
+static void APIENTRY glad_lazy_glValidateProgram(GLuint program) { glad_lazy_resolve(905); glad_glValidateProgram(program); }
+static void APIENTRY glad_lazy_glValidateProgramPipeline(GLuint pipeline) { glad_lazy_resolve(906); glad_glValidateProgramPipeline(pipeline); }
+static void APIENTRY glad_lazy_glVertex2d(GLdouble x, GLdouble y) { glad_lazy_resolve(907); glad_glVertex2d(x, y); }
+static void APIENTRY glad_lazy_glVertex2dv(const GLdouble *v) { glad_lazy_resolve(908); glad_glVertex2dv(v); }
+static void APIENTRY glad_lazy_glVertex2f(GLfloat x, GLfloat y) { glad_lazy_resolve(909); glad_glVertex2f(x, y); }
+static void APIENTRY glad_lazy_glVertex2fv(const GLfloat *v) { glad_lazy_resolve(910); glad_glVertex2fv(v); }
+static void APIENTRY glad_lazy_glVertex2i(GLint x, GLint y) { glad_lazy_resolve(911); glad_glVertex2i(x, y); }
+static void APIENTRY glad_lazy_glVertex2iv(const GLint *v) { glad_lazy_resolve(912); glad_glVertex2iv(v); }
+static void APIENTRY glad_lazy_glVertex2s(GLshort x, GLshort y) { glad_lazy_resolve(913); glad_glVertex2s(x, y); }
+static void APIENTRY glad_lazy_glVertex2sv(const GLshort *v) { glad_lazy_resolve(914); glad_glVertex2sv(v); }
+static void APIENTRY glad_lazy_glVertex3d(GLdouble x, GLdouble y, GLdouble z) { glad_lazy_resolve(915); glad_glVertex3d(x, y, z); }
+static void APIENTRY glad_lazy_glVertex3dv(const GLdouble *v) { glad_lazy_resolve(916); glad_glVertex3dv(v); }
+static void APIENTRY glad_lazy_glVertex3f(GLfloat x, GLfloat y, GLfloat z) { glad_lazy_resolve(917); glad_glVertex3f(x, y, z); }
+static void APIENTRY glad_lazy_glVertex3fv(const GLfloat *v) { glad_lazy_resolve(918); glad_glVertex3fv(v); }
+static void APIENTRY glad_lazy_glVertex3i(GLint x, GLint y, GLint z) { glad_lazy_resolve(919); glad_glVertex3i(x, y, z); }
+static void APIENTRY glad_lazy_glVertex3iv(const GLint *v) { glad_lazy_resolve(920); glad_glVertex3iv(v); }
+static void APIENTRY glad_lazy_glVertex3s(GLshort x, GLshort y, GLshort z) { glad_lazy_resolve(921); glad_glVertex3s(x, y, z); }
+static void APIENTRY glad_lazy_glVertex3sv(const GLshort *v) { glad_lazy_resolve(922); glad_glVertex3sv(v); }
+static void APIENTRY glad_lazy_glVertex4d(GLdouble x, GLdouble y, GLdouble z, GLdouble w) { glad_lazy_resolve(923); glad_glVertex4d(x, y, z, w); }
+static void APIENTRY glad_lazy_glVertex4dv(const GLdouble *v) { glad_lazy_resolve(924); glad_glVertex4dv(v); }
+static void APIENTRY glad_lazy_glVertex4f(GLfloat x, GLfloat y, GLfloat z, GLfloat w) { glad_lazy_resolve(925); glad_glVertex4f(x, y, z, w); }
+static void APIENTRY glad_lazy_glVertex4fv(const GLfloat *v) { glad_lazy_resolve(926); glad_glVertex4fv(v); }
+static void APIENTRY glad_lazy_glVertex4i(GLint x, GLint y, GLint z, GLint w) { glad_lazy_resolve(927); glad_glVertex4i(x, y, z, w); }
+static void APIENTRY glad_lazy_glVertex4iv(const GLint *v) { glad_lazy_resolve(928); glad_glVertex4iv(v); }
+static void APIENTRY glad_lazy_glVertex4s(GLshort x, GLshort y, GLshort z, GLshort w) { glad_lazy_resolve(929); glad_glVertex4s(x, y, z, w); }
+static void APIENTRY glad_lazy_glVertex4sv(const GLshort *v) { glad_lazy_resolve(930); glad_glVertex4sv(v); }
+static void APIENTRY glad_lazy_glVertexArrayAttribBinding(GLuint vaobj, GLuint attribindex, GLuint bindingindex) { glad_lazy_resolve(931); glad_glVertexArrayAttribBinding(vaobj, attribindex, bindingindex); }
+static void APIENTRY glad_lazy_glVertexArrayAttribFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset) { glad_lazy_resolve(932); glad_glVertexArrayAttribFormat(vaobj, attribindex, size, type, normalized, relativeoffset); }
+static void APIENTRY glad_lazy_glVertexArrayAttribIFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) { glad_lazy_resolve(933); glad_glVertexArrayAttribIFormat(vaobj, attribindex, size, type, relativeoffset); }
+static void APIENTRY glad_lazy_glVertexArrayAttribLFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) { glad_lazy_resolve(934); glad_glVertexArrayAttribLFormat(vaobj, attribindex, size, type, relativeoffset); }
+static void APIENTRY glad_lazy_glVertexArrayBindingDivisor(GLuint vaobj, GLuint bindingindex, GLuint divisor) { glad_lazy_resolve(935); glad_glVertexArrayBindingDivisor(vaobj, bindingindex, divisor); }
+static void APIENTRY glad_lazy_glVertexArrayElementBuffer(GLuint vaobj, GLuint buffer) { glad_lazy_resolve(936); glad_glVertexArrayElementBuffer(vaobj, buffer); }
+static void APIENTRY glad_lazy_glVertexArrayVertexBuffer(GLuint vaobj, GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride) { glad_lazy_resolve(937); glad_glVertexArrayVertexBuffer(vaobj, bindingindex, buffer, offset, stride); }
+static void APIENTRY glad_lazy_glVertexArrayVertexBuffers(GLuint vaobj, GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizei *strides) { glad_lazy_resolve(938); glad_glVertexArrayVertexBuffers(vaobj, first, count, buffers, offsets, strides); }
+static void APIENTRY glad_lazy_glVertexAttrib1d(GLuint index, GLdouble x) { glad_lazy_resolve(939); glad_glVertexAttrib1d(index, x); }
+static void APIENTRY glad_lazy_glVertexAttrib1dv(GLuint index, const GLdouble *v) { glad_lazy_resolve(940); glad_glVertexAttrib1dv(index, v); }
+static void APIENTRY glad_lazy_glVertexAttrib1f(GLuint index, GLfloat x) { glad_lazy_resolve(941); glad_glVertexAttrib1f(index, x); }
+static void APIENTRY glad_lazy_glVertexAttrib1fv(GLuint index, const GLfloat *v) { glad_lazy_resolve(942); glad_glVertexAttrib1fv(index, v); }
+static void APIENTRY glad_lazy_glVertexAttrib1s(GLuint index, GLshort x) { glad_lazy_resolve(943); glad_glVertexAttrib1s(index, x); }
+static void APIENTRY glad_lazy_glVertexAttrib1sv(GLuint index, const GLshort *v) { glad_lazy_resolve(944); glad_glVertexAttrib1sv(index, v); }
+static void APIENTRY glad_lazy_glVertexAttrib2d(GLuint index, GLdouble x, GLdouble y) { glad_lazy_resolve(945); glad_glVertexAttrib2d(index, x, y); }
+static void APIENTRY glad_lazy_glVertexAttrib2dv(GLuint index, const GLdouble *v) { glad_lazy_resolve(946); glad_glVertexAttrib2dv(index, v); }
+static void APIENTRY glad_lazy_glVertexAttrib2f(GLuint index, GLfloat x, GLfloat y) { glad_lazy_resolve(947); glad_glVertexAttrib2f(index, x, y); }
+static void APIENTRY glad_lazy_glVertexAttrib2fv(GLuint index, const GLfloat *v) { glad_lazy_resolve(948); glad_glVertexAttrib2fv(index, v); }
+static void APIENTRY glad_lazy_glVertexAttrib2s(GLuint index, GLshort x, GLshort y) { glad_lazy_resolve(949); glad_glVertexAttrib2s(index, x, y); }
+static void APIENTRY glad_lazy_glVertexAttrib2sv(GLuint index, const GLshort *v) { glad_lazy_resolve(950); glad_glVertexAttrib2sv(index, v); }
+static void APIENTRY glad_lazy_glVertexAttrib3d(GLuint index, GLdouble x, GLdouble y, GLdouble z) { glad_lazy_resolve(951); glad_glVertexAttrib3d(index, x, y, z); }
+static void APIENTRY glad_lazy_glVertexAttrib3dv(GLuint index, const GLdouble *v) { glad_lazy_resolve(952); glad_glVertexAttrib3dv(index, v); }
+static void APIENTRY glad_lazy_glVertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z) { glad_lazy_resolve(953); glad_glVertexAttrib3f(index, x, y, z); }
+static void APIENTRY glad_lazy_glVertexAttrib3fv(GLuint index, const GLfloat *v) { glad_lazy_resolve(954); glad_glVertexAttrib3fv(index, v); }
+static void APIENTRY glad_lazy_glVertexAttrib3s(GLuint index, GLshort x, GLshort y, GLshort z) { glad_lazy_resolve(955); glad_glVertexAttrib3s(index, x, y, z); }
+static void APIENTRY glad_lazy_glVertexAttrib3sv(GLuint index, const GLshort *v) { glad_lazy_resolve(956); glad_glVertexAttrib3sv(index, v); }
+static void APIENTRY glad_lazy_glVertexAttrib4Nbv(GLuint index, const GLbyte *v) { glad_lazy_resolve(957); glad_glVertexAttrib4Nbv(index, v); }
+static void APIENTRY glad_lazy_glVertexAttrib4Niv(GLuint index, const GLint *v) { glad_lazy_resolve(958); glad_glVertexAttrib4Niv(index, v); }
+static void APIENTRY glad_lazy_glVertexAttrib4Nsv(GLuint index, const GLshort *v) { glad_lazy_resolve(959); glad_glVertexAttrib4Nsv(index, v); }
+static void APIENTRY glad_lazy_glVertexAttrib4Nub(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w) { glad_lazy_resolve(960); glad_glVertexAttrib4Nub(index, x, y, z, w); }
+static void APIENTRY glad_lazy_glVertexAttrib4Nubv(GLuint index, const GLubyte *v) { glad_lazy_resolve(961); glad_glVertexAttrib4Nubv(index, v); }
+static void APIENTRY glad_lazy_glVertexAttrib4Nuiv(GLuint index, const GLuint *v) { glad_lazy_resolve(962); glad_glVertexAttrib4Nuiv(index, v); }
+static void APIENTRY glad_lazy_glVertexAttrib4Nusv(GLuint index, const GLushort *v) { glad_lazy_resolve(963); glad_glVertexAttrib4Nusv(index, v); }
+static void APIENTRY glad_lazy_glVertexAttrib4bv(GLuint index, const GLbyte *v) { glad_lazy_resolve(964); glad_glVertexAttrib4bv(index, v); }
+static void APIENTRY glad_lazy_glVertexAttrib4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) { glad_lazy_resolve(965); glad_glVertexAttrib4d(index, x, y, z, w); }
+static void APIENTRY glad_lazy_glVertexAttrib4dv(GLuint index, const GLdouble *v) { glad_lazy_resolve(966); glad_glVertexAttrib4dv(index, v); }
+static void APIENTRY glad_lazy_glVertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w) { glad_lazy_resolve(967); glad_glVertexAttrib4f(index, x, y, z, w); }
+static void APIENTRY glad_lazy_glVertexAttrib4fv(GLuint index, const GLfloat *v) { glad_lazy_resolve(968); glad_glVertexAttrib4fv(index, v); }
+static void APIENTRY glad_lazy_glVertexAttrib4iv(GLuint index, const GLint *v) { glad_lazy_resolve(969); glad_glVertexAttrib4iv(index, v); }
+static void APIENTRY glad_lazy_glVertexAttrib4s(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w) { glad_lazy_resolve(970); glad_glVertexAttrib4s(index, x, y, z, w); }
+static void APIENTRY glad_lazy_glVertexAttrib4sv(GLuint index, const GLshort *v) { glad_lazy_resolve(971); glad_glVertexAttrib4sv(index, v); }
+static void APIENTRY glad_lazy_glVertexAttrib4ubv(GLuint index, const GLubyte *v) { glad_lazy_resolve(972); glad_glVertexAttrib4ubv(index, v); }
+static void APIENTRY glad_lazy_glVertexAttrib4uiv(GLuint index, const GLuint *v) { glad_lazy_resolve(973); glad_glVertexAttrib4uiv(index, v); }
+static void APIENTRY glad_lazy_glVertexAttrib4usv(GLuint index, const GLushort *v) { glad_lazy_resolve(974); glad_glVertexAttrib4usv(index, v); }
+static void APIENTRY glad_lazy_glVertexAttribBinding(GLuint attribindex, GLuint bindingindex) { glad_lazy_resolve(975); glad_glVertexAttribBinding(attribindex, bindingindex); }
+static void APIENTRY glad_lazy_glVertexAttribDivisor(GLuint index, GLuint divisor) { glad_lazy_resolve(976); glad_glVertexAttribDivisor(index, divisor); }
+static void APIENTRY glad_lazy_glVertexAttribFormat(GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset) { glad_lazy_resolve(977); glad_glVertexAttribFormat(attribindex, size, type, normalized, relativeoffset); }
+static void APIENTRY glad_lazy_glVertexAttribI1i(GLuint index, GLint x) { glad_lazy_resolve(978); glad_glVertexAttribI1i(index, x); }
+static void APIENTRY glad_lazy_glVertexAttribI1iv(GLuint index, const GLint *v) { glad_lazy_resolve(979); glad_glVertexAttribI1iv(index, v); }
+static void APIENTRY glad_lazy_glVertexAttribI1ui(GLuint index, GLuint x) { glad_lazy_resolve(980); glad_glVertexAttribI1ui(index, x); }
+static void APIENTRY glad_lazy_glVertexAttribI1uiv(GLuint index, const GLuint *v) { glad_lazy_resolve(981); glad_glVertexAttribI1uiv(index, v); }
+static void APIENTRY glad_lazy_glVertexAttribI2i(GLuint index, GLint x, GLint y) { glad_lazy_resolve(982); glad_glVertexAttribI2i(index, x, y); }
+static void APIENTRY glad_lazy_glVertexAttribI2iv(GLuint index, const GLint *v) { glad_lazy_resolve(983); glad_glVertexAttribI2iv(index, v); }
+static void APIENTRY glad_lazy_glVertexAttribI2ui(GLuint index, GLuint x, GLuint y) { glad_lazy_resolve(984); glad_glVertexAttribI2ui(index, x, y); }
+static void APIENTRY glad_lazy_glVertexAttribI2uiv(GLuint index, const GLuint *v) { glad_lazy_resolve(985); glad_glVertexAttribI2uiv(index, v); }
+static void APIENTRY glad_lazy_glVertexAttribI3i(GLuint index, GLint x, GLint y, GLint z) { glad_lazy_resolve(986); glad_glVertexAttribI3i(index, x, y, z); }
+static void APIENTRY glad_lazy_glVertexAttribI3iv(GLuint index, const GLint *v) { glad_lazy_resolve(987); glad_glVertexAttribI3iv(index, v); }
+static void APIENTRY glad_lazy_glVertexAttribI3ui(GLuint index, GLuint x, GLuint y, GLuint z) { glad_lazy_resolve(988); glad_glVertexAttribI3ui(index, x, y, z); }
+static void APIENTRY glad_lazy_glVertexAttribI3uiv(GLuint index, const GLuint *v) { glad_lazy_resolve(989); glad_glVertexAttribI3uiv(index, v); }
+static void APIENTRY glad_lazy_glVertexAttribI4bv(GLuint index, const GLbyte *v) { glad_lazy_resolve(990); glad_glVertexAttribI4bv(index, v); }
+static void APIENTRY glad_lazy_glVertexAttribI4i(GLuint index, GLint x, GLint y, GLint z, GLint w) { glad_lazy_resolve(991); glad_glVertexAttribI4i(index, x, y, z, w); }
+static void APIENTRY glad_lazy_glVertexAttribI4iv(GLuint index, const GLint *v) { glad_lazy_resolve(992); glad_glVertexAttribI4iv(index, v); }
+static void APIENTRY glad_lazy_glVertexAttribI4sv(GLuint index, const GLshort *v) { glad_lazy_resolve(993); glad_glVertexAttribI4sv(index, v); }
+static void APIENTRY glad_lazy_glVertexAttribI4ubv(GLuint index, const GLubyte *v) { glad_lazy_resolve(994); glad_glVertexAttribI4ubv(index, v); }
+static void APIENTRY glad_lazy_glVertexAttribI4ui(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w) { glad_lazy_resolve(995); glad_glVertexAttribI4ui(index, x, y, z, w); }
+static void APIENTRY glad_lazy_glVertexAttribI4uiv(GLuint index, const GLuint *v) { glad_lazy_resolve(996); glad_glVertexAttribI4uiv(index, v); }
+static void APIENTRY glad_lazy_glVertexAttribI4usv(GLuint index, const GLushort *v) { glad_lazy_resolve(997); glad_glVertexAttribI4usv(index, v); }
+static void APIENTRY glad_lazy_glVertexAttribIFormat(GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) { glad_lazy_resolve(998); glad_glVertexAttribIFormat(attribindex, size, type, relativeoffset); }
+static void APIENTRY glad_lazy_glVertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer) { glad_lazy_resolve(999); glad_glVertexAttribIPointer(index, size, type, stride, pointer); }
+static void APIENTRY glad_lazy_glVertexAttribL1d(GLuint index, GLdouble x) { glad_lazy_resolve(1000); glad_glVertexAttribL1d(index, x); }
+static void APIENTRY glad_lazy_glVertexAttribL1dv(GLuint index, const GLdouble *v) { glad_lazy_resolve(1001); glad_glVertexAttribL1dv(index, v); }
+static void APIENTRY glad_lazy_glVertexAttribL2d(GLuint index, GLdouble x, GLdouble y) { glad_lazy_resolve(1002); glad_glVertexAttribL2d(index, x, y); }
+static void APIENTRY glad_lazy_glVertexAttribL2dv(GLuint index, const GLdouble *v) { glad_lazy_resolve(1003); glad_glVertexAttribL2dv(index, v); }
+static void APIENTRY glad_lazy_glVertexAttribL3d(GLuint index, GLdouble x, GLdouble y, GLdouble z) { glad_lazy_resolve(1004); glad_glVertexAttribL3d(index, x, y, z); }
+static void APIENTRY glad_lazy_glVertexAttribL3dv(GLuint index, const GLdouble *v) { glad_lazy_resolve(1005); glad_glVertexAttribL3dv(index, v); }
+static void APIENTRY glad_lazy_glVertexAttribL4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) { glad_lazy_resolve(1006); glad_glVertexAttribL4d(index, x, y, z, w); }
+static void APIENTRY glad_lazy_glVertexAttribL4dv(GLuint index, const GLdouble *v) { glad_lazy_resolve(1007); glad_glVertexAttribL4dv(index, v); }
+static void APIENTRY glad_lazy_glVertexAttribLFormat(GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) { glad_lazy_resolve(1008); glad_glVertexAttribLFormat(attribindex, size, type, relativeoffset); }
+static void APIENTRY glad_lazy_glVertexAttribLPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer) { glad_lazy_resolve(1009); glad_glVertexAttribLPointer(index, size, type, stride, pointer); }
+static void APIENTRY glad_lazy_glVertexAttribP1ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) { glad_lazy_resolve(1010); glad_glVertexAttribP1ui(index, type, normalized, value); }
+static void APIENTRY glad_lazy_glVertexAttribP1uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) { glad_lazy_resolve(1011); glad_glVertexAttribP1uiv(index, type, normalized, value); }
+static void APIENTRY glad_lazy_glVertexAttribP2ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) { glad_lazy_resolve(1012); glad_glVertexAttribP2ui(index, type, normalized, value); }
+static void APIENTRY glad_lazy_glVertexAttribP2uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) { glad_lazy_resolve(1013); glad_glVertexAttribP2uiv(index, type, normalized, value); }
+static void APIENTRY glad_lazy_glVertexAttribP3ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) { glad_lazy_resolve(1014); glad_glVertexAttribP3ui(index, type, normalized, value); }
+static void APIENTRY glad_lazy_glVertexAttribP3uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) { glad_lazy_resolve(1015); glad_glVertexAttribP3uiv(index, type, normalized, value); }
+static void APIENTRY glad_lazy_glVertexAttribP4ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) { glad_lazy_resolve(1016); glad_glVertexAttribP4ui(index, type, normalized, value); }
+static void APIENTRY glad_lazy_glVertexAttribP4uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) { glad_lazy_resolve(1017); glad_glVertexAttribP4uiv(index, type, normalized, value); }
+static void APIENTRY glad_lazy_glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer) { glad_lazy_resolve(1018); glad_glVertexAttribPointer(index, size, type, normalized, stride, pointer); }
+static void APIENTRY glad_lazy_glVertexBindingDivisor(GLuint bindingindex, GLuint divisor) { glad_lazy_resolve(1019); glad_glVertexBindingDivisor(bindingindex, divisor); }
+static void APIENTRY glad_lazy_glVertexP2ui(GLenum type, GLuint value) { glad_lazy_resolve(1020); glad_glVertexP2ui(type, value); }
+static void APIENTRY glad_lazy_glVertexP2uiv(GLenum type, const GLuint *value) { glad_lazy_resolve(1021); glad_glVertexP2uiv(type, value); }
+static void APIENTRY glad_lazy_glVertexP3ui(GLenum type, GLuint value) { glad_lazy_resolve(1022); glad_glVertexP3ui(type, value); }
+static void APIENTRY glad_lazy_glVertexP3uiv(GLenum type, const GLuint *value) { glad_lazy_resolve(1023); glad_glVertexP3uiv(type, value); }
+static void APIENTRY glad_lazy_glVertexP4ui(GLenum type, GLuint value) { glad_lazy_resolve(1024); glad_glVertexP4ui(type, value); }
+static void APIENTRY glad_lazy_glVertexP4uiv(GLenum type, const GLuint *value) { glad_lazy_resolve(1025); glad_glVertexP4uiv(type, value); }
+static void APIENTRY glad_lazy_glVertexPointer(GLint size, GLenum type, GLsizei stride, const void *pointer) { glad_lazy_resolve(1026); glad_glVertexPointer(size, type, stride, pointer); }
+static void APIENTRY glad_lazy_glViewport(GLint x, GLint y, GLsizei width, GLsizei height) { glad_lazy_resolve(1027); glad_glViewport(x, y, width, height); }
+static void APIENTRY glad_lazy_glViewportArrayv(GLuint first, GLsizei count, const GLfloat *v) { glad_lazy_resolve(1028); glad_glViewportArrayv(first, count, v); }
+static void APIENTRY glad_lazy_glViewportIndexedf(GLuint index, GLfloat x, GLfloat y, GLfloat w, GLfloat h) { glad_lazy_resolve(1029); glad_glViewportIndexedf(index, x, y, w, h); }
+static void APIENTRY glad_lazy_glViewportIndexedfv(GLuint index, const GLfloat *v) { glad_lazy_resolve(1030); glad_glViewportIndexedfv(index, v); }
+static void APIENTRY glad_lazy_glWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) { glad_lazy_resolve(1031); glad_glWaitSync(sync, flags, timeout); }
+static void APIENTRY glad_lazy_glWindowPos2d(GLdouble x, GLdouble y) { glad_lazy_resolve(1032); glad_glWindowPos2d(x, y); }
+static void APIENTRY glad_lazy_glWindowPos2dv(const GLdouble *v) { glad_lazy_resolve(1033); glad_glWindowPos2dv(v); }
+static void APIENTRY glad_lazy_glWindowPos2f(GLfloat x, GLfloat y) { glad_lazy_resolve(1034); glad_glWindowPos2f(x, y); }
+static void APIENTRY glad_lazy_glWindowPos2fv(const GLfloat *v) { glad_lazy_resolve(1035); glad_glWindowPos2fv(v); }
+static void APIENTRY glad_lazy_glWindowPos2i(GLint x, GLint y) { glad_lazy_resolve(1036); glad_glWindowPos2i(x, y); }
+static void APIENTRY glad_lazy_glWindowPos2iv(const GLint *v) { glad_lazy_resolve(1037); glad_glWindowPos2iv(v); }
+static void APIENTRY glad_lazy_glWindowPos2s(GLshort x, GLshort y) { glad_lazy_resolve(1038); glad_glWindowPos2s(x, y); }
+static void APIENTRY glad_lazy_glWindowPos2sv(const GLshort *v) { glad_lazy_resolve(1039); glad_glWindowPos2sv(v); }
+static void APIENTRY glad_lazy_glWindowPos3d(GLdouble x, GLdouble y, GLdouble z) { glad_lazy_resolve(1040); glad_glWindowPos3d(x, y, z); }
+static void APIENTRY glad_lazy_glWindowPos3dv(const GLdouble *v) { glad_lazy_resolve(1041); glad_glWindowPos3dv(v); }
+static void APIENTRY glad_lazy_glWindowPos3f(GLfloat x, GLfloat y, GLfloat z) { glad_lazy_resolve(1042); glad_glWindowPos3f(x, y, z); }
+static void APIENTRY glad_lazy_glWindowPos3fv(const GLfloat *v) { glad_lazy_resolve(1043); glad_glWindowPos3fv(v); }
+static void APIENTRY glad_lazy_glWindowPos3i(GLint x, GLint y, GLint z) { glad_lazy_resolve(1044); glad_glWindowPos3i(x, y, z); }
+static void APIENTRY glad_lazy_glWindowPos3iv(const GLint *v) { glad_lazy_resolve(1045); glad_glWindowPos3iv(v); }
+static void APIENTRY glad_lazy_glWindowPos3s(GLshort x, GLshort y, GLshort z) { glad_lazy_resolve(1046); glad_glWindowPos3s(x, y, z); }
+static void APIENTRY glad_lazy_glWindowPos3sv(const GLshort *v) { glad_lazy_resolve(1047); glad_glWindowPos3sv(v); }
+
+static struct glad_lazy_entry glad_lazy_entries[GLAD_LAZY_COUNT] = {
+    { "glAccum", (void **)&glad_glAccum, (void *)glad_lazy_glAccum, 0 },
+    { "glActiveShaderProgram", (void **)&glad_glActiveShaderProgram, (void *)glad_lazy_glActiveShaderProgram, 0 },
+    { "glActiveTexture", (void **)&glad_glActiveTexture, (void *)glad_lazy_glActiveTexture, 0 },
+    { "glAlphaFunc", (void **)&glad_glAlphaFunc, (void *)glad_lazy_glAlphaFunc, 0 },
+    { "glAreTexturesResident", (void **)&glad_glAreTexturesResident, (void *)glad_lazy_glAreTexturesResident, 0 },
+    { "glArrayElement", (void **)&glad_glArrayElement, (void *)glad_lazy_glArrayElement, 0 },
+    { "glAttachShader", (void **)&glad_glAttachShader, (void *)glad_lazy_glAttachShader, 0 },
+    { "glBegin", (void **)&glad_glBegin, (void *)glad_lazy_glBegin, 0 },
+    { "glBeginConditionalRender", (void **)&glad_glBeginConditionalRender, (void *)glad_lazy_glBeginConditionalRender, 0 },
+    { "glBeginQuery", (void **)&glad_glBeginQuery, (void *)glad_lazy_glBeginQuery, 0 },
+    { "glBeginQueryIndexed", (void **)&glad_glBeginQueryIndexed, (void *)glad_lazy_glBeginQueryIndexed, 0 },
+    { "glBeginTransformFeedback", (void **)&glad_glBeginTransformFeedback, (void *)glad_lazy_glBeginTransformFeedback, 0 },
+    { "glBindAttribLocation", (void **)&glad_glBindAttribLocation, (void *)glad_lazy_glBindAttribLocation, 0 },
+    { "glBindBuffer", (void **)&glad_glBindBuffer, (void *)glad_lazy_glBindBuffer, 0 },
+    { "glBindBufferBase", (void **)&glad_glBindBufferBase, (void *)glad_lazy_glBindBufferBase, 0 },
+    { "glBindBufferRange", (void **)&glad_glBindBufferRange, (void *)glad_lazy_glBindBufferRange, 0 },
+    { "glBindBuffersBase", (void **)&glad_glBindBuffersBase, (void *)glad_lazy_glBindBuffersBase, 0 },
+    { "glBindBuffersRange", (void **)&glad_glBindBuffersRange, (void *)glad_lazy_glBindBuffersRange, 0 },
+    { "glBindFragDataLocation", (void **)&glad_glBindFragDataLocation, (void *)glad_lazy_glBindFragDataLocation, 0 },
+    { "glBindFragDataLocationIndexed", (void **)&glad_glBindFragDataLocationIndexed, (void *)glad_lazy_glBindFragDataLocationIndexed, 0 },
+    { "glBindFramebuffer", (void **)&glad_glBindFramebuffer, (void *)glad_lazy_glBindFramebuffer, 0 },
+    { "glBindImageTexture", (void **)&glad_glBindImageTexture, (void *)glad_lazy_glBindImageTexture, 0 },
+    { "glBindImageTextures", (void **)&glad_glBindImageTextures, (void *)glad_lazy_glBindImageTextures, 0 },
+    { "glBindProgramPipeline", (void **)&glad_glBindProgramPipeline, (void *)glad_lazy_glBindProgramPipeline, 0 },
+    { "glBindRenderbuffer", (void **)&glad_glBindRenderbuffer, (void *)glad_lazy_glBindRenderbuffer, 0 },
+    { "glBindSampler", (void **)&glad_glBindSampler, (void *)glad_lazy_glBindSampler, 0 },
+    { "glBindSamplers", (void **)&glad_glBindSamplers, (void *)glad_lazy_glBindSamplers, 0 },
+    { "glBindTexture", (void **)&glad_glBindTexture, (void *)glad_lazy_glBindTexture, 0 },
+    { "glBindTextureUnit", (void **)&glad_glBindTextureUnit, (void *)glad_lazy_glBindTextureUnit, 0 },
+    { "glBindTextures", (void **)&glad_glBindTextures, (void *)glad_lazy_glBindTextures, 0 },
+    { "glBindTransformFeedback", (void **)&glad_glBindTransformFeedback, (void *)glad_lazy_glBindTransformFeedback, 0 },
+    { "glBindVertexArray", (void **)&glad_glBindVertexArray, (void *)glad_lazy_glBindVertexArray, 0 },
+    { "glBindVertexBuffer", (void **)&glad_glBindVertexBuffer, (void *)glad_lazy_glBindVertexBuffer, 0 },
+    { "glBindVertexBuffers", (void **)&glad_glBindVertexBuffers, (void *)glad_lazy_glBindVertexBuffers, 0 },
+    { "glBitmap", (void **)&glad_glBitmap, (void *)glad_lazy_glBitmap, 0 },
+    { "glBlendColor", (void **)&glad_glBlendColor, (void *)glad_lazy_glBlendColor, 0 },
+    { "glBlendEquation", (void **)&glad_glBlendEquation, (void *)glad_lazy_glBlendEquation, 0 },
+    { "glBlendEquationSeparate", (void **)&glad_glBlendEquationSeparate, (void *)glad_lazy_glBlendEquationSeparate, 0 },
+    { "glBlendEquationSeparatei", (void **)&glad_glBlendEquationSeparatei, (void *)glad_lazy_glBlendEquationSeparatei, 0 },
+    { "glBlendEquationi", (void **)&glad_glBlendEquationi, (void *)glad_lazy_glBlendEquationi, 0 },
+    { "glBlendFunc", (void **)&glad_glBlendFunc, (void *)glad_lazy_glBlendFunc, 0 },
+    { "glBlendFuncSeparate", (void **)&glad_glBlendFuncSeparate, (void *)glad_lazy_glBlendFuncSeparate, 0 },
+    { "glBlendFuncSeparatei", (void **)&glad_glBlendFuncSeparatei, (void *)glad_lazy_glBlendFuncSeparatei, 0 },
+    { "glBlendFunci", (void **)&glad_glBlendFunci, (void *)glad_lazy_glBlendFunci, 0 },
+    { "glBlitFramebuffer", (void **)&glad_glBlitFramebuffer, (void *)glad_lazy_glBlitFramebuffer, 0 },
+    { "glBlitNamedFramebuffer", (void **)&glad_glBlitNamedFramebuffer, (void *)glad_lazy_glBlitNamedFramebuffer, 0 },
+    { "glBufferData", (void **)&glad_glBufferData, (void *)glad_lazy_glBufferData, 0 },
+    { "glBufferStorage", (void **)&glad_glBufferStorage, (void *)glad_lazy_glBufferStorage, 0 },
+    { "glBufferSubData", (void **)&glad_glBufferSubData, (void *)glad_lazy_glBufferSubData, 0 },
+    { "glCallList", (void **)&glad_glCallList, (void *)glad_lazy_glCallList, 0 },
+    { "glCallLists", (void **)&glad_glCallLists, (void *)glad_lazy_glCallLists, 0 },
+    { "glCheckFramebufferStatus", (void **)&glad_glCheckFramebufferStatus, (void *)glad_lazy_glCheckFramebufferStatus, 0 },
+    { "glCheckNamedFramebufferStatus", (void **)&glad_glCheckNamedFramebufferStatus, (void *)glad_lazy_glCheckNamedFramebufferStatus, 0 },
+    { "glClampColor", (void **)&glad_glClampColor, (void *)glad_lazy_glClampColor, 0 },
+    { "glClear", (void **)&glad_glClear, (void *)glad_lazy_glClear, 0 },
+    { "glClearAccum", (void **)&glad_glClearAccum, (void *)glad_lazy_glClearAccum, 0 },
+    { "glClearBufferData", (void **)&glad_glClearBufferData, (void *)glad_lazy_glClearBufferData, 0 },
+    { "glClearBufferSubData", (void **)&glad_glClearBufferSubData, (void *)glad_lazy_glClearBufferSubData, 0 },
+    { "glClearBufferfi", (void **)&glad_glClearBufferfi, (void *)glad_lazy_glClearBufferfi, 0 },
+    { "glClearBufferfv", (void **)&glad_glClearBufferfv, (void *)glad_lazy_glClearBufferfv, 0 },
+    { "glClearBufferiv", (void **)&glad_glClearBufferiv, (void *)glad_lazy_glClearBufferiv, 0 },
+    { "glClearBufferuiv", (void **)&glad_glClearBufferuiv, (void *)glad_lazy_glClearBufferuiv, 0 },
+    { "glClearColor", (void **)&glad_glClearColor, (void *)glad_lazy_glClearColor, 0 },
+    { "glClearDepth", (void **)&glad_glClearDepth, (void *)glad_lazy_glClearDepth, 0 },
+    { "glClearDepthf", (void **)&glad_glClearDepthf, (void *)glad_lazy_glClearDepthf, 0 },
+    { "glClearIndex", (void **)&glad_glClearIndex, (void *)glad_lazy_glClearIndex, 0 },
+    { "glClearNamedBufferData", (void **)&glad_glClearNamedBufferData, (void *)glad_lazy_glClearNamedBufferData, 0 },
+    { "glClearNamedBufferSubData", (void **)&glad_glClearNamedBufferSubData, (void *)glad_lazy_glClearNamedBufferSubData, 0 },
+    { "glClearNamedFramebufferfi", (void **)&glad_glClearNamedFramebufferfi, (void *)glad_lazy_glClearNamedFramebufferfi, 0 },
+    { "glClearNamedFramebufferfv", (void **)&glad_glClearNamedFramebufferfv, (void *)glad_lazy_glClearNamedFramebufferfv, 0 },
+    { "glClearNamedFramebufferiv", (void **)&glad_glClearNamedFramebufferiv, (void *)glad_lazy_glClearNamedFramebufferiv, 0 },
+    { "glClearNamedFramebufferuiv", (void **)&glad_glClearNamedFramebufferuiv, (void *)glad_lazy_glClearNamedFramebufferuiv, 0 },
+    { "glClearStencil", (void **)&glad_glClearStencil, (void *)glad_lazy_glClearStencil, 0 },
+    { "glClearTexImage", (void **)&glad_glClearTexImage, (void *)glad_lazy_glClearTexImage, 0 },
+    { "glClearTexSubImage", (void **)&glad_glClearTexSubImage, (void *)glad_lazy_glClearTexSubImage, 0 },
+    { "glClientActiveTexture", (void **)&glad_glClientActiveTexture, (void *)glad_lazy_glClientActiveTexture, 0 },
+    { "glClientWaitSync", (void **)&glad_glClientWaitSync, (void *)glad_lazy_glClientWaitSync, 0 },
+    { "glClipControl", (void **)&glad_glClipControl, (void *)glad_lazy_glClipControl, 0 },
+    { "glClipPlane", (void **)&glad_glClipPlane, (void *)glad_lazy_glClipPlane, 0 },
+    { "glColor3b", (void **)&glad_glColor3b, (void *)glad_lazy_glColor3b, 0 },
+    { "glColor3bv", (void **)&glad_glColor3bv, (void *)glad_lazy_glColor3bv, 0 },
+    { "glColor3d", (void **)&glad_glColor3d, (void *)glad_lazy_glColor3d, 0 },
+    { "glColor3dv", (void **)&glad_glColor3dv, (void *)glad_lazy_glColor3dv, 0 },
+    { "glColor3f", (void **)&glad_glColor3f, (void *)glad_lazy_glColor3f, 0 },
+    { "glColor3fv", (void **)&glad_glColor3fv, (void *)glad_lazy_glColor3fv, 0 },
+    { "glColor3i", (void **)&glad_glColor3i, (void *)glad_lazy_glColor3i, 0 },
+    { "glColor3iv", (void **)&glad_glColor3iv, (void *)glad_lazy_glColor3iv, 0 },
+    { "glColor3s", (void **)&glad_glColor3s, (void *)glad_lazy_glColor3s, 0 },
+    { "glColor3sv", (void **)&glad_glColor3sv, (void *)glad_lazy_glColor3sv, 0 },
+    { "glColor3ub", (void **)&glad_glColor3ub, (void *)glad_lazy_glColor3ub, 0 },
+    { "glColor3ubv", (void **)&glad_glColor3ubv, (void *)glad_lazy_glColor3ubv, 0 },
+    { "glColor3ui", (void **)&glad_glColor3ui, (void *)glad_lazy_glColor3ui, 0 },
+    { "glColor3uiv", (void **)&glad_glColor3uiv, (void *)glad_lazy_glColor3uiv, 0 },
+    { "glColor3us", (void **)&glad_glColor3us, (void *)glad_lazy_glColor3us, 0 },
+    { "glColor3usv", (void **)&glad_glColor3usv, (void *)glad_lazy_glColor3usv, 0 },
+    { "glColor4b", (void **)&glad_glColor4b, (void *)glad_lazy_glColor4b, 0 },
+    { "glColor4bv", (void **)&glad_glColor4bv, (void *)glad_lazy_glColor4bv, 0 },
+    { "glColor4d", (void **)&glad_glColor4d, (void *)glad_lazy_glColor4d, 0 },
+    { "glColor4dv", (void **)&glad_glColor4dv, (void *)glad_lazy_glColor4dv, 0 },
+    { "glColor4f", (void **)&glad_glColor4f, (void *)glad_lazy_glColor4f, 0 },
+    { "glColor4fv", (void **)&glad_glColor4fv, (void *)glad_lazy_glColor4fv, 0 },
+    { "glColor4i", (void **)&glad_glColor4i, (void *)glad_lazy_glColor4i, 0 },
+    { "glColor4iv", (void **)&glad_glColor4iv, (void *)glad_lazy_glColor4iv, 0 },
+    { "glColor4s", (void **)&glad_glColor4s, (void *)glad_lazy_glColor4s, 0 },
+    { "glColor4sv", (void **)&glad_glColor4sv, (void *)glad_lazy_glColor4sv, 0 },
+    { "glColor4ub", (void **)&glad_glColor4ub, (void *)glad_lazy_glColor4ub, 0 },
+    { "glColor4ubv", (void **)&glad_glColor4ubv, (void *)glad_lazy_glColor4ubv, 0 },
+    { "glColor4ui", (void **)&glad_glColor4ui, (void *)glad_lazy_glColor4ui, 0 },
+    { "glColor4uiv", (void **)&glad_glColor4uiv, (void *)glad_lazy_glColor4uiv, 0 },
+    { "glColor4us", (void **)&glad_glColor4us, (void *)glad_lazy_glColor4us, 0 },
+    { "glColor4usv", (void **)&glad_glColor4usv, (void *)glad_lazy_glColor4usv, 0 },
+    { "glColorMask", (void **)&glad_glColorMask, (void *)glad_lazy_glColorMask, 0 },
+    { "glColorMaski", (void **)&glad_glColorMaski, (void *)glad_lazy_glColorMaski, 0 },
+    { "glColorMaterial", (void **)&glad_glColorMaterial, (void *)glad_lazy_glColorMaterial, 0 },
+    { "glColorP3ui", (void **)&glad_glColorP3ui, (void *)glad_lazy_glColorP3ui, 0 },
+    { "glColorP3uiv", (void **)&glad_glColorP3uiv, (void *)glad_lazy_glColorP3uiv, 0 },
+    { "glColorP4ui", (void **)&glad_glColorP4ui, (void *)glad_lazy_glColorP4ui, 0 },
+    { "glColorP4uiv", (void **)&glad_glColorP4uiv, (void *)glad_lazy_glColorP4uiv, 0 },
+    { "glColorPointer", (void **)&glad_glColorPointer, (void *)glad_lazy_glColorPointer, 0 },
+    { "glCompileShader", (void **)&glad_glCompileShader, (void *)glad_lazy_glCompileShader, 0 },
+    { "glCompressedTexImage1D", (void **)&glad_glCompressedTexImage1D, (void *)glad_lazy_glCompressedTexImage1D, 0 },
+    { "glCompressedTexImage2D", (void **)&glad_glCompressedTexImage2D, (void *)glad_lazy_glCompressedTexImage2D, 0 },
+    { "glCompressedTexImage3D", (void **)&glad_glCompressedTexImage3D, (void *)glad_lazy_glCompressedTexImage3D, 0 },
+    { "glCompressedTexSubImage1D", (void **)&glad_glCompressedTexSubImage1D, (void *)glad_lazy_glCompressedTexSubImage1D, 0 },
+    { "glCompressedTexSubImage2D", (void **)&glad_glCompressedTexSubImage2D, (void *)glad_lazy_glCompressedTexSubImage2D, 0 },
+    { "glCompressedTexSubImage3D", (void **)&glad_glCompressedTexSubImage3D, (void *)glad_lazy_glCompressedTexSubImage3D, 0 },
+    { "glCompressedTextureSubImage1D", (void **)&glad_glCompressedTextureSubImage1D, (void *)glad_lazy_glCompressedTextureSubImage1D, 0 },
+    { "glCompressedTextureSubImage2D", (void **)&glad_glCompressedTextureSubImage2D, (void *)glad_lazy_glCompressedTextureSubImage2D, 0 },
+    { "glCompressedTextureSubImage3D", (void **)&glad_glCompressedTextureSubImage3D, (void *)glad_lazy_glCompressedTextureSubImage3D, 0 },
+    { "glCopyBufferSubData", (void **)&glad_glCopyBufferSubData, (void *)glad_lazy_glCopyBufferSubData, 0 },
+    { "glCopyImageSubData", (void **)&glad_glCopyImageSubData, (void *)glad_lazy_glCopyImageSubData, 0 },
+    { "glCopyNamedBufferSubData", (void **)&glad_glCopyNamedBufferSubData, (void *)glad_lazy_glCopyNamedBufferSubData, 0 },
+    { "glCopyPixels", (void **)&glad_glCopyPixels, (void *)glad_lazy_glCopyPixels, 0 },
+    { "glCopyTexImage1D", (void **)&glad_glCopyTexImage1D, (void *)glad_lazy_glCopyTexImage1D, 0 },
+    { "glCopyTexImage2D", (void **)&glad_glCopyTexImage2D, (void *)glad_lazy_glCopyTexImage2D, 0 },
+    { "glCopyTexSubImage1D", (void **)&glad_glCopyTexSubImage1D, (void *)glad_lazy_glCopyTexSubImage1D, 0 },
+    { "glCopyTexSubImage2D", (void **)&glad_glCopyTexSubImage2D, (void *)glad_lazy_glCopyTexSubImage2D, 0 },
+    { "glCopyTexSubImage3D", (void **)&glad_glCopyTexSubImage3D, (void *)glad_lazy_glCopyTexSubImage3D, 0 },
+    { "glCopyTextureSubImage1D", (void **)&glad_glCopyTextureSubImage1D, (void *)glad_lazy_glCopyTextureSubImage1D, 0 },
+    { "glCopyTextureSubImage2D", (void **)&glad_glCopyTextureSubImage2D, (void *)glad_lazy_glCopyTextureSubImage2D, 0 },
+    { "glCopyTextureSubImage3D", (void **)&glad_glCopyTextureSubImage3D, (void *)glad_lazy_glCopyTextureSubImage3D, 0 },
+    { "glCreateBuffers", (void **)&glad_glCreateBuffers, (void *)glad_lazy_glCreateBuffers, 0 },
+    { "glCreateFramebuffers", (void **)&glad_glCreateFramebuffers, (void *)glad_lazy_glCreateFramebuffers, 0 },
+    { "glCreateProgram", (void **)&glad_glCreateProgram, (void *)glad_lazy_glCreateProgram, 0 },
+    { "glCreateProgramPipelines", (void **)&glad_glCreateProgramPipelines, (void *)glad_lazy_glCreateProgramPipelines, 0 },
+    { "glCreateQueries", (void **)&glad_glCreateQueries, (void *)glad_lazy_glCreateQueries, 0 },
+    { "glCreateRenderbuffers", (void **)&glad_glCreateRenderbuffers, (void *)glad_lazy_glCreateRenderbuffers, 0 },
+    { "glCreateSamplers", (void **)&glad_glCreateSamplers, (void *)glad_lazy_glCreateSamplers, 0 },
+    { "glCreateShader", (void **)&glad_glCreateShader, (void *)glad_lazy_glCreateShader, 0 },
+    { "glCreateShaderProgramv", (void **)&glad_glCreateShaderProgramv, (void *)glad_lazy_glCreateShaderProgramv, 0 },
+    { "glCreateTextures", (void **)&glad_glCreateTextures, (void *)glad_lazy_glCreateTextures, 0 },
+    { "glCreateTransformFeedbacks", (void **)&glad_glCreateTransformFeedbacks, (void *)glad_lazy_glCreateTransformFeedbacks, 0 },
+    { "glCreateVertexArrays", (void **)&glad_glCreateVertexArrays, (void *)glad_lazy_glCreateVertexArrays, 0 },
+    { "glCullFace", (void **)&glad_glCullFace, (void *)glad_lazy_glCullFace, 0 },
+    { "glDebugMessageCallback", (void **)&glad_glDebugMessageCallback, (void *)glad_lazy_glDebugMessageCallback, 0 },
+    { "glDebugMessageControl", (void **)&glad_glDebugMessageControl, (void *)glad_lazy_glDebugMessageControl, 0 },
+    { "glDebugMessageInsert", (void **)&glad_glDebugMessageInsert, (void *)glad_lazy_glDebugMessageInsert, 0 },
+    { "glDeleteBuffers", (void **)&glad_glDeleteBuffers, (void *)glad_lazy_glDeleteBuffers, 0 },
+    { "glDeleteFramebuffers", (void **)&glad_glDeleteFramebuffers, (void *)glad_lazy_glDeleteFramebuffers, 0 },
+    { "glDeleteLists", (void **)&glad_glDeleteLists, (void *)glad_lazy_glDeleteLists, 0 },
+    { "glDeleteProgram", (void **)&glad_glDeleteProgram, (void *)glad_lazy_glDeleteProgram, 0 },
+    { "glDeleteProgramPipelines", (void **)&glad_glDeleteProgramPipelines, (void *)glad_lazy_glDeleteProgramPipelines, 0 },
+    { "glDeleteQueries", (void **)&glad_glDeleteQueries, (void *)glad_lazy_glDeleteQueries, 0 },
+    { "glDeleteRenderbuffers", (void **)&glad_glDeleteRenderbuffers, (void *)glad_lazy_glDeleteRenderbuffers, 0 },
+    { "glDeleteSamplers", (void **)&glad_glDeleteSamplers, (void *)glad_lazy_glDeleteSamplers, 0 },
+    { "glDeleteShader", (void **)&glad_glDeleteShader, (void *)glad_lazy_glDeleteShader, 0 },
+    { "glDeleteSync", (void **)&glad_glDeleteSync, (void *)glad_lazy_glDeleteSync, 0 },
+    { "glDeleteTextures", (void **)&glad_glDeleteTextures, (void *)glad_lazy_glDeleteTextures, 0 },
+    { "glDeleteTransformFeedbacks", (void **)&glad_glDeleteTransformFeedbacks, (void *)glad_lazy_glDeleteTransformFeedbacks, 0 },
+    { "glDeleteVertexArrays", (void **)&glad_glDeleteVertexArrays, (void *)glad_lazy_glDeleteVertexArrays, 0 },
+    { "glDepthFunc", (void **)&glad_glDepthFunc, (void *)glad_lazy_glDepthFunc, 0 },
+    { "glDepthMask", (void **)&glad_glDepthMask, (void *)glad_lazy_glDepthMask, 0 },
+    { "glDepthRange", (void **)&glad_glDepthRange, (void *)glad_lazy_glDepthRange, 0 },
+    { "glDepthRangeArrayv", (void **)&glad_glDepthRangeArrayv, (void *)glad_lazy_glDepthRangeArrayv, 0 },
+    { "glDepthRangeIndexed", (void **)&glad_glDepthRangeIndexed, (void *)glad_lazy_glDepthRangeIndexed, 0 },
+    { "glDepthRangef", (void **)&glad_glDepthRangef, (void *)glad_lazy_glDepthRangef, 0 },
+    { "glDetachShader", (void **)&glad_glDetachShader, (void *)glad_lazy_glDetachShader, 0 },
+    { "glDisable", (void **)&glad_glDisable, (void *)glad_lazy_glDisable, 0 },
+    { "glDisableClientState", (void **)&glad_glDisableClientState, (void *)glad_lazy_glDisableClientState, 0 },
+    { "glDisableVertexArrayAttrib", (void **)&glad_glDisableVertexArrayAttrib, (void *)glad_lazy_glDisableVertexArrayAttrib, 0 },
+    { "glDisableVertexAttribArray", (void **)&glad_glDisableVertexAttribArray, (void *)glad_lazy_glDisableVertexAttribArray, 0 },
+    { "glDisablei", (void **)&glad_glDisablei, (void *)glad_lazy_glDisablei, 0 },
+    { "glDispatchCompute", (void **)&glad_glDispatchCompute, (void *)glad_lazy_glDispatchCompute, 0 },
+    { "glDispatchComputeIndirect", (void **)&glad_glDispatchComputeIndirect, (void *)glad_lazy_glDispatchComputeIndirect, 0 },
+    { "glDrawArrays", (void **)&glad_glDrawArrays, (void *)glad_lazy_glDrawArrays, 0 },
+    { "glDrawArraysIndirect", (void **)&glad_glDrawArraysIndirect, (void *)glad_lazy_glDrawArraysIndirect, 0 },
+    { "glDrawArraysInstanced", (void **)&glad_glDrawArraysInstanced, (void *)glad_lazy_glDrawArraysInstanced, 0 },
+    { "glDrawArraysInstancedBaseInstance", (void **)&glad_glDrawArraysInstancedBaseInstance, (void *)glad_lazy_glDrawArraysInstancedBaseInstance, 0 },
+    { "glDrawBuffer", (void **)&glad_glDrawBuffer, (void *)glad_lazy_glDrawBuffer, 0 },
+    { "glDrawBuffers", (void **)&glad_glDrawBuffers, (void *)glad_lazy_glDrawBuffers, 0 },
+    { "glDrawElements", (void **)&glad_glDrawElements, (void *)glad_lazy_glDrawElements, 0 },
+    { "glDrawElementsBaseVertex", (void **)&glad_glDrawElementsBaseVertex, (void *)glad_lazy_glDrawElementsBaseVertex, 0 },
+    { "glDrawElementsIndirect", (void **)&glad_glDrawElementsIndirect, (void *)glad_lazy_glDrawElementsIndirect, 0 },
+    { "glDrawElementsInstanced", (void **)&glad_glDrawElementsInstanced, (void *)glad_lazy_glDrawElementsInstanced, 0 },
+    { "glDrawElementsInstancedBaseInstance", (void **)&glad_glDrawElementsInstancedBaseInstance, (void *)glad_lazy_glDrawElementsInstancedBaseInstance, 0 },
+    { "glDrawElementsInstancedBaseVertex", (void **)&glad_glDrawElementsInstancedBaseVertex, (void *)glad_lazy_glDrawElementsInstancedBaseVertex, 0 },
+    { "glDrawElementsInstancedBaseVertexBaseInstance", (void **)&glad_glDrawElementsInstancedBaseVertexBaseInstance, (void *)glad_lazy_glDrawElementsInstancedBaseVertexBaseInstance, 0 },
+    { "glDrawPixels", (void **)&glad_glDrawPixels, (void *)glad_lazy_glDrawPixels, 0 },
+    { "glDrawRangeElements", (void **)&glad_glDrawRangeElements, (void *)glad_lazy_glDrawRangeElements, 0 },
+    { "glDrawRangeElementsBaseVertex", (void **)&glad_glDrawRangeElementsBaseVertex, (void *)glad_lazy_glDrawRangeElementsBaseVertex, 0 },
+    { "glDrawTransformFeedback", (void **)&glad_glDrawTransformFeedback, (void *)glad_lazy_glDrawTransformFeedback, 0 },
+    { "glDrawTransformFeedbackInstanced", (void **)&glad_glDrawTransformFeedbackInstanced, (void *)glad_lazy_glDrawTransformFeedbackInstanced, 0 },
+    { "glDrawTransformFeedbackStream", (void **)&glad_glDrawTransformFeedbackStream, (void *)glad_lazy_glDrawTransformFeedbackStream, 0 },
+    { "glDrawTransformFeedbackStreamInstanced", (void **)&glad_glDrawTransformFeedbackStreamInstanced, (void *)glad_lazy_glDrawTransformFeedbackStreamInstanced, 0 },
+    { "glEdgeFlag", (void **)&glad_glEdgeFlag, (void *)glad_lazy_glEdgeFlag, 0 },
+    { "glEdgeFlagPointer", (void **)&glad_glEdgeFlagPointer, (void *)glad_lazy_glEdgeFlagPointer, 0 },
+    { "glEdgeFlagv", (void **)&glad_glEdgeFlagv, (void *)glad_lazy_glEdgeFlagv, 0 },
+    { "glEnable", (void **)&glad_glEnable, (void *)glad_lazy_glEnable, 0 },
+    { "glEnableClientState", (void **)&glad_glEnableClientState, (void *)glad_lazy_glEnableClientState, 0 },
+    { "glEnableVertexArrayAttrib", (void **)&glad_glEnableVertexArrayAttrib, (void *)glad_lazy_glEnableVertexArrayAttrib, 0 },
+    { "glEnableVertexAttribArray", (void **)&glad_glEnableVertexAttribArray, (void *)glad_lazy_glEnableVertexAttribArray, 0 },
+    { "glEnablei", (void **)&glad_glEnablei, (void *)glad_lazy_glEnablei, 0 },
+    { "glEnd", (void **)&glad_glEnd, (void *)glad_lazy_glEnd, 0 },
+    { "glEndConditionalRender", (void **)&glad_glEndConditionalRender, (void *)glad_lazy_glEndConditionalRender, 0 },
+    { "glEndList", (void **)&glad_glEndList, (void *)glad_lazy_glEndList, 0 },
+    { "glEndQuery", (void **)&glad_glEndQuery, (void *)glad_lazy_glEndQuery, 0 },
+    { "glEndQueryIndexed", (void **)&glad_glEndQueryIndexed, (void *)glad_lazy_glEndQueryIndexed, 0 },
+    { "glEndTransformFeedback", (void **)&glad_glEndTransformFeedback, (void *)glad_lazy_glEndTransformFeedback, 0 },
+    { "glEvalCoord1d", (void **)&glad_glEvalCoord1d, (void *)glad_lazy_glEvalCoord1d, 0 },
+    { "glEvalCoord1dv", (void **)&glad_glEvalCoord1dv, (void *)glad_lazy_glEvalCoord1dv, 0 },
+    { "glEvalCoord1f", (void **)&glad_glEvalCoord1f, (void *)glad_lazy_glEvalCoord1f, 0 },
+    { "glEvalCoord1fv", (void **)&glad_glEvalCoord1fv, (void *)glad_lazy_glEvalCoord1fv, 0 },
+    { "glEvalCoord2d", (void **)&glad_glEvalCoord2d, (void *)glad_lazy_glEvalCoord2d, 0 },
+    { "glEvalCoord2dv", (void **)&glad_glEvalCoord2dv, (void *)glad_lazy_glEvalCoord2dv, 0 },
+    { "glEvalCoord2f", (void **)&glad_glEvalCoord2f, (void *)glad_lazy_glEvalCoord2f, 0 },
+    { "glEvalCoord2fv", (void **)&glad_glEvalCoord2fv, (void *)glad_lazy_glEvalCoord2fv, 0 },
+    { "glEvalMesh1", (void **)&glad_glEvalMesh1, (void *)glad_lazy_glEvalMesh1, 0 },
+    { "glEvalMesh2", (void **)&glad_glEvalMesh2, (void *)glad_lazy_glEvalMesh2, 0 },
+    { "glEvalPoint1", (void **)&glad_glEvalPoint1, (void *)glad_lazy_glEvalPoint1, 0 },
+    { "glEvalPoint2", (void **)&glad_glEvalPoint2, (void *)glad_lazy_glEvalPoint2, 0 },
+    { "glFeedbackBuffer", (void **)&glad_glFeedbackBuffer, (void *)glad_lazy_glFeedbackBuffer, 0 },
+    { "glFenceSync", (void **)&glad_glFenceSync, (void *)glad_lazy_glFenceSync, 0 },
+    { "glFinish", (void **)&glad_glFinish, (void *)glad_lazy_glFinish, 0 },
+    { "glFlush", (void **)&glad_glFlush, (void *)glad_lazy_glFlush, 0 },
+    { "glFlushMappedBufferRange", (void **)&glad_glFlushMappedBufferRange, (void *)glad_lazy_glFlushMappedBufferRange, 0 },
+    { "glFlushMappedNamedBufferRange", (void **)&glad_glFlushMappedNamedBufferRange, (void *)glad_lazy_glFlushMappedNamedBufferRange, 0 },
+    { "glFogCoordPointer", (void **)&glad_glFogCoordPointer, (void *)glad_lazy_glFogCoordPointer, 0 },
+    { "glFogCoordd", (void **)&glad_glFogCoordd, (void *)glad_lazy_glFogCoordd, 0 },
+    { "glFogCoorddv", (void **)&glad_glFogCoorddv, (void *)glad_lazy_glFogCoorddv, 0 },
+    { "glFogCoordf", (void **)&glad_glFogCoordf, (void *)glad_lazy_glFogCoordf, 0 },
+    { "glFogCoordfv", (void **)&glad_glFogCoordfv, (void *)glad_lazy_glFogCoordfv, 0 },
+    { "glFogf", (void **)&glad_glFogf, (void *)glad_lazy_glFogf, 0 },
+    { "glFogfv", (void **)&glad_glFogfv, (void *)glad_lazy_glFogfv, 0 },
+    { "glFogi", (void **)&glad_glFogi, (void *)glad_lazy_glFogi, 0 },
+    { "glFogiv", (void **)&glad_glFogiv, (void *)glad_lazy_glFogiv, 0 },
+    { "glFramebufferParameteri", (void **)&glad_glFramebufferParameteri, (void *)glad_lazy_glFramebufferParameteri, 0 },
+    { "glFramebufferRenderbuffer", (void **)&glad_glFramebufferRenderbuffer, (void *)glad_lazy_glFramebufferRenderbuffer, 0 },
+    { "glFramebufferTexture", (void **)&glad_glFramebufferTexture, (void *)glad_lazy_glFramebufferTexture, 0 },
+    { "glFramebufferTexture1D", (void **)&glad_glFramebufferTexture1D, (void *)glad_lazy_glFramebufferTexture1D, 0 },
+    { "glFramebufferTexture2D", (void **)&glad_glFramebufferTexture2D, (void *)glad_lazy_glFramebufferTexture2D, 0 },
+    { "glFramebufferTexture3D", (void **)&glad_glFramebufferTexture3D, (void *)glad_lazy_glFramebufferTexture3D, 0 },
+    { "glFramebufferTextureLayer", (void **)&glad_glFramebufferTextureLayer, (void *)glad_lazy_glFramebufferTextureLayer, 0 },
+    { "glFrontFace", (void **)&glad_glFrontFace, (void *)glad_lazy_glFrontFace, 0 },
+    { "glFrustum", (void **)&glad_glFrustum, (void *)glad_lazy_glFrustum, 0 },
+    { "glGenBuffers", (void **)&glad_glGenBuffers, (void *)glad_lazy_glGenBuffers, 0 },
+    { "glGenFramebuffers", (void **)&glad_glGenFramebuffers, (void *)glad_lazy_glGenFramebuffers, 0 },
+    { "glGenLists", (void **)&glad_glGenLists, (void *)glad_lazy_glGenLists, 0 },
+    { "glGenProgramPipelines", (void **)&glad_glGenProgramPipelines, (void *)glad_lazy_glGenProgramPipelines, 0 },
+    { "glGenQueries", (void **)&glad_glGenQueries, (void *)glad_lazy_glGenQueries, 0 },
+    { "glGenRenderbuffers", (void **)&glad_glGenRenderbuffers, (void *)glad_lazy_glGenRenderbuffers, 0 },
+    { "glGenSamplers", (void **)&glad_glGenSamplers, (void *)glad_lazy_glGenSamplers, 0 },
+    { "glGenTextures", (void **)&glad_glGenTextures, (void *)glad_lazy_glGenTextures, 0 },
+    { "glGenTransformFeedbacks", (void **)&glad_glGenTransformFeedbacks, (void *)glad_lazy_glGenTransformFeedbacks, 0 },
+    { "glGenVertexArrays", (void **)&glad_glGenVertexArrays, (void *)glad_lazy_glGenVertexArrays, 0 },
+    { "glGenerateMipmap", (void **)&glad_glGenerateMipmap, (void *)glad_lazy_glGenerateMipmap, 0 },
+    { "glGenerateTextureMipmap", (void **)&glad_glGenerateTextureMipmap, (void *)glad_lazy_glGenerateTextureMipmap, 0 },
+    { "glGetActiveAtomicCounterBufferiv", (void **)&glad_glGetActiveAtomicCounterBufferiv, (void *)glad_lazy_glGetActiveAtomicCounterBufferiv, 0 },
+    { "glGetActiveAttrib", (void **)&glad_glGetActiveAttrib, (void *)glad_lazy_glGetActiveAttrib, 0 },
+    { "glGetActiveSubroutineName", (void **)&glad_glGetActiveSubroutineName, (void *)glad_lazy_glGetActiveSubroutineName, 0 },
+    { "glGetActiveSubroutineUniformName", (void **)&glad_glGetActiveSubroutineUniformName, (void *)glad_lazy_glGetActiveSubroutineUniformName, 0 },
+    { "glGetActiveSubroutineUniformiv", (void **)&glad_glGetActiveSubroutineUniformiv, (void *)glad_lazy_glGetActiveSubroutineUniformiv, 0 },
+    { "glGetActiveUniform", (void **)&glad_glGetActiveUniform, (void *)glad_lazy_glGetActiveUniform, 0 },
+    { "glGetActiveUniformBlockName", (void **)&glad_glGetActiveUniformBlockName, (void *)glad_lazy_glGetActiveUniformBlockName, 0 },
+    { "glGetActiveUniformBlockiv", (void **)&glad_glGetActiveUniformBlockiv, (void *)glad_lazy_glGetActiveUniformBlockiv, 0 },
+    { "glGetActiveUniformName", (void **)&glad_glGetActiveUniformName, (void *)glad_lazy_glGetActiveUniformName, 0 },
+    { "glGetActiveUniformsiv", (void **)&glad_glGetActiveUniformsiv, (void *)glad_lazy_glGetActiveUniformsiv, 0 },
+    { "glGetAttachedShaders", (void **)&glad_glGetAttachedShaders, (void *)glad_lazy_glGetAttachedShaders, 0 },
+    { "glGetAttribLocation", (void **)&glad_glGetAttribLocation, (void *)glad_lazy_glGetAttribLocation, 0 },
+    { "glGetBooleani_v", (void **)&glad_glGetBooleani_v, (void *)glad_lazy_glGetBooleani_v, 0 },
+    { "glGetBooleanv", (void **)&glad_glGetBooleanv, (void *)glad_lazy_glGetBooleanv, 0 },
+    { "glGetBufferParameteri64v", (void **)&glad_glGetBufferParameteri64v, (void *)glad_lazy_glGetBufferParameteri64v, 0 },
+    { "glGetBufferParameteriv", (void **)&glad_glGetBufferParameteriv, (void *)glad_lazy_glGetBufferParameteriv, 0 },
+    { "glGetBufferPointerv", (void **)&glad_glGetBufferPointerv, (void *)glad_lazy_glGetBufferPointerv, 0 },
+    { "glGetBufferSubData", (void **)&glad_glGetBufferSubData, (void *)glad_lazy_glGetBufferSubData, 0 },
+    { "glGetClipPlane", (void **)&glad_glGetClipPlane, (void *)glad_lazy_glGetClipPlane, 0 },
+    { "glGetCompressedTexImage", (void **)&glad_glGetCompressedTexImage, (void *)glad_lazy_glGetCompressedTexImage, 0 },
+    { "glGetCompressedTextureImage", (void **)&glad_glGetCompressedTextureImage, (void *)glad_lazy_glGetCompressedTextureImage, 0 },
+    { "glGetCompressedTextureSubImage", (void **)&glad_glGetCompressedTextureSubImage, (void *)glad_lazy_glGetCompressedTextureSubImage, 0 },
+    { "glGetDebugMessageLog", (void **)&glad_glGetDebugMessageLog, (void *)glad_lazy_glGetDebugMessageLog, 0 },
+    { "glGetDoublei_v", (void **)&glad_glGetDoublei_v, (void *)glad_lazy_glGetDoublei_v, 0 },
+    { "glGetDoublev", (void **)&glad_glGetDoublev, (void *)glad_lazy_glGetDoublev, 0 },
+    { "glGetError", (void **)&glad_glGetError, (void *)glad_lazy_glGetError, 0 },
+    { "glGetFloati_v", (void **)&glad_glGetFloati_v, (void *)glad_lazy_glGetFloati_v, 0 },
+    { "glGetFloatv", (void **)&glad_glGetFloatv, (void *)glad_lazy_glGetFloatv, 0 },
+    { "glGetFragDataIndex", (void **)&glad_glGetFragDataIndex, (void *)glad_lazy_glGetFragDataIndex, 0 },
+    { "glGetFragDataLocation", (void **)&glad_glGetFragDataLocation, (void *)glad_lazy_glGetFragDataLocation, 0 },
+    { "glGetFramebufferAttachmentParameteriv", (void **)&glad_glGetFramebufferAttachmentParameteriv, (void *)glad_lazy_glGetFramebufferAttachmentParameteriv, 0 },
+    { "glGetFramebufferParameteriv", (void **)&glad_glGetFramebufferParameteriv, (void *)glad_lazy_glGetFramebufferParameteriv, 0 },
+    { "glGetGraphicsResetStatus", (void **)&glad_glGetGraphicsResetStatus, (void *)glad_lazy_glGetGraphicsResetStatus, 0 },
+    { "glGetInteger64i_v", (void **)&glad_glGetInteger64i_v, (void *)glad_lazy_glGetInteger64i_v, 0 },
+    { "glGetInteger64v", (void **)&glad_glGetInteger64v, (void *)glad_lazy_glGetInteger64v, 0 },
+    { "glGetIntegeri_v", (void **)&glad_glGetIntegeri_v, (void *)glad_lazy_glGetIntegeri_v, 0 },
+    { "glGetIntegerv", (void **)&glad_glGetIntegerv, (void *)glad_lazy_glGetIntegerv, 0 },
+    { "glGetInternalformati64v", (void **)&glad_glGetInternalformati64v, (void *)glad_lazy_glGetInternalformati64v, 0 },
+    { "glGetInternalformativ", (void **)&glad_glGetInternalformativ, (void *)glad_lazy_glGetInternalformativ, 0 },
+    { "glGetLightfv", (void **)&glad_glGetLightfv, (void *)glad_lazy_glGetLightfv, 0 },
+    { "glGetLightiv", (void **)&glad_glGetLightiv, (void *)glad_lazy_glGetLightiv, 0 },
+    { "glGetMapdv", (void **)&glad_glGetMapdv, (void *)glad_lazy_glGetMapdv, 0 },
+    { "glGetMapfv", (void **)&glad_glGetMapfv, (void *)glad_lazy_glGetMapfv, 0 },
+    { "glGetMapiv", (void **)&glad_glGetMapiv, (void *)glad_lazy_glGetMapiv, 0 },
+    { "glGetMaterialfv", (void **)&glad_glGetMaterialfv, (void *)glad_lazy_glGetMaterialfv, 0 },
+    { "glGetMaterialiv", (void **)&glad_glGetMaterialiv, (void *)glad_lazy_glGetMaterialiv, 0 },
+    { "glGetMultisamplefv", (void **)&glad_glGetMultisamplefv, (void *)glad_lazy_glGetMultisamplefv, 0 },
+    { "glGetNamedBufferParameteri64v", (void **)&glad_glGetNamedBufferParameteri64v, (void *)glad_lazy_glGetNamedBufferParameteri64v, 0 },
+    { "glGetNamedBufferParameteriv", (void **)&glad_glGetNamedBufferParameteriv, (void *)glad_lazy_glGetNamedBufferParameteriv, 0 },
+    { "glGetNamedBufferPointerv", (void **)&glad_glGetNamedBufferPointerv, (void *)glad_lazy_glGetNamedBufferPointerv, 0 },
+    { "glGetNamedBufferSubData", (void **)&glad_glGetNamedBufferSubData, (void *)glad_lazy_glGetNamedBufferSubData, 0 },
+    { "glGetNamedFramebufferAttachmentParameteriv", (void **)&glad_glGetNamedFramebufferAttachmentParameteriv, (void *)glad_lazy_glGetNamedFramebufferAttachmentParameteriv, 0 },
+    { "glGetNamedFramebufferParameteriv", (void **)&glad_glGetNamedFramebufferParameteriv, (void *)glad_lazy_glGetNamedFramebufferParameteriv, 0 },
+    { "glGetNamedRenderbufferParameteriv", (void **)&glad_glGetNamedRenderbufferParameteriv, (void *)glad_lazy_glGetNamedRenderbufferParameteriv, 0 },
+    { "glGetObjectLabel", (void **)&glad_glGetObjectLabel, (void *)glad_lazy_glGetObjectLabel, 0 },
+    { "glGetObjectPtrLabel", (void **)&glad_glGetObjectPtrLabel, (void *)glad_lazy_glGetObjectPtrLabel, 0 },
+    { "glGetPixelMapfv", (void **)&glad_glGetPixelMapfv, (void *)glad_lazy_glGetPixelMapfv, 0 },
+    { "glGetPixelMapuiv", (void **)&glad_glGetPixelMapuiv, (void *)glad_lazy_glGetPixelMapuiv, 0 },
+    { "glGetPixelMapusv", (void **)&glad_glGetPixelMapusv, (void *)glad_lazy_glGetPixelMapusv, 0 },
+    { "glGetPointerv", (void **)&glad_glGetPointerv, (void *)glad_lazy_glGetPointerv, 0 },
+    { "glGetPolygonStipple", (void **)&glad_glGetPolygonStipple, (void *)glad_lazy_glGetPolygonStipple, 0 },
+    { "glGetProgramBinary", (void **)&glad_glGetProgramBinary, (void *)glad_lazy_glGetProgramBinary, 0 },
+    { "glGetProgramInfoLog", (void **)&glad_glGetProgramInfoLog, (void *)glad_lazy_glGetProgramInfoLog, 0 },
+    { "glGetProgramInterfaceiv", (void **)&glad_glGetProgramInterfaceiv, (void *)glad_lazy_glGetProgramInterfaceiv, 0 },
+    { "glGetProgramPipelineInfoLog", (void **)&glad_glGetProgramPipelineInfoLog, (void *)glad_lazy_glGetProgramPipelineInfoLog, 0 },
+    { "glGetProgramPipelineiv", (void **)&glad_glGetProgramPipelineiv, (void *)glad_lazy_glGetProgramPipelineiv, 0 },
+    { "glGetProgramResourceIndex", (void **)&glad_glGetProgramResourceIndex, (void *)glad_lazy_glGetProgramResourceIndex, 0 },
+    { "glGetProgramResourceLocation", (void **)&glad_glGetProgramResourceLocation, (void *)glad_lazy_glGetProgramResourceLocation, 0 },
+    { "glGetProgramResourceLocationIndex", (void **)&glad_glGetProgramResourceLocationIndex, (void *)glad_lazy_glGetProgramResourceLocationIndex, 0 },
+    { "glGetProgramResourceName", (void **)&glad_glGetProgramResourceName, (void *)glad_lazy_glGetProgramResourceName, 0 },
+    { "glGetProgramResourceiv", (void **)&glad_glGetProgramResourceiv, (void *)glad_lazy_glGetProgramResourceiv, 0 },
+    { "glGetProgramStageiv", (void **)&glad_glGetProgramStageiv, (void *)glad_lazy_glGetProgramStageiv, 0 },
+    { "glGetProgramiv", (void **)&glad_glGetProgramiv, (void *)glad_lazy_glGetProgramiv, 0 },
+    { "glGetQueryBufferObjecti64v", (void **)&glad_glGetQueryBufferObjecti64v, (void *)glad_lazy_glGetQueryBufferObjecti64v, 0 },
+    { "glGetQueryBufferObjectiv", (void **)&glad_glGetQueryBufferObjectiv, (void *)glad_lazy_glGetQueryBufferObjectiv, 0 },
+    { "glGetQueryBufferObjectui64v", (void **)&glad_glGetQueryBufferObjectui64v, (void *)glad_lazy_glGetQueryBufferObjectui64v, 0 },
+    { "glGetQueryBufferObjectuiv", (void **)&glad_glGetQueryBufferObjectuiv, (void *)glad_lazy_glGetQueryBufferObjectuiv, 0 },
+    { "glGetQueryIndexediv", (void **)&glad_glGetQueryIndexediv, (void *)glad_lazy_glGetQueryIndexediv, 0 },
+    { "glGetQueryObjecti64v", (void **)&glad_glGetQueryObjecti64v, (void *)glad_lazy_glGetQueryObjecti64v, 0 },
+    { "glGetQueryObjectiv", (void **)&glad_glGetQueryObjectiv, (void *)glad_lazy_glGetQueryObjectiv, 0 },
+    { "glGetQueryObjectui64v", (void **)&glad_glGetQueryObjectui64v, (void *)glad_lazy_glGetQueryObjectui64v, 0 },
+    { "glGetQueryObjectuiv", (void **)&glad_glGetQueryObjectuiv, (void *)glad_lazy_glGetQueryObjectuiv, 0 },
+    { "glGetQueryiv", (void **)&glad_glGetQueryiv, (void *)glad_lazy_glGetQueryiv, 0 },
+    { "glGetRenderbufferParameteriv", (void **)&glad_glGetRenderbufferParameteriv, (void *)glad_lazy_glGetRenderbufferParameteriv, 0 },
+    { "glGetSamplerParameterIiv", (void **)&glad_glGetSamplerParameterIiv, (void *)glad_lazy_glGetSamplerParameterIiv, 0 },
+    { "glGetSamplerParameterIuiv", (void **)&glad_glGetSamplerParameterIuiv, (void *)glad_lazy_glGetSamplerParameterIuiv, 0 },
+    { "glGetSamplerParameterfv", (void **)&glad_glGetSamplerParameterfv, (void *)glad_lazy_glGetSamplerParameterfv, 0 },
+    { "glGetSamplerParameteriv", (void **)&glad_glGetSamplerParameteriv, (void *)glad_lazy_glGetSamplerParameteriv, 0 },
+    { "glGetShaderInfoLog", (void **)&glad_glGetShaderInfoLog, (void *)glad_lazy_glGetShaderInfoLog, 0 },
+    { "glGetShaderPrecisionFormat", (void **)&glad_glGetShaderPrecisionFormat, (void *)glad_lazy_glGetShaderPrecisionFormat, 0 },
+    { "glGetShaderSource", (void **)&glad_glGetShaderSource, (void *)glad_lazy_glGetShaderSource, 0 },
+    { "glGetShaderiv", (void **)&glad_glGetShaderiv, (void *)glad_lazy_glGetShaderiv, 0 },
+    { "glGetString", (void **)&glad_glGetString, (void *)glad_lazy_glGetString, 0 },
+    { "glGetStringi", (void **)&glad_glGetStringi, (void *)glad_lazy_glGetStringi, 0 },
+    { "glGetSubroutineIndex", (void **)&glad_glGetSubroutineIndex, (void *)glad_lazy_glGetSubroutineIndex, 0 },
+    { "glGetSubroutineUniformLocation", (void **)&glad_glGetSubroutineUniformLocation, (void *)glad_lazy_glGetSubroutineUniformLocation, 0 },
+    { "glGetSynciv", (void **)&glad_glGetSynciv, (void *)glad_lazy_glGetSynciv, 0 },
+    { "glGetTexEnvfv", (void **)&glad_glGetTexEnvfv, (void *)glad_lazy_glGetTexEnvfv, 0 },
+    { "glGetTexEnviv", (void **)&glad_glGetTexEnviv, (void *)glad_lazy_glGetTexEnviv, 0 },
+    { "glGetTexGendv", (void **)&glad_glGetTexGendv, (void *)glad_lazy_glGetTexGendv, 0 },
+    { "glGetTexGenfv", (void **)&glad_glGetTexGenfv, (void *)glad_lazy_glGetTexGenfv, 0 },
+    { "glGetTexGeniv", (void **)&glad_glGetTexGeniv, (void *)glad_lazy_glGetTexGeniv, 0 },
+    { "glGetTexImage", (void **)&glad_glGetTexImage, (void *)glad_lazy_glGetTexImage, 0 },
+    { "glGetTexLevelParameterfv", (void **)&glad_glGetTexLevelParameterfv, (void *)glad_lazy_glGetTexLevelParameterfv, 0 },
+    { "glGetTexLevelParameteriv", (void **)&glad_glGetTexLevelParameteriv, (void *)glad_lazy_glGetTexLevelParameteriv, 0 },
+    { "glGetTexParameterIiv", (void **)&glad_glGetTexParameterIiv, (void *)glad_lazy_glGetTexParameterIiv, 0 },
+    { "glGetTexParameterIuiv", (void **)&glad_glGetTexParameterIuiv, (void *)glad_lazy_glGetTexParameterIuiv, 0 },
+    { "glGetTexParameterfv", (void **)&glad_glGetTexParameterfv, (void *)glad_lazy_glGetTexParameterfv, 0 },
+    { "glGetTexParameteriv", (void **)&glad_glGetTexParameteriv, (void *)glad_lazy_glGetTexParameteriv, 0 },
+    { "glGetTextureImage", (void **)&glad_glGetTextureImage, (void *)glad_lazy_glGetTextureImage, 0 },
+    { "glGetTextureLevelParameterfv", (void **)&glad_glGetTextureLevelParameterfv, (void *)glad_lazy_glGetTextureLevelParameterfv, 0 },
+    { "glGetTextureLevelParameteriv", (void **)&glad_glGetTextureLevelParameteriv, (void *)glad_lazy_glGetTextureLevelParameteriv, 0 },
+    { "glGetTextureParameterIiv", (void **)&glad_glGetTextureParameterIiv, (void *)glad_lazy_glGetTextureParameterIiv, 0 },
+    { "glGetTextureParameterIuiv", (void **)&glad_glGetTextureParameterIuiv, (void *)glad_lazy_glGetTextureParameterIuiv, 0 },
+    { "glGetTextureParameterfv", (void **)&glad_glGetTextureParameterfv, (void *)glad_lazy_glGetTextureParameterfv, 0 },
+    { "glGetTextureParameteriv", (void **)&glad_glGetTextureParameteriv, (void *)glad_lazy_glGetTextureParameteriv, 0 },
+    { "glGetTextureSubImage", (void **)&glad_glGetTextureSubImage, (void *)glad_lazy_glGetTextureSubImage, 0 },
+    { "glGetTransformFeedbackVarying", (void **)&glad_glGetTransformFeedbackVarying, (void *)glad_lazy_glGetTransformFeedbackVarying, 0 },
+    { "glGetTransformFeedbacki64_v", (void **)&glad_glGetTransformFeedbacki64_v, (void *)glad_lazy_glGetTransformFeedbacki64_v, 0 },
+    { "glGetTransformFeedbacki_v", (void **)&glad_glGetTransformFeedbacki_v, (void *)glad_lazy_glGetTransformFeedbacki_v, 0 },
+    { "glGetTransformFeedbackiv", (void **)&glad_glGetTransformFeedbackiv, (void *)glad_lazy_glGetTransformFeedbackiv, 0 },
+    { "glGetUniformBlockIndex", (void **)&glad_glGetUniformBlockIndex, (void *)glad_lazy_glGetUniformBlockIndex, 0 },
+    { "glGetUniformIndices", (void **)&glad_glGetUniformIndices, (void *)glad_lazy_glGetUniformIndices, 0 },
+    { "glGetUniformLocation", (void **)&glad_glGetUniformLocation, (void *)glad_lazy_glGetUniformLocation, 0 },
+    { "glGetUniformSubroutineuiv", (void **)&glad_glGetUniformSubroutineuiv, (void *)glad_lazy_glGetUniformSubroutineuiv, 0 },
+    { "glGetUniformdv", (void **)&glad_glGetUniformdv, (void *)glad_lazy_glGetUniformdv, 0 },
+    { "glGetUniformfv", (void **)&glad_glGetUniformfv, (void *)glad_lazy_glGetUniformfv, 0 },
+    { "glGetUniformiv", (void **)&glad_glGetUniformiv, (void *)glad_lazy_glGetUniformiv, 0 },
+    { "glGetUniformuiv", (void **)&glad_glGetUniformuiv, (void *)glad_lazy_glGetUniformuiv, 0 },
+    { "glGetVertexArrayIndexed64iv", (void **)&glad_glGetVertexArrayIndexed64iv, (void *)glad_lazy_glGetVertexArrayIndexed64iv, 0 },
+    { "glGetVertexArrayIndexediv", (void **)&glad_glGetVertexArrayIndexediv, (void *)glad_lazy_glGetVertexArrayIndexediv, 0 },
+    { "glGetVertexArrayiv", (void **)&glad_glGetVertexArrayiv, (void *)glad_lazy_glGetVertexArrayiv, 0 },
+    { "glGetVertexAttribIiv", (void **)&glad_glGetVertexAttribIiv, (void *)glad_lazy_glGetVertexAttribIiv, 0 },
+    { "glGetVertexAttribIuiv", (void **)&glad_glGetVertexAttribIuiv, (void *)glad_lazy_glGetVertexAttribIuiv, 0 },
+    { "glGetVertexAttribLdv", (void **)&glad_glGetVertexAttribLdv, (void *)glad_lazy_glGetVertexAttribLdv, 0 },
+    { "glGetVertexAttribPointerv", (void **)&glad_glGetVertexAttribPointerv, (void *)glad_lazy_glGetVertexAttribPointerv, 0 },
+    { "glGetVertexAttribdv", (void **)&glad_glGetVertexAttribdv, (void *)glad_lazy_glGetVertexAttribdv, 0 },
+    { "glGetVertexAttribfv", (void **)&glad_glGetVertexAttribfv, (void *)glad_lazy_glGetVertexAttribfv, 0 },
+    { "glGetVertexAttribiv", (void **)&glad_glGetVertexAttribiv, (void *)glad_lazy_glGetVertexAttribiv, 0 },
+    { "glGetnColorTable", (void **)&glad_glGetnColorTable, (void *)glad_lazy_glGetnColorTable, 0 },
+    { "glGetnCompressedTexImage", (void **)&glad_glGetnCompressedTexImage, (void *)glad_lazy_glGetnCompressedTexImage, 0 },
+    { "glGetnConvolutionFilter", (void **)&glad_glGetnConvolutionFilter, (void *)glad_lazy_glGetnConvolutionFilter, 0 },
+    { "glGetnHistogram", (void **)&glad_glGetnHistogram, (void *)glad_lazy_glGetnHistogram, 0 },
+    { "glGetnMapdv", (void **)&glad_glGetnMapdv, (void *)glad_lazy_glGetnMapdv, 0 },
+    { "glGetnMapfv", (void **)&glad_glGetnMapfv, (void *)glad_lazy_glGetnMapfv, 0 },
+    { "glGetnMapiv", (void **)&glad_glGetnMapiv, (void *)glad_lazy_glGetnMapiv, 0 },
+    { "glGetnMinmax", (void **)&glad_glGetnMinmax, (void *)glad_lazy_glGetnMinmax, 0 },
+    { "glGetnPixelMapfv", (void **)&glad_glGetnPixelMapfv, (void *)glad_lazy_glGetnPixelMapfv, 0 },
+    { "glGetnPixelMapuiv", (void **)&glad_glGetnPixelMapuiv, (void *)glad_lazy_glGetnPixelMapuiv, 0 },
+    { "glGetnPixelMapusv", (void **)&glad_glGetnPixelMapusv, (void *)glad_lazy_glGetnPixelMapusv, 0 },
+    { "glGetnPolygonStipple", (void **)&glad_glGetnPolygonStipple, (void *)glad_lazy_glGetnPolygonStipple, 0 },
+    { "glGetnSeparableFilter", (void **)&glad_glGetnSeparableFilter, (void *)glad_lazy_glGetnSeparableFilter, 0 },
+    { "glGetnTexImage", (void **)&glad_glGetnTexImage, (void *)glad_lazy_glGetnTexImage, 0 },
+    { "glGetnUniformdv", (void **)&glad_glGetnUniformdv, (void *)glad_lazy_glGetnUniformdv, 0 },
+    { "glGetnUniformfv", (void **)&glad_glGetnUniformfv, (void *)glad_lazy_glGetnUniformfv, 0 },
+    { "glGetnUniformiv", (void **)&glad_glGetnUniformiv, (void *)glad_lazy_glGetnUniformiv, 0 },
+    { "glGetnUniformuiv", (void **)&glad_glGetnUniformuiv, (void *)glad_lazy_glGetnUniformuiv, 0 },
+    { "glHint", (void **)&glad_glHint, (void *)glad_lazy_glHint, 0 },
+    { "glIndexMask", (void **)&glad_glIndexMask, (void *)glad_lazy_glIndexMask, 0 },
+    { "glIndexPointer", (void **)&glad_glIndexPointer, (void *)glad_lazy_glIndexPointer, 0 },
+    { "glIndexd", (void **)&glad_glIndexd, (void *)glad_lazy_glIndexd, 0 },
+    { "glIndexdv", (void **)&glad_glIndexdv, (void *)glad_lazy_glIndexdv, 0 },
+    { "glIndexf", (void **)&glad_glIndexf, (void *)glad_lazy_glIndexf, 0 },
+    { "glIndexfv", (void **)&glad_glIndexfv, (void *)glad_lazy_glIndexfv, 0 },
+    { "glIndexi", (void **)&glad_glIndexi, (void *)glad_lazy_glIndexi, 0 },
+    { "glIndexiv", (void **)&glad_glIndexiv, (void *)glad_lazy_glIndexiv, 0 },
+    { "glIndexs", (void **)&glad_glIndexs, (void *)glad_lazy_glIndexs, 0 },
+    { "glIndexsv", (void **)&glad_glIndexsv, (void *)glad_lazy_glIndexsv, 0 },
+    { "glIndexub", (void **)&glad_glIndexub, (void *)glad_lazy_glIndexub, 0 },
+    { "glIndexubv", (void **)&glad_glIndexubv, (void *)glad_lazy_glIndexubv, 0 },
+    { "glInitNames", (void **)&glad_glInitNames, (void *)glad_lazy_glInitNames, 0 },
+    { "glInterleavedArrays", (void **)&glad_glInterleavedArrays, (void *)glad_lazy_glInterleavedArrays, 0 },
+    { "glInvalidateBufferData", (void **)&glad_glInvalidateBufferData, (void *)glad_lazy_glInvalidateBufferData, 0 },
+    { "glInvalidateBufferSubData", (void **)&glad_glInvalidateBufferSubData, (void *)glad_lazy_glInvalidateBufferSubData, 0 },
+    { "glInvalidateFramebuffer", (void **)&glad_glInvalidateFramebuffer, (void *)glad_lazy_glInvalidateFramebuffer, 0 },
+    { "glInvalidateNamedFramebufferData", (void **)&glad_glInvalidateNamedFramebufferData, (void *)glad_lazy_glInvalidateNamedFramebufferData, 0 },
+    { "glInvalidateNamedFramebufferSubData", (void **)&glad_glInvalidateNamedFramebufferSubData, (void *)glad_lazy_glInvalidateNamedFramebufferSubData, 0 },
+    { "glInvalidateSubFramebuffer", (void **)&glad_glInvalidateSubFramebuffer, (void *)glad_lazy_glInvalidateSubFramebuffer, 0 },
+    { "glInvalidateTexImage", (void **)&glad_glInvalidateTexImage, (void *)glad_lazy_glInvalidateTexImage, 0 },
+    { "glInvalidateTexSubImage", (void **)&glad_glInvalidateTexSubImage, (void *)glad_lazy_glInvalidateTexSubImage, 0 },
+    { "glIsBuffer", (void **)&glad_glIsBuffer, (void *)glad_lazy_glIsBuffer, 0 },
+    { "glIsEnabled", (void **)&glad_glIsEnabled, (void *)glad_lazy_glIsEnabled, 0 },
+    { "glIsEnabledi", (void **)&glad_glIsEnabledi, (void *)glad_lazy_glIsEnabledi, 0 },
+    { "glIsFramebuffer", (void **)&glad_glIsFramebuffer, (void *)glad_lazy_glIsFramebuffer, 0 },
+    { "glIsList", (void **)&glad_glIsList, (void *)glad_lazy_glIsList, 0 },
+    { "glIsProgram", (void **)&glad_glIsProgram, (void *)glad_lazy_glIsProgram, 0 },
+    { "glIsProgramPipeline", (void **)&glad_glIsProgramPipeline, (void *)glad_lazy_glIsProgramPipeline, 0 },
+    { "glIsQuery", (void **)&glad_glIsQuery, (void *)glad_lazy_glIsQuery, 0 },
+    { "glIsRenderbuffer", (void **)&glad_glIsRenderbuffer, (void *)glad_lazy_glIsRenderbuffer, 0 },
+    { "glIsSampler", (void **)&glad_glIsSampler, (void *)glad_lazy_glIsSampler, 0 },
+    { "glIsShader", (void **)&glad_glIsShader, (void *)glad_lazy_glIsShader, 0 },
+    { "glIsSync", (void **)&glad_glIsSync, (void *)glad_lazy_glIsSync, 0 },
+    { "glIsTexture", (void **)&glad_glIsTexture, (void *)glad_lazy_glIsTexture, 0 },
+    { "glIsTransformFeedback", (void **)&glad_glIsTransformFeedback, (void *)glad_lazy_glIsTransformFeedback, 0 },
+    { "glIsVertexArray", (void **)&glad_glIsVertexArray, (void *)glad_lazy_glIsVertexArray, 0 },
+    { "glLightModelf", (void **)&glad_glLightModelf, (void *)glad_lazy_glLightModelf, 0 },
+    { "glLightModelfv", (void **)&glad_glLightModelfv, (void *)glad_lazy_glLightModelfv, 0 },
+    { "glLightModeli", (void **)&glad_glLightModeli, (void *)glad_lazy_glLightModeli, 0 },
+    { "glLightModeliv", (void **)&glad_glLightModeliv, (void *)glad_lazy_glLightModeliv, 0 },
+    { "glLightf", (void **)&glad_glLightf, (void *)glad_lazy_glLightf, 0 },
+    { "glLightfv", (void **)&glad_glLightfv, (void *)glad_lazy_glLightfv, 0 },
+    { "glLighti", (void **)&glad_glLighti, (void *)glad_lazy_glLighti, 0 },
+    { "glLightiv", (void **)&glad_glLightiv, (void *)glad_lazy_glLightiv, 0 },
+    { "glLineStipple", (void **)&glad_glLineStipple, (void *)glad_lazy_glLineStipple, 0 },
+    { "glLineWidth", (void **)&glad_glLineWidth, (void *)glad_lazy_glLineWidth, 0 },
+    { "glLinkProgram", (void **)&glad_glLinkProgram, (void *)glad_lazy_glLinkProgram, 0 },
+    { "glListBase", (void **)&glad_glListBase, (void *)glad_lazy_glListBase, 0 },
+    { "glLoadIdentity", (void **)&glad_glLoadIdentity, (void *)glad_lazy_glLoadIdentity, 0 },
+    { "glLoadMatrixd", (void **)&glad_glLoadMatrixd, (void *)glad_lazy_glLoadMatrixd, 0 },
+    { "glLoadMatrixf", (void **)&glad_glLoadMatrixf, (void *)glad_lazy_glLoadMatrixf, 0 },
+    { "glLoadName", (void **)&glad_glLoadName, (void *)glad_lazy_glLoadName, 0 },
+    { "glLoadTransposeMatrixd", (void **)&glad_glLoadTransposeMatrixd, (void *)glad_lazy_glLoadTransposeMatrixd, 0 },
+    { "glLoadTransposeMatrixf", (void **)&glad_glLoadTransposeMatrixf, (void *)glad_lazy_glLoadTransposeMatrixf, 0 },
+    { "glLogicOp", (void **)&glad_glLogicOp, (void *)glad_lazy_glLogicOp, 0 },
+    { "glMap1d", (void **)&glad_glMap1d, (void *)glad_lazy_glMap1d, 0 },
+    { "glMap1f", (void **)&glad_glMap1f, (void *)glad_lazy_glMap1f, 0 },
+    { "glMap2d", (void **)&glad_glMap2d, (void *)glad_lazy_glMap2d, 0 },
+    { "glMap2f", (void **)&glad_glMap2f, (void *)glad_lazy_glMap2f, 0 },
+    { "glMapBuffer", (void **)&glad_glMapBuffer, (void *)glad_lazy_glMapBuffer, 0 },
+    { "glMapBufferRange", (void **)&glad_glMapBufferRange, (void *)glad_lazy_glMapBufferRange, 0 },
+    { "glMapGrid1d", (void **)&glad_glMapGrid1d, (void *)glad_lazy_glMapGrid1d, 0 },
+    { "glMapGrid1f", (void **)&glad_glMapGrid1f, (void *)glad_lazy_glMapGrid1f, 0 },
+    { "glMapGrid2d", (void **)&glad_glMapGrid2d, (void *)glad_lazy_glMapGrid2d, 0 },
+    { "glMapGrid2f", (void **)&glad_glMapGrid2f, (void *)glad_lazy_glMapGrid2f, 0 },
+    { "glMapNamedBuffer", (void **)&glad_glMapNamedBuffer, (void *)glad_lazy_glMapNamedBuffer, 0 },
+    { "glMapNamedBufferRange", (void **)&glad_glMapNamedBufferRange, (void *)glad_lazy_glMapNamedBufferRange, 0 },
+    { "glMaterialf", (void **)&glad_glMaterialf, (void *)glad_lazy_glMaterialf, 0 },
+    { "glMaterialfv", (void **)&glad_glMaterialfv, (void *)glad_lazy_glMaterialfv, 0 },
+    { "glMateriali", (void **)&glad_glMateriali, (void *)glad_lazy_glMateriali, 0 },
+    { "glMaterialiv", (void **)&glad_glMaterialiv, (void *)glad_lazy_glMaterialiv, 0 },
+    { "glMatrixMode", (void **)&glad_glMatrixMode, (void *)glad_lazy_glMatrixMode, 0 },
+    { "glMemoryBarrier", (void **)&glad_glMemoryBarrier, (void *)glad_lazy_glMemoryBarrier, 0 },
+    { "glMemoryBarrierByRegion", (void **)&glad_glMemoryBarrierByRegion, (void *)glad_lazy_glMemoryBarrierByRegion, 0 },
+    { "glMinSampleShading", (void **)&glad_glMinSampleShading, (void *)glad_lazy_glMinSampleShading, 0 },
+    { "glMultMatrixd", (void **)&glad_glMultMatrixd, (void *)glad_lazy_glMultMatrixd, 0 },
+    { "glMultMatrixf", (void **)&glad_glMultMatrixf, (void *)glad_lazy_glMultMatrixf, 0 },
+    { "glMultTransposeMatrixd", (void **)&glad_glMultTransposeMatrixd, (void *)glad_lazy_glMultTransposeMatrixd, 0 },
+    { "glMultTransposeMatrixf", (void **)&glad_glMultTransposeMatrixf, (void *)glad_lazy_glMultTransposeMatrixf, 0 },
+    { "glMultiDrawArrays", (void **)&glad_glMultiDrawArrays, (void *)glad_lazy_glMultiDrawArrays, 0 },
+    { "glMultiDrawArraysIndirect", (void **)&glad_glMultiDrawArraysIndirect, (void *)glad_lazy_glMultiDrawArraysIndirect, 0 },
+    { "glMultiDrawArraysIndirectCount", (void **)&glad_glMultiDrawArraysIndirectCount, (void *)glad_lazy_glMultiDrawArraysIndirectCount, 0 },
+    { "glMultiDrawElements", (void **)&glad_glMultiDrawElements, (void *)glad_lazy_glMultiDrawElements, 0 },
+    { "glMultiDrawElementsBaseVertex", (void **)&glad_glMultiDrawElementsBaseVertex, (void *)glad_lazy_glMultiDrawElementsBaseVertex, 0 },
+    { "glMultiDrawElementsIndirect", (void **)&glad_glMultiDrawElementsIndirect, (void *)glad_lazy_glMultiDrawElementsIndirect, 0 },
+    { "glMultiDrawElementsIndirectCount", (void **)&glad_glMultiDrawElementsIndirectCount, (void *)glad_lazy_glMultiDrawElementsIndirectCount, 0 },
+    { "glMultiTexCoord1d", (void **)&glad_glMultiTexCoord1d, (void *)glad_lazy_glMultiTexCoord1d, 0 },
+    { "glMultiTexCoord1dv", (void **)&glad_glMultiTexCoord1dv, (void *)glad_lazy_glMultiTexCoord1dv, 0 },
+    { "glMultiTexCoord1f", (void **)&glad_glMultiTexCoord1f, (void *)glad_lazy_glMultiTexCoord1f, 0 },
+    { "glMultiTexCoord1fv", (void **)&glad_glMultiTexCoord1fv, (void *)glad_lazy_glMultiTexCoord1fv, 0 },
+    { "glMultiTexCoord1i", (void **)&glad_glMultiTexCoord1i, (void *)glad_lazy_glMultiTexCoord1i, 0 },
+    { "glMultiTexCoord1iv", (void **)&glad_glMultiTexCoord1iv, (void *)glad_lazy_glMultiTexCoord1iv, 0 },
+    { "glMultiTexCoord1s", (void **)&glad_glMultiTexCoord1s, (void *)glad_lazy_glMultiTexCoord1s, 0 },
+    { "glMultiTexCoord1sv", (void **)&glad_glMultiTexCoord1sv, (void *)glad_lazy_glMultiTexCoord1sv, 0 },
+    { "glMultiTexCoord2d", (void **)&glad_glMultiTexCoord2d, (void *)glad_lazy_glMultiTexCoord2d, 0 },
+    { "glMultiTexCoord2dv", (void **)&glad_glMultiTexCoord2dv, (void *)glad_lazy_glMultiTexCoord2dv, 0 },
+    { "glMultiTexCoord2f", (void **)&glad_glMultiTexCoord2f, (void *)glad_lazy_glMultiTexCoord2f, 0 },
+    { "glMultiTexCoord2fv", (void **)&glad_glMultiTexCoord2fv, (void *)glad_lazy_glMultiTexCoord2fv, 0 },
+    { "glMultiTexCoord2i", (void **)&glad_glMultiTexCoord2i, (void *)glad_lazy_glMultiTexCoord2i, 0 },
+    { "glMultiTexCoord2iv", (void **)&glad_glMultiTexCoord2iv, (void *)glad_lazy_glMultiTexCoord2iv, 0 },
+    { "glMultiTexCoord2s", (void **)&glad_glMultiTexCoord2s, (void *)glad_lazy_glMultiTexCoord2s, 0 },
+    { "glMultiTexCoord2sv", (void **)&glad_glMultiTexCoord2sv, (void *)glad_lazy_glMultiTexCoord2sv, 0 },
+    { "glMultiTexCoord3d", (void **)&glad_glMultiTexCoord3d, (void *)glad_lazy_glMultiTexCoord3d, 0 },
+    { "glMultiTexCoord3dv", (void **)&glad_glMultiTexCoord3dv, (void *)glad_lazy_glMultiTexCoord3dv, 0 },
+    { "glMultiTexCoord3f", (void **)&glad_glMultiTexCoord3f, (void *)glad_lazy_glMultiTexCoord3f, 0 },
+    { "glMultiTexCoord3fv", (void **)&glad_glMultiTexCoord3fv, (void *)glad_lazy_glMultiTexCoord3fv, 0 },
+    { "glMultiTexCoord3i", (void **)&glad_glMultiTexCoord3i, (void *)glad_lazy_glMultiTexCoord3i, 0 },
+    { "glMultiTexCoord3iv", (void **)&glad_glMultiTexCoord3iv, (void *)glad_lazy_glMultiTexCoord3iv, 0 },
+    { "glMultiTexCoord3s", (void **)&glad_glMultiTexCoord3s, (void *)glad_lazy_glMultiTexCoord3s, 0 },
+    { "glMultiTexCoord3sv", (void **)&glad_glMultiTexCoord3sv, (void *)glad_lazy_glMultiTexCoord3sv, 0 },
+    { "glMultiTexCoord4d", (void **)&glad_glMultiTexCoord4d, (void *)glad_lazy_glMultiTexCoord4d, 0 },
+    { "glMultiTexCoord4dv", (void **)&glad_glMultiTexCoord4dv, (void *)glad_lazy_glMultiTexCoord4dv, 0 },
+    { "glMultiTexCoord4f", (void **)&glad_glMultiTexCoord4f, (void *)glad_lazy_glMultiTexCoord4f, 0 },
+    { "glMultiTexCoord4fv", (void **)&glad_glMultiTexCoord4fv, (void *)glad_lazy_glMultiTexCoord4fv, 0 },
+    { "glMultiTexCoord4i", (void **)&glad_glMultiTexCoord4i, (void *)glad_lazy_glMultiTexCoord4i, 0 },
+    { "glMultiTexCoord4iv", (void **)&glad_glMultiTexCoord4iv, (void *)glad_lazy_glMultiTexCoord4iv, 0 },
+    { "glMultiTexCoord4s", (void **)&glad_glMultiTexCoord4s, (void *)glad_lazy_glMultiTexCoord4s, 0 },
+    { "glMultiTexCoord4sv", (void **)&glad_glMultiTexCoord4sv, (void *)glad_lazy_glMultiTexCoord4sv, 0 },
+    { "glMultiTexCoordP1ui", (void **)&glad_glMultiTexCoordP1ui, (void *)glad_lazy_glMultiTexCoordP1ui, 0 },
+    { "glMultiTexCoordP1uiv", (void **)&glad_glMultiTexCoordP1uiv, (void *)glad_lazy_glMultiTexCoordP1uiv, 0 },
+    { "glMultiTexCoordP2ui", (void **)&glad_glMultiTexCoordP2ui, (void *)glad_lazy_glMultiTexCoordP2ui, 0 },
+    { "glMultiTexCoordP2uiv", (void **)&glad_glMultiTexCoordP2uiv, (void *)glad_lazy_glMultiTexCoordP2uiv, 0 },
+    { "glMultiTexCoordP3ui", (void **)&glad_glMultiTexCoordP3ui, (void *)glad_lazy_glMultiTexCoordP3ui, 0 },
+    { "glMultiTexCoordP3uiv", (void **)&glad_glMultiTexCoordP3uiv, (void *)glad_lazy_glMultiTexCoordP3uiv, 0 },
+    { "glMultiTexCoordP4ui", (void **)&glad_glMultiTexCoordP4ui, (void *)glad_lazy_glMultiTexCoordP4ui, 0 },
+    { "glMultiTexCoordP4uiv", (void **)&glad_glMultiTexCoordP4uiv, (void *)glad_lazy_glMultiTexCoordP4uiv, 0 },
+    { "glNamedBufferData", (void **)&glad_glNamedBufferData, (void *)glad_lazy_glNamedBufferData, 0 },
+    { "glNamedBufferStorage", (void **)&glad_glNamedBufferStorage, (void *)glad_lazy_glNamedBufferStorage, 0 },
+    { "glNamedBufferSubData", (void **)&glad_glNamedBufferSubData, (void *)glad_lazy_glNamedBufferSubData, 0 },
+    { "glNamedFramebufferDrawBuffer", (void **)&glad_glNamedFramebufferDrawBuffer, (void *)glad_lazy_glNamedFramebufferDrawBuffer, 0 },
+    { "glNamedFramebufferDrawBuffers", (void **)&glad_glNamedFramebufferDrawBuffers, (void *)glad_lazy_glNamedFramebufferDrawBuffers, 0 },
+    { "glNamedFramebufferParameteri", (void **)&glad_glNamedFramebufferParameteri, (void *)glad_lazy_glNamedFramebufferParameteri, 0 },
+    { "glNamedFramebufferReadBuffer", (void **)&glad_glNamedFramebufferReadBuffer, (void *)glad_lazy_glNamedFramebufferReadBuffer, 0 },
+    { "glNamedFramebufferRenderbuffer", (void **)&glad_glNamedFramebufferRenderbuffer, (void *)glad_lazy_glNamedFramebufferRenderbuffer, 0 },
+    { "glNamedFramebufferTexture", (void **)&glad_glNamedFramebufferTexture, (void *)glad_lazy_glNamedFramebufferTexture, 0 },
+    { "glNamedFramebufferTextureLayer", (void **)&glad_glNamedFramebufferTextureLayer, (void *)glad_lazy_glNamedFramebufferTextureLayer, 0 },
+    { "glNamedRenderbufferStorage", (void **)&glad_glNamedRenderbufferStorage, (void *)glad_lazy_glNamedRenderbufferStorage, 0 },
+    { "glNamedRenderbufferStorageMultisample", (void **)&glad_glNamedRenderbufferStorageMultisample, (void *)glad_lazy_glNamedRenderbufferStorageMultisample, 0 },
+    { "glNewList", (void **)&glad_glNewList, (void *)glad_lazy_glNewList, 0 },
+    { "glNormal3b", (void **)&glad_glNormal3b, (void *)glad_lazy_glNormal3b, 0 },
+    { "glNormal3bv", (void **)&glad_glNormal3bv, (void *)glad_lazy_glNormal3bv, 0 },
+    { "glNormal3d", (void **)&glad_glNormal3d, (void *)glad_lazy_glNormal3d, 0 },
+    { "glNormal3dv", (void **)&glad_glNormal3dv, (void *)glad_lazy_glNormal3dv, 0 },
+    { "glNormal3f", (void **)&glad_glNormal3f, (void *)glad_lazy_glNormal3f, 0 },
+    { "glNormal3fv", (void **)&glad_glNormal3fv, (void *)glad_lazy_glNormal3fv, 0 },
+    { "glNormal3i", (void **)&glad_glNormal3i, (void *)glad_lazy_glNormal3i, 0 },
+    { "glNormal3iv", (void **)&glad_glNormal3iv, (void *)glad_lazy_glNormal3iv, 0 },
+    { "glNormal3s", (void **)&glad_glNormal3s, (void *)glad_lazy_glNormal3s, 0 },
+    { "glNormal3sv", (void **)&glad_glNormal3sv, (void *)glad_lazy_glNormal3sv, 0 },
+    { "glNormalP3ui", (void **)&glad_glNormalP3ui, (void *)glad_lazy_glNormalP3ui, 0 },
+    { "glNormalP3uiv", (void **)&glad_glNormalP3uiv, (void *)glad_lazy_glNormalP3uiv, 0 },
+    { "glNormalPointer", (void **)&glad_glNormalPointer, (void *)glad_lazy_glNormalPointer, 0 },
+    { "glObjectLabel", (void **)&glad_glObjectLabel, (void *)glad_lazy_glObjectLabel, 0 },
+    { "glObjectPtrLabel", (void **)&glad_glObjectPtrLabel, (void *)glad_lazy_glObjectPtrLabel, 0 },
+    { "glOrtho", (void **)&glad_glOrtho, (void *)glad_lazy_glOrtho, 0 },
+    { "glPassThrough", (void **)&glad_glPassThrough, (void *)glad_lazy_glPassThrough, 0 },
+    { "glPatchParameterfv", (void **)&glad_glPatchParameterfv, (void *)glad_lazy_glPatchParameterfv, 0 },
+    { "glPatchParameteri", (void **)&glad_glPatchParameteri, (void *)glad_lazy_glPatchParameteri, 0 },
+    { "glPauseTransformFeedback", (void **)&glad_glPauseTransformFeedback, (void *)glad_lazy_glPauseTransformFeedback, 0 },
+    { "glPixelMapfv", (void **)&glad_glPixelMapfv, (void *)glad_lazy_glPixelMapfv, 0 },
+    { "glPixelMapuiv", (void **)&glad_glPixelMapuiv, (void *)glad_lazy_glPixelMapuiv, 0 },
+    { "glPixelMapusv", (void **)&glad_glPixelMapusv, (void *)glad_lazy_glPixelMapusv, 0 },
+    { "glPixelStoref", (void **)&glad_glPixelStoref, (void *)glad_lazy_glPixelStoref, 0 },
+    { "glPixelStorei", (void **)&glad_glPixelStorei, (void *)glad_lazy_glPixelStorei, 0 },
+    { "glPixelTransferf", (void **)&glad_glPixelTransferf, (void *)glad_lazy_glPixelTransferf, 0 },
+    { "glPixelTransferi", (void **)&glad_glPixelTransferi, (void *)glad_lazy_glPixelTransferi, 0 },
+    { "glPixelZoom", (void **)&glad_glPixelZoom, (void *)glad_lazy_glPixelZoom, 0 },
+    { "glPointParameterf", (void **)&glad_glPointParameterf, (void *)glad_lazy_glPointParameterf, 0 },
+    { "glPointParameterfv", (void **)&glad_glPointParameterfv, (void *)glad_lazy_glPointParameterfv, 0 },
+    { "glPointParameteri", (void **)&glad_glPointParameteri, (void *)glad_lazy_glPointParameteri, 0 },
+    { "glPointParameteriv", (void **)&glad_glPointParameteriv, (void *)glad_lazy_glPointParameteriv, 0 },
+    { "glPointSize", (void **)&glad_glPointSize, (void *)glad_lazy_glPointSize, 0 },
+    { "glPolygonMode", (void **)&glad_glPolygonMode, (void *)glad_lazy_glPolygonMode, 0 },
+    { "glPolygonOffset", (void **)&glad_glPolygonOffset, (void *)glad_lazy_glPolygonOffset, 0 },
+    { "glPolygonOffsetClamp", (void **)&glad_glPolygonOffsetClamp, (void *)glad_lazy_glPolygonOffsetClamp, 0 },
+    { "glPolygonStipple", (void **)&glad_glPolygonStipple, (void *)glad_lazy_glPolygonStipple, 0 },
+    { "glPopAttrib", (void **)&glad_glPopAttrib, (void *)glad_lazy_glPopAttrib, 0 },
+    { "glPopClientAttrib", (void **)&glad_glPopClientAttrib, (void *)glad_lazy_glPopClientAttrib, 0 },
+    { "glPopDebugGroup", (void **)&glad_glPopDebugGroup, (void *)glad_lazy_glPopDebugGroup, 0 },
+    { "glPopMatrix", (void **)&glad_glPopMatrix, (void *)glad_lazy_glPopMatrix, 0 },
+    { "glPopName", (void **)&glad_glPopName, (void *)glad_lazy_glPopName, 0 },
+    { "glPrimitiveRestartIndex", (void **)&glad_glPrimitiveRestartIndex, (void *)glad_lazy_glPrimitiveRestartIndex, 0 },
+    { "glPrioritizeTextures", (void **)&glad_glPrioritizeTextures, (void *)glad_lazy_glPrioritizeTextures, 0 },
+    { "glProgramBinary", (void **)&glad_glProgramBinary, (void *)glad_lazy_glProgramBinary, 0 },
+    { "glProgramParameteri", (void **)&glad_glProgramParameteri, (void *)glad_lazy_glProgramParameteri, 0 },
+    { "glProgramUniform1d", (void **)&glad_glProgramUniform1d, (void *)glad_lazy_glProgramUniform1d, 0 },
+    { "glProgramUniform1dv", (void **)&glad_glProgramUniform1dv, (void *)glad_lazy_glProgramUniform1dv, 0 },
+    { "glProgramUniform1f", (void **)&glad_glProgramUniform1f, (void *)glad_lazy_glProgramUniform1f, 0 },
+    { "glProgramUniform1fv", (void **)&glad_glProgramUniform1fv, (void *)glad_lazy_glProgramUniform1fv, 0 },
+    { "glProgramUniform1i", (void **)&glad_glProgramUniform1i, (void *)glad_lazy_glProgramUniform1i, 0 },
+    { "glProgramUniform1iv", (void **)&glad_glProgramUniform1iv, (void *)glad_lazy_glProgramUniform1iv, 0 },
+    { "glProgramUniform1ui", (void **)&glad_glProgramUniform1ui, (void *)glad_lazy_glProgramUniform1ui, 0 },
+    { "glProgramUniform1uiv", (void **)&glad_glProgramUniform1uiv, (void *)glad_lazy_glProgramUniform1uiv, 0 },
+    { "glProgramUniform2d", (void **)&glad_glProgramUniform2d, (void *)glad_lazy_glProgramUniform2d, 0 },
+    { "glProgramUniform2dv", (void **)&glad_glProgramUniform2dv, (void *)glad_lazy_glProgramUniform2dv, 0 },
+    { "glProgramUniform2f", (void **)&glad_glProgramUniform2f, (void *)glad_lazy_glProgramUniform2f, 0 },
+    { "glProgramUniform2fv", (void **)&glad_glProgramUniform2fv, (void *)glad_lazy_glProgramUniform2fv, 0 },
+    { "glProgramUniform2i", (void **)&glad_glProgramUniform2i, (void *)glad_lazy_glProgramUniform2i, 0 },
+    { "glProgramUniform2iv", (void **)&glad_glProgramUniform2iv, (void *)glad_lazy_glProgramUniform2iv, 0 },
+    { "glProgramUniform2ui", (void **)&glad_glProgramUniform2ui, (void *)glad_lazy_glProgramUniform2ui, 0 },
+    { "glProgramUniform2uiv", (void **)&glad_glProgramUniform2uiv, (void *)glad_lazy_glProgramUniform2uiv, 0 },
+    { "glProgramUniform3d", (void **)&glad_glProgramUniform3d, (void *)glad_lazy_glProgramUniform3d, 0 },
+    { "glProgramUniform3dv", (void **)&glad_glProgramUniform3dv, (void *)glad_lazy_glProgramUniform3dv, 0 },
+    { "glProgramUniform3f", (void **)&glad_glProgramUniform3f, (void *)glad_lazy_glProgramUniform3f, 0 },
+    { "glProgramUniform3fv", (void **)&glad_glProgramUniform3fv, (void *)glad_lazy_glProgramUniform3fv, 0 },
+    { "glProgramUniform3i", (void **)&glad_glProgramUniform3i, (void *)glad_lazy_glProgramUniform3i, 0 },
+    { "glProgramUniform3iv", (void **)&glad_glProgramUniform3iv, (void *)glad_lazy_glProgramUniform3iv, 0 },
+    { "glProgramUniform3ui", (void **)&glad_glProgramUniform3ui, (void *)glad_lazy_glProgramUniform3ui, 0 },
+    { "glProgramUniform3uiv", (void **)&glad_glProgramUniform3uiv, (void *)glad_lazy_glProgramUniform3uiv, 0 },
+    { "glProgramUniform4d", (void **)&glad_glProgramUniform4d, (void *)glad_lazy_glProgramUniform4d, 0 },
+    { "glProgramUniform4dv", (void **)&glad_glProgramUniform4dv, (void *)glad_lazy_glProgramUniform4dv, 0 },
+    { "glProgramUniform4f", (void **)&glad_glProgramUniform4f, (void *)glad_lazy_glProgramUniform4f, 0 },
+    { "glProgramUniform4fv", (void **)&glad_glProgramUniform4fv, (void *)glad_lazy_glProgramUniform4fv, 0 },
+    { "glProgramUniform4i", (void **)&glad_glProgramUniform4i, (void *)glad_lazy_glProgramUniform4i, 0 },
+    { "glProgramUniform4iv", (void **)&glad_glProgramUniform4iv, (void *)glad_lazy_glProgramUniform4iv, 0 },
+    { "glProgramUniform4ui", (void **)&glad_glProgramUniform4ui, (void *)glad_lazy_glProgramUniform4ui, 0 },
+    { "glProgramUniform4uiv", (void **)&glad_glProgramUniform4uiv, (void *)glad_lazy_glProgramUniform4uiv, 0 },
+    { "glProgramUniformMatrix2dv", (void **)&glad_glProgramUniformMatrix2dv, (void *)glad_lazy_glProgramUniformMatrix2dv, 0 },
+    { "glProgramUniformMatrix2fv", (void **)&glad_glProgramUniformMatrix2fv, (void *)glad_lazy_glProgramUniformMatrix2fv, 0 },
+    { "glProgramUniformMatrix2x3dv", (void **)&glad_glProgramUniformMatrix2x3dv, (void *)glad_lazy_glProgramUniformMatrix2x3dv, 0 },
+    { "glProgramUniformMatrix2x3fv", (void **)&glad_glProgramUniformMatrix2x3fv, (void *)glad_lazy_glProgramUniformMatrix2x3fv, 0 },
+    { "glProgramUniformMatrix2x4dv", (void **)&glad_glProgramUniformMatrix2x4dv, (void *)glad_lazy_glProgramUniformMatrix2x4dv, 0 },
+    { "glProgramUniformMatrix2x4fv", (void **)&glad_glProgramUniformMatrix2x4fv, (void *)glad_lazy_glProgramUniformMatrix2x4fv, 0 },
+    { "glProgramUniformMatrix3dv", (void **)&glad_glProgramUniformMatrix3dv, (void *)glad_lazy_glProgramUniformMatrix3dv, 0 },
+    { "glProgramUniformMatrix3fv", (void **)&glad_glProgramUniformMatrix3fv, (void *)glad_lazy_glProgramUniformMatrix3fv, 0 },
+    { "glProgramUniformMatrix3x2dv", (void **)&glad_glProgramUniformMatrix3x2dv, (void *)glad_lazy_glProgramUniformMatrix3x2dv, 0 },
+    { "glProgramUniformMatrix3x2fv", (void **)&glad_glProgramUniformMatrix3x2fv, (void *)glad_lazy_glProgramUniformMatrix3x2fv, 0 },
+    { "glProgramUniformMatrix3x4dv", (void **)&glad_glProgramUniformMatrix3x4dv, (void *)glad_lazy_glProgramUniformMatrix3x4dv, 0 },
+    { "glProgramUniformMatrix3x4fv", (void **)&glad_glProgramUniformMatrix3x4fv, (void *)glad_lazy_glProgramUniformMatrix3x4fv, 0 },
+    { "glProgramUniformMatrix4dv", (void **)&glad_glProgramUniformMatrix4dv, (void *)glad_lazy_glProgramUniformMatrix4dv, 0 },
+    { "glProgramUniformMatrix4fv", (void **)&glad_glProgramUniformMatrix4fv, (void *)glad_lazy_glProgramUniformMatrix4fv, 0 },
+    { "glProgramUniformMatrix4x2dv", (void **)&glad_glProgramUniformMatrix4x2dv, (void *)glad_lazy_glProgramUniformMatrix4x2dv, 0 },
+    { "glProgramUniformMatrix4x2fv", (void **)&glad_glProgramUniformMatrix4x2fv, (void *)glad_lazy_glProgramUniformMatrix4x2fv, 0 },
+    { "glProgramUniformMatrix4x3dv", (void **)&glad_glProgramUniformMatrix4x3dv, (void *)glad_lazy_glProgramUniformMatrix4x3dv, 0 },
+    { "glProgramUniformMatrix4x3fv", (void **)&glad_glProgramUniformMatrix4x3fv, (void *)glad_lazy_glProgramUniformMatrix4x3fv, 0 },
+    { "glProvokingVertex", (void **)&glad_glProvokingVertex, (void *)glad_lazy_glProvokingVertex, 0 },
+    { "glPushAttrib", (void **)&glad_glPushAttrib, (void *)glad_lazy_glPushAttrib, 0 },
+    { "glPushClientAttrib", (void **)&glad_glPushClientAttrib, (void *)glad_lazy_glPushClientAttrib, 0 },
+    { "glPushDebugGroup", (void **)&glad_glPushDebugGroup, (void *)glad_lazy_glPushDebugGroup, 0 },
+    { "glPushMatrix", (void **)&glad_glPushMatrix, (void *)glad_lazy_glPushMatrix, 0 },
+    { "glPushName", (void **)&glad_glPushName, (void *)glad_lazy_glPushName, 0 },
+    { "glQueryCounter", (void **)&glad_glQueryCounter, (void *)glad_lazy_glQueryCounter, 0 },
+    { "glRasterPos2d", (void **)&glad_glRasterPos2d, (void *)glad_lazy_glRasterPos2d, 0 },
+    { "glRasterPos2dv", (void **)&glad_glRasterPos2dv, (void *)glad_lazy_glRasterPos2dv, 0 },
+    { "glRasterPos2f", (void **)&glad_glRasterPos2f, (void *)glad_lazy_glRasterPos2f, 0 },
+    { "glRasterPos2fv", (void **)&glad_glRasterPos2fv, (void *)glad_lazy_glRasterPos2fv, 0 },
+    { "glRasterPos2i", (void **)&glad_glRasterPos2i, (void *)glad_lazy_glRasterPos2i, 0 },
+    { "glRasterPos2iv", (void **)&glad_glRasterPos2iv, (void *)glad_lazy_glRasterPos2iv, 0 },
+    { "glRasterPos2s", (void **)&glad_glRasterPos2s, (void *)glad_lazy_glRasterPos2s, 0 },
+    { "glRasterPos2sv", (void **)&glad_glRasterPos2sv, (void *)glad_lazy_glRasterPos2sv, 0 },
+    { "glRasterPos3d", (void **)&glad_glRasterPos3d, (void *)glad_lazy_glRasterPos3d, 0 },
+    { "glRasterPos3dv", (void **)&glad_glRasterPos3dv, (void *)glad_lazy_glRasterPos3dv, 0 },
+    { "glRasterPos3f", (void **)&glad_glRasterPos3f, (void *)glad_lazy_glRasterPos3f, 0 },
+    { "glRasterPos3fv", (void **)&glad_glRasterPos3fv, (void *)glad_lazy_glRasterPos3fv, 0 },
+    { "glRasterPos3i", (void **)&glad_glRasterPos3i, (void *)glad_lazy_glRasterPos3i, 0 },
+    { "glRasterPos3iv", (void **)&glad_glRasterPos3iv, (void *)glad_lazy_glRasterPos3iv, 0 },
+    { "glRasterPos3s", (void **)&glad_glRasterPos3s, (void *)glad_lazy_glRasterPos3s, 0 },
+    { "glRasterPos3sv", (void **)&glad_glRasterPos3sv, (void *)glad_lazy_glRasterPos3sv, 0 },
+    { "glRasterPos4d", (void **)&glad_glRasterPos4d, (void *)glad_lazy_glRasterPos4d, 0 },
+    { "glRasterPos4dv", (void **)&glad_glRasterPos4dv, (void *)glad_lazy_glRasterPos4dv, 0 },
+    { "glRasterPos4f", (void **)&glad_glRasterPos4f, (void *)glad_lazy_glRasterPos4f, 0 },
+    { "glRasterPos4fv", (void **)&glad_glRasterPos4fv, (void *)glad_lazy_glRasterPos4fv, 0 },
+    { "glRasterPos4i", (void **)&glad_glRasterPos4i, (void *)glad_lazy_glRasterPos4i, 0 },
+    { "glRasterPos4iv", (void **)&glad_glRasterPos4iv, (void *)glad_lazy_glRasterPos4iv, 0 },
+    { "glRasterPos4s", (void **)&glad_glRasterPos4s, (void *)glad_lazy_glRasterPos4s, 0 },
+    { "glRasterPos4sv", (void **)&glad_glRasterPos4sv, (void *)glad_lazy_glRasterPos4sv, 0 },
+    { "glReadBuffer", (void **)&glad_glReadBuffer, (void *)glad_lazy_glReadBuffer, 0 },
+    { "glReadPixels", (void **)&glad_glReadPixels, (void *)glad_lazy_glReadPixels, 0 },
+    { "glReadnPixels", (void **)&glad_glReadnPixels, (void *)glad_lazy_glReadnPixels, 0 },
+    { "glRectd", (void **)&glad_glRectd, (void *)glad_lazy_glRectd, 0 },
+    { "glRectdv", (void **)&glad_glRectdv, (void *)glad_lazy_glRectdv, 0 },
+    { "glRectf", (void **)&glad_glRectf, (void *)glad_lazy_glRectf, 0 },
+    { "glRectfv", (void **)&glad_glRectfv, (void *)glad_lazy_glRectfv, 0 },
+    { "glRecti", (void **)&glad_glRecti, (void *)glad_lazy_glRecti, 0 },
+    { "glRectiv", (void **)&glad_glRectiv, (void *)glad_lazy_glRectiv, 0 },
+    { "glRects", (void **)&glad_glRects, (void *)glad_lazy_glRects, 0 },
+    { "glRectsv", (void **)&glad_glRectsv, (void *)glad_lazy_glRectsv, 0 },
+    { "glReleaseShaderCompiler", (void **)&glad_glReleaseShaderCompiler, (void *)glad_lazy_glReleaseShaderCompiler, 0 },
+    { "glRenderMode", (void **)&glad_glRenderMode, (void *)glad_lazy_glRenderMode, 0 },
+    { "glRenderbufferStorage", (void **)&glad_glRenderbufferStorage, (void *)glad_lazy_glRenderbufferStorage, 0 },
+    { "glRenderbufferStorageMultisample", (void **)&glad_glRenderbufferStorageMultisample, (void *)glad_lazy_glRenderbufferStorageMultisample, 0 },
+    { "glResumeTransformFeedback", (void **)&glad_glResumeTransformFeedback, (void *)glad_lazy_glResumeTransformFeedback, 0 },
+    { "glRotated", (void **)&glad_glRotated, (void *)glad_lazy_glRotated, 0 },
+    { "glRotatef", (void **)&glad_glRotatef, (void *)glad_lazy_glRotatef, 0 },
+    { "glSampleCoverage", (void **)&glad_glSampleCoverage, (void *)glad_lazy_glSampleCoverage, 0 },
+    { "glSampleMaski", (void **)&glad_glSampleMaski, (void *)glad_lazy_glSampleMaski, 0 },
+    { "glSamplerParameterIiv", (void **)&glad_glSamplerParameterIiv, (void *)glad_lazy_glSamplerParameterIiv, 0 },
+    { "glSamplerParameterIuiv", (void **)&glad_glSamplerParameterIuiv, (void *)glad_lazy_glSamplerParameterIuiv, 0 },
+    { "glSamplerParameterf", (void **)&glad_glSamplerParameterf, (void *)glad_lazy_glSamplerParameterf, 0 },
+    { "glSamplerParameterfv", (void **)&glad_glSamplerParameterfv, (void *)glad_lazy_glSamplerParameterfv, 0 },
+    { "glSamplerParameteri", (void **)&glad_glSamplerParameteri, (void *)glad_lazy_glSamplerParameteri, 0 },
+    { "glSamplerParameteriv", (void **)&glad_glSamplerParameteriv, (void *)glad_lazy_glSamplerParameteriv, 0 },
+    { "glScaled", (void **)&glad_glScaled, (void *)glad_lazy_glScaled, 0 },
+    { "glScalef", (void **)&glad_glScalef, (void *)glad_lazy_glScalef, 0 },
+    { "glScissor", (void **)&glad_glScissor, (void *)glad_lazy_glScissor, 0 },
+    { "glScissorArrayv", (void **)&glad_glScissorArrayv, (void *)glad_lazy_glScissorArrayv, 0 },
+    { "glScissorIndexed", (void **)&glad_glScissorIndexed, (void *)glad_lazy_glScissorIndexed, 0 },
+    { "glScissorIndexedv", (void **)&glad_glScissorIndexedv, (void *)glad_lazy_glScissorIndexedv, 0 },
+    { "glSecondaryColor3b", (void **)&glad_glSecondaryColor3b, (void *)glad_lazy_glSecondaryColor3b, 0 },
+    { "glSecondaryColor3bv", (void **)&glad_glSecondaryColor3bv, (void *)glad_lazy_glSecondaryColor3bv, 0 },
+    { "glSecondaryColor3d", (void **)&glad_glSecondaryColor3d, (void *)glad_lazy_glSecondaryColor3d, 0 },
+    { "glSecondaryColor3dv", (void **)&glad_glSecondaryColor3dv, (void *)glad_lazy_glSecondaryColor3dv, 0 },
+    { "glSecondaryColor3f", (void **)&glad_glSecondaryColor3f, (void *)glad_lazy_glSecondaryColor3f, 0 },
+    { "glSecondaryColor3fv", (void **)&glad_glSecondaryColor3fv, (void *)glad_lazy_glSecondaryColor3fv, 0 },
+    { "glSecondaryColor3i", (void **)&glad_glSecondaryColor3i, (void *)glad_lazy_glSecondaryColor3i, 0 },
+    { "glSecondaryColor3iv", (void **)&glad_glSecondaryColor3iv, (void *)glad_lazy_glSecondaryColor3iv, 0 },
+    { "glSecondaryColor3s", (void **)&glad_glSecondaryColor3s, (void *)glad_lazy_glSecondaryColor3s, 0 },
+    { "glSecondaryColor3sv", (void **)&glad_glSecondaryColor3sv, (void *)glad_lazy_glSecondaryColor3sv, 0 },
+    { "glSecondaryColor3ub", (void **)&glad_glSecondaryColor3ub, (void *)glad_lazy_glSecondaryColor3ub, 0 },
+    { "glSecondaryColor3ubv", (void **)&glad_glSecondaryColor3ubv, (void *)glad_lazy_glSecondaryColor3ubv, 0 },
+    { "glSecondaryColor3ui", (void **)&glad_glSecondaryColor3ui, (void *)glad_lazy_glSecondaryColor3ui, 0 },
+    { "glSecondaryColor3uiv", (void **)&glad_glSecondaryColor3uiv, (void *)glad_lazy_glSecondaryColor3uiv, 0 },
+    { "glSecondaryColor3us", (void **)&glad_glSecondaryColor3us, (void *)glad_lazy_glSecondaryColor3us, 0 },
+    { "glSecondaryColor3usv", (void **)&glad_glSecondaryColor3usv, (void *)glad_lazy_glSecondaryColor3usv, 0 },
+    { "glSecondaryColorP3ui", (void **)&glad_glSecondaryColorP3ui, (void *)glad_lazy_glSecondaryColorP3ui, 0 },
+    { "glSecondaryColorP3uiv", (void **)&glad_glSecondaryColorP3uiv, (void *)glad_lazy_glSecondaryColorP3uiv, 0 },
+    { "glSecondaryColorPointer", (void **)&glad_glSecondaryColorPointer, (void *)glad_lazy_glSecondaryColorPointer, 0 },
+    { "glSelectBuffer", (void **)&glad_glSelectBuffer, (void *)glad_lazy_glSelectBuffer, 0 },
+    { "glShadeModel", (void **)&glad_glShadeModel, (void *)glad_lazy_glShadeModel, 0 },
+    { "glShaderBinary", (void **)&glad_glShaderBinary, (void *)glad_lazy_glShaderBinary, 0 },
+    { "glShaderSource", (void **)&glad_glShaderSource, (void *)glad_lazy_glShaderSource, 0 },
+    { "glShaderStorageBlockBinding", (void **)&glad_glShaderStorageBlockBinding, (void *)glad_lazy_glShaderStorageBlockBinding, 0 },
+    { "glSpecializeShader", (void **)&glad_glSpecializeShader, (void *)glad_lazy_glSpecializeShader, 0 },
+    { "glStencilFunc", (void **)&glad_glStencilFunc, (void *)glad_lazy_glStencilFunc, 0 },
+    { "glStencilFuncSeparate", (void **)&glad_glStencilFuncSeparate, (void *)glad_lazy_glStencilFuncSeparate, 0 },
+    { "glStencilMask", (void **)&glad_glStencilMask, (void *)glad_lazy_glStencilMask, 0 },
+    { "glStencilMaskSeparate", (void **)&glad_glStencilMaskSeparate, (void *)glad_lazy_glStencilMaskSeparate, 0 },
+    { "glStencilOp", (void **)&glad_glStencilOp, (void *)glad_lazy_glStencilOp, 0 },
+    { "glStencilOpSeparate", (void **)&glad_glStencilOpSeparate, (void *)glad_lazy_glStencilOpSeparate, 0 },
+    { "glTexBuffer", (void **)&glad_glTexBuffer, (void *)glad_lazy_glTexBuffer, 0 },
+    { "glTexBufferRange", (void **)&glad_glTexBufferRange, (void *)glad_lazy_glTexBufferRange, 0 },
+    { "glTexCoord1d", (void **)&glad_glTexCoord1d, (void *)glad_lazy_glTexCoord1d, 0 },
+    { "glTexCoord1dv", (void **)&glad_glTexCoord1dv, (void *)glad_lazy_glTexCoord1dv, 0 },
+    { "glTexCoord1f", (void **)&glad_glTexCoord1f, (void *)glad_lazy_glTexCoord1f, 0 },
+    { "glTexCoord1fv", (void **)&glad_glTexCoord1fv, (void *)glad_lazy_glTexCoord1fv, 0 },
+    { "glTexCoord1i", (void **)&glad_glTexCoord1i, (void *)glad_lazy_glTexCoord1i, 0 },
+    { "glTexCoord1iv", (void **)&glad_glTexCoord1iv, (void *)glad_lazy_glTexCoord1iv, 0 },
+    { "glTexCoord1s", (void **)&glad_glTexCoord1s, (void *)glad_lazy_glTexCoord1s, 0 },
+    { "glTexCoord1sv", (void **)&glad_glTexCoord1sv, (void *)glad_lazy_glTexCoord1sv, 0 },
+    { "glTexCoord2d", (void **)&glad_glTexCoord2d, (void *)glad_lazy_glTexCoord2d, 0 },
+    { "glTexCoord2dv", (void **)&glad_glTexCoord2dv, (void *)glad_lazy_glTexCoord2dv, 0 },
+    { "glTexCoord2f", (void **)&glad_glTexCoord2f, (void *)glad_lazy_glTexCoord2f, 0 },
+    { "glTexCoord2fv", (void **)&glad_glTexCoord2fv, (void *)glad_lazy_glTexCoord2fv, 0 },
+    { "glTexCoord2i", (void **)&glad_glTexCoord2i, (void *)glad_lazy_glTexCoord2i, 0 },
+    { "glTexCoord2iv", (void **)&glad_glTexCoord2iv, (void *)glad_lazy_glTexCoord2iv, 0 },
+    { "glTexCoord2s", (void **)&glad_glTexCoord2s, (void *)glad_lazy_glTexCoord2s, 0 },
+    { "glTexCoord2sv", (void **)&glad_glTexCoord2sv, (void *)glad_lazy_glTexCoord2sv, 0 },
+    { "glTexCoord3d", (void **)&glad_glTexCoord3d, (void *)glad_lazy_glTexCoord3d, 0 },
+    { "glTexCoord3dv", (void **)&glad_glTexCoord3dv, (void *)glad_lazy_glTexCoord3dv, 0 },
+    { "glTexCoord3f", (void **)&glad_glTexCoord3f, (void *)glad_lazy_glTexCoord3f, 0 },
+    { "glTexCoord3fv", (void **)&glad_glTexCoord3fv, (void *)glad_lazy_glTexCoord3fv, 0 },
+    { "glTexCoord3i", (void **)&glad_glTexCoord3i, (void *)glad_lazy_glTexCoord3i, 0 },
+    { "glTexCoord3iv", (void **)&glad_glTexCoord3iv, (void *)glad_lazy_glTexCoord3iv, 0 },
+    { "glTexCoord3s", (void **)&glad_glTexCoord3s, (void *)glad_lazy_glTexCoord3s, 0 },
+    { "glTexCoord3sv", (void **)&glad_glTexCoord3sv, (void *)glad_lazy_glTexCoord3sv, 0 },
+    { "glTexCoord4d", (void **)&glad_glTexCoord4d, (void *)glad_lazy_glTexCoord4d, 0 },
+    { "glTexCoord4dv", (void **)&glad_glTexCoord4dv, (void *)glad_lazy_glTexCoord4dv, 0 },
+    { "glTexCoord4f", (void **)&glad_glTexCoord4f, (void *)glad_lazy_glTexCoord4f, 0 },
+    { "glTexCoord4fv", (void **)&glad_glTexCoord4fv, (void *)glad_lazy_glTexCoord4fv, 0 },
+    { "glTexCoord4i", (void **)&glad_glTexCoord4i, (void *)glad_lazy_glTexCoord4i, 0 },
+    { "glTexCoord4iv", (void **)&glad_glTexCoord4iv, (void *)glad_lazy_glTexCoord4iv, 0 },
+    { "glTexCoord4s", (void **)&glad_glTexCoord4s, (void *)glad_lazy_glTexCoord4s, 0 },
+    { "glTexCoord4sv", (void **)&glad_glTexCoord4sv, (void *)glad_lazy_glTexCoord4sv, 0 },
+    { "glTexCoordP1ui", (void **)&glad_glTexCoordP1ui, (void *)glad_lazy_glTexCoordP1ui, 0 },
+    { "glTexCoordP1uiv", (void **)&glad_glTexCoordP1uiv, (void *)glad_lazy_glTexCoordP1uiv, 0 },
+    { "glTexCoordP2ui", (void **)&glad_glTexCoordP2ui, (void *)glad_lazy_glTexCoordP2ui, 0 },
+    { "glTexCoordP2uiv", (void **)&glad_glTexCoordP2uiv, (void *)glad_lazy_glTexCoordP2uiv, 0 },
+    { "glTexCoordP3ui", (void **)&glad_glTexCoordP3ui, (void *)glad_lazy_glTexCoordP3ui, 0 },
+    { "glTexCoordP3uiv", (void **)&glad_glTexCoordP3uiv, (void *)glad_lazy_glTexCoordP3uiv, 0 },
+    { "glTexCoordP4ui", (void **)&glad_glTexCoordP4ui, (void *)glad_lazy_glTexCoordP4ui, 0 },
+    { "glTexCoordP4uiv", (void **)&glad_glTexCoordP4uiv, (void *)glad_lazy_glTexCoordP4uiv, 0 },
+    { "glTexCoordPointer", (void **)&glad_glTexCoordPointer, (void *)glad_lazy_glTexCoordPointer, 0 },
+    { "glTexEnvf", (void **)&glad_glTexEnvf, (void *)glad_lazy_glTexEnvf, 0 },
+    { "glTexEnvfv", (void **)&glad_glTexEnvfv, (void *)glad_lazy_glTexEnvfv, 0 },
+    { "glTexEnvi", (void **)&glad_glTexEnvi, (void *)glad_lazy_glTexEnvi, 0 },
+    { "glTexEnviv", (void **)&glad_glTexEnviv, (void *)glad_lazy_glTexEnviv, 0 },
+    { "glTexGend", (void **)&glad_glTexGend, (void *)glad_lazy_glTexGend, 0 },
+    { "glTexGendv", (void **)&glad_glTexGendv, (void *)glad_lazy_glTexGendv, 0 },
+    { "glTexGenf", (void **)&glad_glTexGenf, (void *)glad_lazy_glTexGenf, 0 },
+    { "glTexGenfv", (void **)&glad_glTexGenfv, (void *)glad_lazy_glTexGenfv, 0 },
+    { "glTexGeni", (void **)&glad_glTexGeni, (void *)glad_lazy_glTexGeni, 0 },
+    { "glTexGeniv", (void **)&glad_glTexGeniv, (void *)glad_lazy_glTexGeniv, 0 },
+    { "glTexImage1D", (void **)&glad_glTexImage1D, (void *)glad_lazy_glTexImage1D, 0 },
+    { "glTexImage2D", (void **)&glad_glTexImage2D, (void *)glad_lazy_glTexImage2D, 0 },
+    { "glTexImage2DMultisample", (void **)&glad_glTexImage2DMultisample, (void *)glad_lazy_glTexImage2DMultisample, 0 },
+    { "glTexImage3D", (void **)&glad_glTexImage3D, (void *)glad_lazy_glTexImage3D, 0 },
+    { "glTexImage3DMultisample", (void **)&glad_glTexImage3DMultisample, (void *)glad_lazy_glTexImage3DMultisample, 0 },
+    { "glTexParameterIiv", (void **)&glad_glTexParameterIiv, (void *)glad_lazy_glTexParameterIiv, 0 },
+    { "glTexParameterIuiv", (void **)&glad_glTexParameterIuiv, (void *)glad_lazy_glTexParameterIuiv, 0 },
+    { "glTexParameterf", (void **)&glad_glTexParameterf, (void *)glad_lazy_glTexParameterf, 0 },
+    { "glTexParameterfv", (void **)&glad_glTexParameterfv, (void *)glad_lazy_glTexParameterfv, 0 },
+    { "glTexParameteri", (void **)&glad_glTexParameteri, (void *)glad_lazy_glTexParameteri, 0 },
+    { "glTexParameteriv", (void **)&glad_glTexParameteriv, (void *)glad_lazy_glTexParameteriv, 0 },
+    { "glTexStorage1D", (void **)&glad_glTexStorage1D, (void *)glad_lazy_glTexStorage1D, 0 },
+    { "glTexStorage2D", (void **)&glad_glTexStorage2D, (void *)glad_lazy_glTexStorage2D, 0 },
+    { "glTexStorage2DMultisample", (void **)&glad_glTexStorage2DMultisample, (void *)glad_lazy_glTexStorage2DMultisample, 0 },
+    { "glTexStorage3D", (void **)&glad_glTexStorage3D, (void *)glad_lazy_glTexStorage3D, 0 },
+    { "glTexStorage3DMultisample", (void **)&glad_glTexStorage3DMultisample, (void *)glad_lazy_glTexStorage3DMultisample, 0 },
+    { "glTexSubImage1D", (void **)&glad_glTexSubImage1D, (void *)glad_lazy_glTexSubImage1D, 0 },
+    { "glTexSubImage2D", (void **)&glad_glTexSubImage2D, (void *)glad_lazy_glTexSubImage2D, 0 },
+    { "glTexSubImage3D", (void **)&glad_glTexSubImage3D, (void *)glad_lazy_glTexSubImage3D, 0 },
+    { "glTextureBarrier", (void **)&glad_glTextureBarrier, (void *)glad_lazy_glTextureBarrier, 0 },
+    { "glTextureBuffer", (void **)&glad_glTextureBuffer, (void *)glad_lazy_glTextureBuffer, 0 },
+    { "glTextureBufferRange", (void **)&glad_glTextureBufferRange, (void *)glad_lazy_glTextureBufferRange, 0 },
+    { "glTextureParameterIiv", (void **)&glad_glTextureParameterIiv, (void *)glad_lazy_glTextureParameterIiv, 0 },
+    { "glTextureParameterIuiv", (void **)&glad_glTextureParameterIuiv, (void *)glad_lazy_glTextureParameterIuiv, 0 },
+    { "glTextureParameterf", (void **)&glad_glTextureParameterf, (void *)glad_lazy_glTextureParameterf, 0 },
+    { "glTextureParameterfv", (void **)&glad_glTextureParameterfv, (void *)glad_lazy_glTextureParameterfv, 0 },
+    { "glTextureParameteri", (void **)&glad_glTextureParameteri, (void *)glad_lazy_glTextureParameteri, 0 },
+    { "glTextureParameteriv", (void **)&glad_glTextureParameteriv, (void *)glad_lazy_glTextureParameteriv, 0 },
+    { "glTextureStorage1D", (void **)&glad_glTextureStorage1D, (void *)glad_lazy_glTextureStorage1D, 0 },
+    { "glTextureStorage2D", (void **)&glad_glTextureStorage2D, (void *)glad_lazy_glTextureStorage2D, 0 },
+    { "glTextureStorage2DMultisample", (void **)&glad_glTextureStorage2DMultisample, (void *)glad_lazy_glTextureStorage2DMultisample, 0 },
+    { "glTextureStorage3D", (void **)&glad_glTextureStorage3D, (void *)glad_lazy_glTextureStorage3D, 0 },
+    { "glTextureStorage3DMultisample", (void **)&glad_glTextureStorage3DMultisample, (void *)glad_lazy_glTextureStorage3DMultisample, 0 },
+    { "glTextureSubImage1D", (void **)&glad_glTextureSubImage1D, (void *)glad_lazy_glTextureSubImage1D, 0 },
+    { "glTextureSubImage2D", (void **)&glad_glTextureSubImage2D, (void *)glad_lazy_glTextureSubImage2D, 0 },
+    { "glTextureSubImage3D", (void **)&glad_glTextureSubImage3D, (void *)glad_lazy_glTextureSubImage3D, 0 },
+    { "glTextureView", (void **)&glad_glTextureView, (void *)glad_lazy_glTextureView, 0 },
+    { "glTransformFeedbackBufferBase", (void **)&glad_glTransformFeedbackBufferBase, (void *)glad_lazy_glTransformFeedbackBufferBase, 0 },
+    { "glTransformFeedbackBufferRange", (void **)&glad_glTransformFeedbackBufferRange, (void *)glad_lazy_glTransformFeedbackBufferRange, 0 },
+    { "glTransformFeedbackVaryings", (void **)&glad_glTransformFeedbackVaryings, (void *)glad_lazy_glTransformFeedbackVaryings, 0 },
+    { "glTranslated", (void **)&glad_glTranslated, (void *)glad_lazy_glTranslated, 0 },
+    { "glTranslatef", (void **)&glad_glTranslatef, (void *)glad_lazy_glTranslatef, 0 },
+    { "glUniform1d", (void **)&glad_glUniform1d, (void *)glad_lazy_glUniform1d, 0 },
+    { "glUniform1dv", (void **)&glad_glUniform1dv, (void *)glad_lazy_glUniform1dv, 0 },
+    { "glUniform1f", (void **)&glad_glUniform1f, (void *)glad_lazy_glUniform1f, 0 },
+    { "glUniform1fv", (void **)&glad_glUniform1fv, (void *)glad_lazy_glUniform1fv, 0 },
+    { "glUniform1i", (void **)&glad_glUniform1i, (void *)glad_lazy_glUniform1i, 0 },
+    { "glUniform1iv", (void **)&glad_glUniform1iv, (void *)glad_lazy_glUniform1iv, 0 },
+    { "glUniform1ui", (void **)&glad_glUniform1ui, (void *)glad_lazy_glUniform1ui, 0 },
+    { "glUniform1uiv", (void **)&glad_glUniform1uiv, (void *)glad_lazy_glUniform1uiv, 0 },
+    { "glUniform2d", (void **)&glad_glUniform2d, (void *)glad_lazy_glUniform2d, 0 },
+    { "glUniform2dv", (void **)&glad_glUniform2dv, (void *)glad_lazy_glUniform2dv, 0 },
+    { "glUniform2f", (void **)&glad_glUniform2f, (void *)glad_lazy_glUniform2f, 0 },
+    { "glUniform2fv", (void **)&glad_glUniform2fv, (void *)glad_lazy_glUniform2fv, 0 },
+    { "glUniform2i", (void **)&glad_glUniform2i, (void *)glad_lazy_glUniform2i, 0 },
+    { "glUniform2iv", (void **)&glad_glUniform2iv, (void *)glad_lazy_glUniform2iv, 0 },
+    { "glUniform2ui", (void **)&glad_glUniform2ui, (void *)glad_lazy_glUniform2ui, 0 },
+    { "glUniform2uiv", (void **)&glad_glUniform2uiv, (void *)glad_lazy_glUniform2uiv, 0 },
+    { "glUniform3d", (void **)&glad_glUniform3d, (void *)glad_lazy_glUniform3d, 0 },
+    { "glUniform3dv", (void **)&glad_glUniform3dv, (void *)glad_lazy_glUniform3dv, 0 },
+    { "glUniform3f", (void **)&glad_glUniform3f, (void *)glad_lazy_glUniform3f, 0 },
+    { "glUniform3fv", (void **)&glad_glUniform3fv, (void *)glad_lazy_glUniform3fv, 0 },
+    { "glUniform3i", (void **)&glad_glUniform3i, (void *)glad_lazy_glUniform3i, 0 },
+    { "glUniform3iv", (void **)&glad_glUniform3iv, (void *)glad_lazy_glUniform3iv, 0 },
+    { "glUniform3ui", (void **)&glad_glUniform3ui, (void *)glad_lazy_glUniform3ui, 0 },
+    { "glUniform3uiv", (void **)&glad_glUniform3uiv, (void *)glad_lazy_glUniform3uiv, 0 },
+    { "glUniform4d", (void **)&glad_glUniform4d, (void *)glad_lazy_glUniform4d, 0 },
+    { "glUniform4dv", (void **)&glad_glUniform4dv, (void *)glad_lazy_glUniform4dv, 0 },
+    { "glUniform4f", (void **)&glad_glUniform4f, (void *)glad_lazy_glUniform4f, 0 },
+    { "glUniform4fv", (void **)&glad_glUniform4fv, (void *)glad_lazy_glUniform4fv, 0 },
+    { "glUniform4i", (void **)&glad_glUniform4i, (void *)glad_lazy_glUniform4i, 0 },
+    { "glUniform4iv", (void **)&glad_glUniform4iv, (void *)glad_lazy_glUniform4iv, 0 },
+    { "glUniform4ui", (void **)&glad_glUniform4ui, (void *)glad_lazy_glUniform4ui, 0 },
+    { "glUniform4uiv", (void **)&glad_glUniform4uiv, (void *)glad_lazy_glUniform4uiv, 0 },
+    { "glUniformBlockBinding", (void **)&glad_glUniformBlockBinding, (void *)glad_lazy_glUniformBlockBinding, 0 },
+    { "glUniformMatrix2dv", (void **)&glad_glUniformMatrix2dv, (void *)glad_lazy_glUniformMatrix2dv, 0 },
+    { "glUniformMatrix2fv", (void **)&glad_glUniformMatrix2fv, (void *)glad_lazy_glUniformMatrix2fv, 0 },
+    { "glUniformMatrix2x3dv", (void **)&glad_glUniformMatrix2x3dv, (void *)glad_lazy_glUniformMatrix2x3dv, 0 },
+    { "glUniformMatrix2x3fv", (void **)&glad_glUniformMatrix2x3fv, (void *)glad_lazy_glUniformMatrix2x3fv, 0 },
+    { "glUniformMatrix2x4dv", (void **)&glad_glUniformMatrix2x4dv, (void *)glad_lazy_glUniformMatrix2x4dv, 0 },
+    { "glUniformMatrix2x4fv", (void **)&glad_glUniformMatrix2x4fv, (void *)glad_lazy_glUniformMatrix2x4fv, 0 },
+    { "glUniformMatrix3dv", (void **)&glad_glUniformMatrix3dv, (void *)glad_lazy_glUniformMatrix3dv, 0 },
+    { "glUniformMatrix3fv", (void **)&glad_glUniformMatrix3fv, (void *)glad_lazy_glUniformMatrix3fv, 0 },
+    { "glUniformMatrix3x2dv", (void **)&glad_glUniformMatrix3x2dv, (void *)glad_lazy_glUniformMatrix3x2dv, 0 },
+    { "glUniformMatrix3x2fv", (void **)&glad_glUniformMatrix3x2fv, (void *)glad_lazy_glUniformMatrix3x2fv, 0 },
+    { "glUniformMatrix3x4dv", (void **)&glad_glUniformMatrix3x4dv, (void *)glad_lazy_glUniformMatrix3x4dv, 0 },
+    { "glUniformMatrix3x4fv", (void **)&glad_glUniformMatrix3x4fv, (void *)glad_lazy_glUniformMatrix3x4fv, 0 },
+    { "glUniformMatrix4dv", (void **)&glad_glUniformMatrix4dv, (void *)glad_lazy_glUniformMatrix4dv, 0 },
+    { "glUniformMatrix4fv", (void **)&glad_glUniformMatrix4fv, (void *)glad_lazy_glUniformMatrix4fv, 0 },
+    { "glUniformMatrix4x2dv", (void **)&glad_glUniformMatrix4x2dv, (void *)glad_lazy_glUniformMatrix4x2dv, 0 },
+    { "glUniformMatrix4x2fv", (void **)&glad_glUniformMatrix4x2fv, (void *)glad_lazy_glUniformMatrix4x2fv, 0 },
+    { "glUniformMatrix4x3dv", (void **)&glad_glUniformMatrix4x3dv, (void *)glad_lazy_glUniformMatrix4x3dv, 0 },
+    { "glUniformMatrix4x3fv", (void **)&glad_glUniformMatrix4x3fv, (void *)glad_lazy_glUniformMatrix4x3fv, 0 },
+    { "glUniformSubroutinesuiv", (void **)&glad_glUniformSubroutinesuiv, (void *)glad_lazy_glUniformSubroutinesuiv, 0 },
+    { "glUnmapBuffer", (void **)&glad_glUnmapBuffer, (void *)glad_lazy_glUnmapBuffer, 0 },
+    { "glUnmapNamedBuffer", (void **)&glad_glUnmapNamedBuffer, (void *)glad_lazy_glUnmapNamedBuffer, 0 },
+    { "glUseProgram", (void **)&glad_glUseProgram, (void *)glad_lazy_glUseProgram, 0 },
+    { "glUseProgramStages", (void **)&glad_glUseProgramStages, (void *)glad_lazy_glUseProgramStages, 0 },
+    { "glValidateProgram", (void **)&glad_glValidateProgram, (void *)glad_lazy_glValidateProgram, 0 },
+    { "glValidateProgramPipeline", (void **)&glad_glValidateProgramPipeline, (void *)glad_lazy_glValidateProgramPipeline, 0 },
+    { "glVertex2d", (void **)&glad_glVertex2d, (void *)glad_lazy_glVertex2d, 0 },
+    { "glVertex2dv", (void **)&glad_glVertex2dv, (void *)glad_lazy_glVertex2dv, 0 },
+    { "glVertex2f", (void **)&glad_glVertex2f, (void *)glad_lazy_glVertex2f, 0 },
+    { "glVertex2fv", (void **)&glad_glVertex2fv, (void *)glad_lazy_glVertex2fv, 0 },
+    { "glVertex2i", (void **)&glad_glVertex2i, (void *)glad_lazy_glVertex2i, 0 },
+    { "glVertex2iv", (void **)&glad_glVertex2iv, (void *)glad_lazy_glVertex2iv, 0 },
+    { "glVertex2s", (void **)&glad_glVertex2s, (void *)glad_lazy_glVertex2s, 0 },
+    { "glVertex2sv", (void **)&glad_glVertex2sv, (void *)glad_lazy_glVertex2sv, 0 },
+    { "glVertex3d", (void **)&glad_glVertex3d, (void *)glad_lazy_glVertex3d, 0 },
+    { "glVertex3dv", (void **)&glad_glVertex3dv, (void *)glad_lazy_glVertex3dv, 0 },
+    { "glVertex3f", (void **)&glad_glVertex3f, (void *)glad_lazy_glVertex3f, 0 },
+    { "glVertex3fv", (void **)&glad_glVertex3fv, (void *)glad_lazy_glVertex3fv, 0 },
+    { "glVertex3i", (void **)&glad_glVertex3i, (void *)glad_lazy_glVertex3i, 0 },
+    { "glVertex3iv", (void **)&glad_glVertex3iv, (void *)glad_lazy_glVertex3iv, 0 },
+    { "glVertex3s", (void **)&glad_glVertex3s, (void *)glad_lazy_glVertex3s, 0 },
+    { "glVertex3sv", (void **)&glad_glVertex3sv, (void *)glad_lazy_glVertex3sv, 0 },
+    { "glVertex4d", (void **)&glad_glVertex4d, (void *)glad_lazy_glVertex4d, 0 },
+    { "glVertex4dv", (void **)&glad_glVertex4dv, (void *)glad_lazy_glVertex4dv, 0 },
+    { "glVertex4f", (void **)&glad_glVertex4f, (void *)glad_lazy_glVertex4f, 0 },
+    { "glVertex4fv", (void **)&glad_glVertex4fv, (void *)glad_lazy_glVertex4fv, 0 },
+    { "glVertex4i", (void **)&glad_glVertex4i, (void *)glad_lazy_glVertex4i, 0 },
+    { "glVertex4iv", (void **)&glad_glVertex4iv, (void *)glad_lazy_glVertex4iv, 0 },
+    { "glVertex4s", (void **)&glad_glVertex4s, (void *)glad_lazy_glVertex4s, 0 },
+    { "glVertex4sv", (void **)&glad_glVertex4sv, (void *)glad_lazy_glVertex4sv, 0 },
+    { "glVertexArrayAttribBinding", (void **)&glad_glVertexArrayAttribBinding, (void *)glad_lazy_glVertexArrayAttribBinding, 0 },
+    { "glVertexArrayAttribFormat", (void **)&glad_glVertexArrayAttribFormat, (void *)glad_lazy_glVertexArrayAttribFormat, 0 },
+    { "glVertexArrayAttribIFormat", (void **)&glad_glVertexArrayAttribIFormat, (void *)glad_lazy_glVertexArrayAttribIFormat, 0 },
+    { "glVertexArrayAttribLFormat", (void **)&glad_glVertexArrayAttribLFormat, (void *)glad_lazy_glVertexArrayAttribLFormat, 0 },
+    { "glVertexArrayBindingDivisor", (void **)&glad_glVertexArrayBindingDivisor, (void *)glad_lazy_glVertexArrayBindingDivisor, 0 },
+    { "glVertexArrayElementBuffer", (void **)&glad_glVertexArrayElementBuffer, (void *)glad_lazy_glVertexArrayElementBuffer, 0 },
+    { "glVertexArrayVertexBuffer", (void **)&glad_glVertexArrayVertexBuffer, (void *)glad_lazy_glVertexArrayVertexBuffer, 0 },
+    { "glVertexArrayVertexBuffers", (void **)&glad_glVertexArrayVertexBuffers, (void *)glad_lazy_glVertexArrayVertexBuffers, 0 },
+    { "glVertexAttrib1d", (void **)&glad_glVertexAttrib1d, (void *)glad_lazy_glVertexAttrib1d, 0 },
+    { "glVertexAttrib1dv", (void **)&glad_glVertexAttrib1dv, (void *)glad_lazy_glVertexAttrib1dv, 0 },
+    { "glVertexAttrib1f", (void **)&glad_glVertexAttrib1f, (void *)glad_lazy_glVertexAttrib1f, 0 },
+    { "glVertexAttrib1fv", (void **)&glad_glVertexAttrib1fv, (void *)glad_lazy_glVertexAttrib1fv, 0 },
+    { "glVertexAttrib1s", (void **)&glad_glVertexAttrib1s, (void *)glad_lazy_glVertexAttrib1s, 0 },
+    { "glVertexAttrib1sv", (void **)&glad_glVertexAttrib1sv, (void *)glad_lazy_glVertexAttrib1sv, 0 },
+    { "glVertexAttrib2d", (void **)&glad_glVertexAttrib2d, (void *)glad_lazy_glVertexAttrib2d, 0 },
+    { "glVertexAttrib2dv", (void **)&glad_glVertexAttrib2dv, (void *)glad_lazy_glVertexAttrib2dv, 0 },
+    { "glVertexAttrib2f", (void **)&glad_glVertexAttrib2f, (void *)glad_lazy_glVertexAttrib2f, 0 },
+    { "glVertexAttrib2fv", (void **)&glad_glVertexAttrib2fv, (void *)glad_lazy_glVertexAttrib2fv, 0 },
+    { "glVertexAttrib2s", (void **)&glad_glVertexAttrib2s, (void *)glad_lazy_glVertexAttrib2s, 0 },
+    { "glVertexAttrib2sv", (void **)&glad_glVertexAttrib2sv, (void *)glad_lazy_glVertexAttrib2sv, 0 },
+    { "glVertexAttrib3d", (void **)&glad_glVertexAttrib3d, (void *)glad_lazy_glVertexAttrib3d, 0 },
+    { "glVertexAttrib3dv", (void **)&glad_glVertexAttrib3dv, (void *)glad_lazy_glVertexAttrib3dv, 0 },
+    { "glVertexAttrib3f", (void **)&glad_glVertexAttrib3f, (void *)glad_lazy_glVertexAttrib3f, 0 },
+    { "glVertexAttrib3fv", (void **)&glad_glVertexAttrib3fv, (void *)glad_lazy_glVertexAttrib3fv, 0 },
+    { "glVertexAttrib3s", (void **)&glad_glVertexAttrib3s, (void *)glad_lazy_glVertexAttrib3s, 0 },
+    { "glVertexAttrib3sv", (void **)&glad_glVertexAttrib3sv, (void *)glad_lazy_glVertexAttrib3sv, 0 },
+    { "glVertexAttrib4Nbv", (void **)&glad_glVertexAttrib4Nbv, (void *)glad_lazy_glVertexAttrib4Nbv, 0 },
+    { "glVertexAttrib4Niv", (void **)&glad_glVertexAttrib4Niv, (void *)glad_lazy_glVertexAttrib4Niv, 0 },
+    { "glVertexAttrib4Nsv", (void **)&glad_glVertexAttrib4Nsv, (void *)glad_lazy_glVertexAttrib4Nsv, 0 },
+    { "glVertexAttrib4Nub", (void **)&glad_glVertexAttrib4Nub, (void *)glad_lazy_glVertexAttrib4Nub, 0 },
+    { "glVertexAttrib4Nubv", (void **)&glad_glVertexAttrib4Nubv, (void *)glad_lazy_glVertexAttrib4Nubv, 0 },
+    { "glVertexAttrib4Nuiv", (void **)&glad_glVertexAttrib4Nuiv, (void *)glad_lazy_glVertexAttrib4Nuiv, 0 },
+    { "glVertexAttrib4Nusv", (void **)&glad_glVertexAttrib4Nusv, (void *)glad_lazy_glVertexAttrib4Nusv, 0 },
+    { "glVertexAttrib4bv", (void **)&glad_glVertexAttrib4bv, (void *)glad_lazy_glVertexAttrib4bv, 0 },
+    { "glVertexAttrib4d", (void **)&glad_glVertexAttrib4d, (void *)glad_lazy_glVertexAttrib4d, 0 },
+    { "glVertexAttrib4dv", (void **)&glad_glVertexAttrib4dv, (void *)glad_lazy_glVertexAttrib4dv, 0 },
+    { "glVertexAttrib4f", (void **)&glad_glVertexAttrib4f, (void *)glad_lazy_glVertexAttrib4f, 0 },
+    { "glVertexAttrib4fv", (void **)&glad_glVertexAttrib4fv, (void *)glad_lazy_glVertexAttrib4fv, 0 },
+    { "glVertexAttrib4iv", (void **)&glad_glVertexAttrib4iv, (void *)glad_lazy_glVertexAttrib4iv, 0 },
+    { "glVertexAttrib4s", (void **)&glad_glVertexAttrib4s, (void *)glad_lazy_glVertexAttrib4s, 0 },
+    { "glVertexAttrib4sv", (void **)&glad_glVertexAttrib4sv, (void *)glad_lazy_glVertexAttrib4sv, 0 },
+    { "glVertexAttrib4ubv", (void **)&glad_glVertexAttrib4ubv, (void *)glad_lazy_glVertexAttrib4ubv, 0 },
+    { "glVertexAttrib4uiv", (void **)&glad_glVertexAttrib4uiv, (void *)glad_lazy_glVertexAttrib4uiv, 0 },
+    { "glVertexAttrib4usv", (void **)&glad_glVertexAttrib4usv, (void *)glad_lazy_glVertexAttrib4usv, 0 },
+    { "glVertexAttribBinding", (void **)&glad_glVertexAttribBinding, (void *)glad_lazy_glVertexAttribBinding, 0 },
+    { "glVertexAttribDivisor", (void **)&glad_glVertexAttribDivisor, (void *)glad_lazy_glVertexAttribDivisor, 0 },
+    { "glVertexAttribFormat", (void **)&glad_glVertexAttribFormat, (void *)glad_lazy_glVertexAttribFormat, 0 },
+    { "glVertexAttribI1i", (void **)&glad_glVertexAttribI1i, (void *)glad_lazy_glVertexAttribI1i, 0 },
+    { "glVertexAttribI1iv", (void **)&glad_glVertexAttribI1iv, (void *)glad_lazy_glVertexAttribI1iv, 0 },
+    { "glVertexAttribI1ui", (void **)&glad_glVertexAttribI1ui, (void *)glad_lazy_glVertexAttribI1ui, 0 },
+    { "glVertexAttribI1uiv", (void **)&glad_glVertexAttribI1uiv, (void *)glad_lazy_glVertexAttribI1uiv, 0 },
+    { "glVertexAttribI2i", (void **)&glad_glVertexAttribI2i, (void *)glad_lazy_glVertexAttribI2i, 0 },
+    { "glVertexAttribI2iv", (void **)&glad_glVertexAttribI2iv, (void *)glad_lazy_glVertexAttribI2iv, 0 },
+    { "glVertexAttribI2ui", (void **)&glad_glVertexAttribI2ui, (void *)glad_lazy_glVertexAttribI2ui, 0 },
+    { "glVertexAttribI2uiv", (void **)&glad_glVertexAttribI2uiv, (void *)glad_lazy_glVertexAttribI2uiv, 0 },
+    { "glVertexAttribI3i", (void **)&glad_glVertexAttribI3i, (void *)glad_lazy_glVertexAttribI3i, 0 },
+    { "glVertexAttribI3iv", (void **)&glad_glVertexAttribI3iv, (void *)glad_lazy_glVertexAttribI3iv, 0 },
+    { "glVertexAttribI3ui", (void **)&glad_glVertexAttribI3ui, (void *)glad_lazy_glVertexAttribI3ui, 0 },
+    { "glVertexAttribI3uiv", (void **)&glad_glVertexAttribI3uiv, (void *)glad_lazy_glVertexAttribI3uiv, 0 },
+    { "glVertexAttribI4bv", (void **)&glad_glVertexAttribI4bv, (void *)glad_lazy_glVertexAttribI4bv, 0 },
+    { "glVertexAttribI4i", (void **)&glad_glVertexAttribI4i, (void *)glad_lazy_glVertexAttribI4i, 0 },
+    { "glVertexAttribI4iv", (void **)&glad_glVertexAttribI4iv, (void *)glad_lazy_glVertexAttribI4iv, 0 },
+    { "glVertexAttribI4sv", (void **)&glad_glVertexAttribI4sv, (void *)glad_lazy_glVertexAttribI4sv, 0 },
+    { "glVertexAttribI4ubv", (void **)&glad_glVertexAttribI4ubv, (void *)glad_lazy_glVertexAttribI4ubv, 0 },
+    { "glVertexAttribI4ui", (void **)&glad_glVertexAttribI4ui, (void *)glad_lazy_glVertexAttribI4ui, 0 },
+    { "glVertexAttribI4uiv", (void **)&glad_glVertexAttribI4uiv, (void *)glad_lazy_glVertexAttribI4uiv, 0 },
+    { "glVertexAttribI4usv", (void **)&glad_glVertexAttribI4usv, (void *)glad_lazy_glVertexAttribI4usv, 0 },
+    { "glVertexAttribIFormat", (void **)&glad_glVertexAttribIFormat, (void *)glad_lazy_glVertexAttribIFormat, 0 },
+    { "glVertexAttribIPointer", (void **)&glad_glVertexAttribIPointer, (void *)glad_lazy_glVertexAttribIPointer, 0 },
+    { "glVertexAttribL1d", (void **)&glad_glVertexAttribL1d, (void *)glad_lazy_glVertexAttribL1d, 0 },
+    { "glVertexAttribL1dv", (void **)&glad_glVertexAttribL1dv, (void *)glad_lazy_glVertexAttribL1dv, 0 },
+    { "glVertexAttribL2d", (void **)&glad_glVertexAttribL2d, (void *)glad_lazy_glVertexAttribL2d, 0 },
+    { "glVertexAttribL2dv", (void **)&glad_glVertexAttribL2dv, (void *)glad_lazy_glVertexAttribL2dv, 0 },
+    { "glVertexAttribL3d", (void **)&glad_glVertexAttribL3d, (void *)glad_lazy_glVertexAttribL3d, 0 },
+    { "glVertexAttribL3dv", (void **)&glad_glVertexAttribL3dv, (void *)glad_lazy_glVertexAttribL3dv, 0 },
+    { "glVertexAttribL4d", (void **)&glad_glVertexAttribL4d, (void *)glad_lazy_glVertexAttribL4d, 0 },
+    { "glVertexAttribL4dv", (void **)&glad_glVertexAttribL4dv, (void *)glad_lazy_glVertexAttribL4dv, 0 },
+    { "glVertexAttribLFormat", (void **)&glad_glVertexAttribLFormat, (void *)glad_lazy_glVertexAttribLFormat, 0 },
+    { "glVertexAttribLPointer", (void **)&glad_glVertexAttribLPointer, (void *)glad_lazy_glVertexAttribLPointer, 0 },
+    { "glVertexAttribP1ui", (void **)&glad_glVertexAttribP1ui, (void *)glad_lazy_glVertexAttribP1ui, 0 },
+    { "glVertexAttribP1uiv", (void **)&glad_glVertexAttribP1uiv, (void *)glad_lazy_glVertexAttribP1uiv, 0 },
+    { "glVertexAttribP2ui", (void **)&glad_glVertexAttribP2ui, (void *)glad_lazy_glVertexAttribP2ui, 0 },
+    { "glVertexAttribP2uiv", (void **)&glad_glVertexAttribP2uiv, (void *)glad_lazy_glVertexAttribP2uiv, 0 },
+    { "glVertexAttribP3ui", (void **)&glad_glVertexAttribP3ui, (void *)glad_lazy_glVertexAttribP3ui, 0 },
+    { "glVertexAttribP3uiv", (void **)&glad_glVertexAttribP3uiv, (void *)glad_lazy_glVertexAttribP3uiv, 0 },
+    { "glVertexAttribP4ui", (void **)&glad_glVertexAttribP4ui, (void *)glad_lazy_glVertexAttribP4ui, 0 },
+    { "glVertexAttribP4uiv", (void **)&glad_glVertexAttribP4uiv, (void *)glad_lazy_glVertexAttribP4uiv, 0 },
+    { "glVertexAttribPointer", (void **)&glad_glVertexAttribPointer, (void *)glad_lazy_glVertexAttribPointer, 0 },
+    { "glVertexBindingDivisor", (void **)&glad_glVertexBindingDivisor, (void *)glad_lazy_glVertexBindingDivisor, 0 },
+    { "glVertexP2ui", (void **)&glad_glVertexP2ui, (void *)glad_lazy_glVertexP2ui, 0 },
+    { "glVertexP2uiv", (void **)&glad_glVertexP2uiv, (void *)glad_lazy_glVertexP2uiv, 0 },
+    { "glVertexP3ui", (void **)&glad_glVertexP3ui, (void *)glad_lazy_glVertexP3ui, 0 },
+    { "glVertexP3uiv", (void **)&glad_glVertexP3uiv, (void *)glad_lazy_glVertexP3uiv, 0 },
+    { "glVertexP4ui", (void **)&glad_glVertexP4ui, (void *)glad_lazy_glVertexP4ui, 0 },
+    { "glVertexP4uiv", (void **)&glad_glVertexP4uiv, (void *)glad_lazy_glVertexP4uiv, 0 },
+    { "glVertexPointer", (void **)&glad_glVertexPointer, (void *)glad_lazy_glVertexPointer, 0 },
+    { "glViewport", (void **)&glad_glViewport, (void *)glad_lazy_glViewport, 0 },
+    { "glViewportArrayv", (void **)&glad_glViewportArrayv, (void *)glad_lazy_glViewportArrayv, 0 },
+    { "glViewportIndexedf", (void **)&glad_glViewportIndexedf, (void *)glad_lazy_glViewportIndexedf, 0 },
+    { "glViewportIndexedfv", (void **)&glad_glViewportIndexedfv, (void *)glad_lazy_glViewportIndexedfv, 0 },
+    { "glWaitSync", (void **)&glad_glWaitSync, (void *)glad_lazy_glWaitSync, 0 },
+    { "glWindowPos2d", (void **)&glad_glWindowPos2d, (void *)glad_lazy_glWindowPos2d, 0 },
+    { "glWindowPos2dv", (void **)&glad_glWindowPos2dv, (void *)glad_lazy_glWindowPos2dv, 0 },
+    { "glWindowPos2f", (void **)&glad_glWindowPos2f, (void *)glad_lazy_glWindowPos2f, 0 },
+    { "glWindowPos2fv", (void **)&glad_glWindowPos2fv, (void *)glad_lazy_glWindowPos2fv, 0 },
+    { "glWindowPos2i", (void **)&glad_glWindowPos2i, (void *)glad_lazy_glWindowPos2i, 0 },
+    { "glWindowPos2iv", (void **)&glad_glWindowPos2iv, (void *)glad_lazy_glWindowPos2iv, 0 },
+    { "glWindowPos2s", (void **)&glad_glWindowPos2s, (void *)glad_lazy_glWindowPos2s, 0 },
+    { "glWindowPos2sv", (void **)&glad_glWindowPos2sv, (void *)glad_lazy_glWindowPos2sv, 0 },
+    { "glWindowPos3d", (void **)&glad_glWindowPos3d, (void *)glad_lazy_glWindowPos3d, 0 },
+    { "glWindowPos3dv", (void **)&glad_glWindowPos3dv, (void *)glad_lazy_glWindowPos3dv, 0 },
+    { "glWindowPos3f", (void **)&glad_glWindowPos3f, (void *)glad_lazy_glWindowPos3f, 0 },
+    { "glWindowPos3fv", (void **)&glad_glWindowPos3fv, (void *)glad_lazy_glWindowPos3fv, 0 },
+    { "glWindowPos3i", (void **)&glad_glWindowPos3i, (void *)glad_lazy_glWindowPos3i, 0 },
+    { "glWindowPos3iv", (void **)&glad_glWindowPos3iv, (void *)glad_lazy_glWindowPos3iv, 0 },
+    { "glWindowPos3s", (void **)&glad_glWindowPos3s, (void *)glad_lazy_glWindowPos3s, 0 },
+    { "glWindowPos3sv", (void **)&glad_glWindowPos3sv, (void *)glad_lazy_glWindowPos3sv, 0 },
+};
+
+static void glad_lazy_resolve(int index) {
+    struct glad_lazy_entry *entry = &glad_lazy_entries[index];
+    void *proc = glad_lazy_load != NULL ? glad_lazy_load(entry->name) : NULL;
+    if(proc == NULL) {
+        fprintf(stderr, "glad: %s is not available in this context\n", entry->name);
+    }
+    *entry->slot = proc;
+    entry->resolved = 1;
+}
 static int find_extensionsGL(void) {
+	/* the index stays alive for gladHasExtension until the next load */
 	if (!get_exts()) return 0;
 	(void)&has_ext;
-	free_exts();
 	return 1;
 }
 
@@ -2501,8 +4689,14 @@ static void find_coreGL(void) {
 	}
 }
 
+int gladHasExtension(const char *ext) {
+	return has_ext(ext);
+}
+
 int gladLoadGLLoader(GLADloadproc load) {
 	GLVersion.major = 0; GLVersion.minor = 0;
+	glad_lazy_load = NULL;
+	free_exts();
 	glGetString = (PFNGLGETSTRINGPROC)load("glGetString");
 	if(glGetString == NULL) return 0;
 	if(glGetString(GL_VERSION) == NULL) return 0;
@@ -2531,3 +4725,48 @@ int gladLoadGLLoader(GLADloadproc load) {
 	return GLVersion.major != 0 || GLVersion.minor != 0;
 }
 
+int gladLoadGLLoaderLazy(GLADloadproc load) {
+	int index;
+	GLVersion.major = 0; GLVersion.minor = 0;
+	free_exts();
+
+	glad_lazy_load = load;
+	for (index = 0; index < GLAD_LAZY_COUNT; index++) {
+		*glad_lazy_entries[index].slot = glad_lazy_entries[index].trampoline;
+		glad_lazy_entries[index].resolved = 0;
+	}
+
+	/* the version query decides whether the context is usable, so bind it up front */
+	glad_lazy_resolve(GLAD_LAZY_GETSTRING);
+	if(glGetString == NULL) return 0;
+	if(glGetString(GL_VERSION) == NULL) return 0;
+	find_coreGL();
+
+	if (!find_extensionsGL()) return 0;
+	return GLVersion.major != 0 || GLVersion.minor != 0;
+}
+
+void gladResolveLazy(const char *name) {
+	int index;
+	if (glad_lazy_load == NULL) return;
+	for (index = 0; index < GLAD_LAZY_COUNT; index++) {
+		if (strcmp(glad_lazy_entries[index].name, name) == 0) {
+			if (!glad_lazy_entries[index].resolved) glad_lazy_resolve(index);
+			return;
+		}
+	}
+}
+
+void gladPrintLazyStats(void) {
+	int index, used = 0;
+	for (index = 0; index < GLAD_LAZY_COUNT; index++) {
+		used += glad_lazy_entries[index].resolved;
+	}
+	printf("glad: %d of %d entry points used\n", used, GLAD_LAZY_COUNT);
+	for (index = 0; index < GLAD_LAZY_COUNT; index++) {
+		if (glad_lazy_entries[index].resolved) {
+			printf("  %s\n", glad_lazy_entries[index].name);
+		}
+	}
+}
+